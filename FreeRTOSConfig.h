@@ -188,7 +188,10 @@ standard names - or at least those used in the unmodified vector table. */
 #define HEAP_ALLOCATION_TYPE5                   (5)     /* heap_5.c*/
 #define NO_HEAP_ALLOCATION                      (0)
 
-#define configHEAP_ALLOCATION_SCHEME            (HEAP_ALLOCATION_TYPE3)
+/* pvPortMalloc() and vPortFree() are provided by the fixed-block pool
+ * allocator in pool_allocator.c instead of a FreeRTOS heap implementation.
+ */
+#define configHEAP_ALLOCATION_SCHEME            (NO_HEAP_ALLOCATION)
 
 /* Check if the ModusToolbox Device Configurator Power personality parameter
  * "System Idle Power Mode" is set to either "CPU Sleep" or "System Deep Sleep".
@@ -231,4 +234,11 @@ extern void vApplicationSleep( uint32_t xExpectedIdleTime );
  */
 #define configUSE_NEWLIB_REENTRANT              1
 
+/* Scheduler trace recorder hooks. The assembler sources of some ports include
+ * this file, so the C declarations are left out for them.
+ */
+#if !defined(__IASMARM__) && !defined(__ASSEMBLER__)
+#include "trace_recorder.h"
+#endif
+
 #endif /* FREERTOS_CONFIG_H */
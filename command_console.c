@@ -0,0 +1,719 @@
+/*******************************************************************************
+* File Name: command_console.c
+*
+* Description: This file contains the command console on the debug UART used
+* by retarget-io. The console task polls the UART without blocking the other
+* tasks and forwards the commands to the WPS enrollee task, so that WPS,
+* connection, and stress tests can be run without pressing the user button.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cyhal.h"
+#include "cy_retarget_io.h"
+
+/* FreeRTOS includes */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "wps_enrollee_task.h"
+#include "network_event_dispatcher.h"
+#include "conn_journal_flash.h"
+#include "fault_recovery.h"
+#include "provisioning_relay.h"
+#include "connection_state.h"
+#include "network_warmup.h"
+#include "power_save_controller.h"
+#include "pool_allocator.h"
+#include "trace_recorder.h"
+#include "metrics_endpoint.h"
+#include "connection_context.h"
+#include "command_console.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define ASCII_BACKSPACE                     ('\b')
+#define ASCII_DELETE                        (0x7F)
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef struct
+{
+    const char *name;
+    const char *usage;
+    void (*handler)(int argc, char *argv[]);
+} console_command_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static void command_console_task(void *arg);
+static void execute_line(char *line);
+static void command_help(int argc, char *argv[]);
+static void command_wps(int argc, char *argv[]);
+static void command_cancel(int argc, char *argv[]);
+static void command_connect(int argc, char *argv[]);
+static void command_disconnect(int argc, char *argv[]);
+static void command_stats(int argc, char *argv[]);
+static void command_stress(int argc, char *argv[]);
+static void command_journal(int argc, char *argv[]);
+static void command_power(int argc, char *argv[]);
+static void command_heap(int argc, char *argv[]);
+static void command_trace(int argc, char *argv[]);
+static void send_command(wps_enrollee_command_type_t type, uint32_t arg);
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static TaskHandle_t command_console_task_handle;
+
+/* Copy of the allocation trace printed by the heap command. */
+static pool_allocator_trace_entry_t trace_entries[POOL_ALLOCATOR_TRACE_DEPTH];
+
+static const console_command_t console_commands[] =
+{
+    { "help",       "help                 - List the commands",                        command_help },
+    { "wps",        "wps [pbc|pin|race]   - Start WPS enrollee, in the given mode from now on", command_wps },
+    { "cancel",     "cancel               - Cancel the wait for WPS AP or stress test", command_cancel },
+    { "connect",    "connect              - Connect with the last WPS credentials",    command_connect },
+    { "disconnect", "disconnect           - Disconnect from the AP",                   command_disconnect },
+    { "stats",      "stats                - Print the connection statistics",          command_stats },
+    { "stress",     "stress <n> [wps]     - Run n connect (or WPS + connect, one AP action each) cycles", command_stress },
+    { "journal",    "journal [n]          - Print the newest n journal records",       command_journal },
+    { "power",      "power [level]        - Print or set power save (auto, low, balanced, perf)", command_power },
+    { "heap",       "heap [trace [on|off]] - Print pool usage or the trace, or start/stop tracing", command_heap },
+    { "trace",      "trace [start|stop|dump] - Record the scheduler or dump it for tools/trace_to_chrome", command_trace },
+};
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: command_console_init
+ *******************************************************************************
+ * Summary: Creates the command console task. retarget-io must be initialized
+ * before calling this function.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the console task was created.
+ *
+ ******************************************************************************/
+cy_rslt_t command_console_init(void)
+{
+    if (pdPASS != xTaskCreate(command_console_task, "Console Task", COMMAND_CONSOLE_TASK_STACK_SIZE,
+                              NULL, COMMAND_CONSOLE_TASK_PRIORITY, &command_console_task_handle))
+    {
+        return COMMAND_CONSOLE_RSLT_NO_MEMORY;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/*******************************************************************************
+ * Function Name: command_console_task
+ *******************************************************************************
+ * Summary: Collects the characters received on the debug UART into a line and
+ * executes the line on carriage return or line feed. The UART is polled, so
+ * the task sleeps between polls and never blocks on the UART.
+ *
+ * Parameters:
+ *  void* arg: Task parameter defined during task creation (unused).
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void command_console_task(void *arg)
+{
+    char line[COMMAND_CONSOLE_LINE_LENGTH];
+    uint32_t length = 0;
+    uint8_t received;
+
+    (void)arg;
+
+    APP_INFO(("Command console ready. Type 'help' for the list of commands.\n"));
+
+    while (true)
+    {
+        while (cyhal_uart_readable(&cy_retarget_io_uart_obj) > 0u)
+        {
+            if (CY_RSLT_SUCCESS != cyhal_uart_getc(&cy_retarget_io_uart_obj, &received, 0))
+            {
+                break;
+            }
+
+            if (('\r' == received) || ('\n' == received))
+            {
+                if (length > 0u)
+                {
+                    printf("\n");
+                    line[length] = '\0';
+                    execute_line(line);
+                    length = 0;
+                }
+            }
+            else if ((ASCII_BACKSPACE == received) || (ASCII_DELETE == received))
+            {
+                if (length > 0u)
+                {
+                    length--;
+                    printf("\b \b");
+                    fflush(stdout);
+                }
+            }
+            else if (length < (COMMAND_CONSOLE_LINE_LENGTH - 1u))
+            {
+                line[length++] = (char)received;
+                printf("%c", received);
+                fflush(stdout);
+            }
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(COMMAND_CONSOLE_POLL_INTERVAL_MSEC));
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: execute_line
+ *******************************************************************************
+ * Summary: Splits the line into words and calls the handler of the command
+ * named by the first word.
+ *
+ * Parameters:
+ *  char *line: Null terminated command line. It is modified in place.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void execute_line(char *line)
+{
+    char *argv[COMMAND_CONSOLE_MAX_ARGS];
+    int argc = 0;
+    char *save_ptr = NULL;
+    char *word = strtok_r(line, " \t", &save_ptr);
+
+    while ((NULL != word) && (argc < (int)COMMAND_CONSOLE_MAX_ARGS))
+    {
+        argv[argc++] = word;
+        word = strtok_r(NULL, " \t", &save_ptr);
+    }
+
+    if (0 == argc)
+    {
+        return;
+    }
+
+    for (uint32_t index = 0; index < (sizeof(console_commands) / sizeof(console_commands[0])); index++)
+    {
+        if (0 == strcmp(argv[0], console_commands[index].name))
+        {
+            console_commands[index].handler(argc, argv);
+            return;
+        }
+    }
+
+    ERR_INFO(("Unknown command '%s'. Type 'help' for the list of commands.\n", argv[0]));
+}
+
+
+/*******************************************************************************
+ * Function Name: command_help
+ *******************************************************************************
+ * Summary: Prints the usage of every command.
+ *
+ * Parameters:
+ *  int argc: Number of words in the command line.
+ *  char *argv[]: Words of the command line; argv[0] is the command name.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void command_help(int argc, char *argv[])
+{
+    for (uint32_t index = 0; index < (sizeof(console_commands) / sizeof(console_commands[0])); index++)
+    {
+        printf("  %s\n", console_commands[index].usage);
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: command_wps
+ *******************************************************************************
+ * Summary: Starts WPS provisioning. An optional mode (pbc, pin, or race)
+ * is set first and used by every later WPS run, including the one started by
+ * the user button.
+ *
+ * Parameters:
+ *  int argc: Number of words in the command line.
+ *  char *argv[]: Words of the command line; argv[0] is the command name.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void command_wps(int argc, char *argv[])
+{
+    if (argc > 1)
+    {
+        uint32_t mode = 0;
+
+        while ((mode < WPS_ENROLLEE_MODE_COUNT) &&
+               (0 != strcmp(argv[1], wps_enrollee_mode_name((wps_enrollee_mode_t)mode))))
+        {
+            mode++;
+        }
+
+        if (WPS_ENROLLEE_MODE_COUNT == mode)
+        {
+            ERR_INFO(("Unknown WPS mode '%s'.\n", argv[1]));
+            return;
+        }
+
+        wps_enrollee_set_mode((wps_enrollee_mode_t)mode);
+    }
+
+    send_command(WPS_ENROLLEE_CMD_START_WPS, 0);
+}
+
+
+/*******************************************************************************
+ * Function Name: command_cancel
+ *******************************************************************************
+ * Summary: Cancels the wait for an active WPS registrar, or stops a
+ * running stress test after its current cycle. Commands queued behind it still
+ * run.
+ *
+ * Parameters:
+ *  int argc: Number of words in the command line.
+ *  char *argv[]: Words of the command line; argv[0] is the command name.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void command_cancel(int argc, char *argv[])
+{
+    wps_enrollee_cancel();
+}
+
+
+/*******************************************************************************
+ * Function Name: command_connect
+ *******************************************************************************
+ * Summary: Connects to the AP with the credentials of the last WPS run.
+ *
+ * Parameters:
+ *  int argc: Number of words in the command line.
+ *  char *argv[]: Words of the command line; argv[0] is the command name.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void command_connect(int argc, char *argv[])
+{
+    send_command(WPS_ENROLLEE_CMD_CONNECT, 0);
+}
+
+
+/*******************************************************************************
+ * Function Name: command_disconnect
+ *******************************************************************************
+ * Summary: Disconnects from the AP. The disconnection is counted as
+ * requested, not as a link loss.
+ *
+ * Parameters:
+ *  int argc: Number of words in the command line.
+ *  char *argv[]: Words of the command line; argv[0] is the command name.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void command_disconnect(int argc, char *argv[])
+{
+    send_command(WPS_ENROLLEE_CMD_DISCONNECT, 0);
+}
+
+
+/*******************************************************************************
+ * Function Name: command_stats
+ *******************************************************************************
+ * Summary: Prints the provisioning, connection, warm-up, power-save,
+ * and fault recovery statistics.
+ *
+ * Parameters:
+ *  int argc: Number of words in the command line.
+ *  char *argv[]: Words of the command line; argv[0] is the command name.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void command_stats(int argc, char *argv[])
+{
+    wps_enrollee_stats_t stats;
+    fault_recovery_stats_t recovery;
+    connection_state_snapshot_t snapshot;
+    network_warmup_stats_t warmup;
+    power_save_stats_t power;
+    connection_context_stats_t resume;
+
+    wps_enrollee_get_stats(&stats);
+    fault_recovery_get_stats(&recovery);
+    connection_state_get_snapshot(&snapshot);
+    network_warmup_get_stats(&warmup);
+    power_save_controller_get_stats(&power);
+    connection_context_get_stats(&resume);
+
+    printf("  Connection state      : %s (generation %lu, %lu ms ago)\n", connection_state_name(snapshot.state),
+           (unsigned long)snapshot.generation,
+           (unsigned long)((xTaskGetTickCount() - snapshot.timestamp) * portTICK_PERIOD_MS));
+    printf("  WPS attempts          : %lu (%lu passed, %lu failed)\n", (unsigned long)stats.wps_attempts,
+           (unsigned long)stats.wps_successes, (unsigned long)stats.wps_failures);
+    printf("  Connect attempts      : %lu (%lu passed, %lu failed)\n", (unsigned long)stats.connect_attempts,
+           (unsigned long)stats.connect_successes, (unsigned long)stats.connect_failures);
+    printf("  Disconnections        : %lu link losses, %lu requested\n", (unsigned long)stats.link_losses,
+           (unsigned long)stats.user_disconnects);
+    printf("  Link restorations     : %lu (mean time to restore %lu ms)\n", (unsigned long)stats.link_restorations,
+           (unsigned long)((0u == stats.link_restorations) ? 0u :
+                           (stats.total_restore_time_ms / stats.link_restorations)));
+    printf("  WPS mode              : %s\n", wps_enrollee_mode_name(wps_enrollee_get_mode()));
+    printf("  Credentials via PBC   : %lu (last %lu ms, mean %lu ms to credential)\n",
+           (unsigned long)stats.pbc.credentials, (unsigned long)stats.pbc.last_time_to_credential_ms,
+           (unsigned long)((0u == stats.pbc.credentials) ? 0u :
+                           (stats.pbc.total_time_to_credential_ms / stats.pbc.credentials)));
+    printf("  Credentials via PIN   : %lu (last %lu ms, mean %lu ms to credential)\n",
+           (unsigned long)stats.pin.credentials, (unsigned long)stats.pin.last_time_to_credential_ms,
+           (unsigned long)((0u == stats.pin.credentials) ? 0u :
+                           (stats.pin.total_time_to_credential_ms / stats.pin.credentials)));
+    printf("  Last registrar wait   : %lu ms (%lu ms from the scan that saw the registrar)\n",
+           (unsigned long)stats.last_registrar_wait_ms, (unsigned long)stats.last_registrar_detect_ms);
+    printf("  Last WPS duration     : %lu ms\n", (unsigned long)stats.last_wps_duration_ms);
+    printf("  Last connect duration : %lu ms\n", (unsigned long)stats.last_connect_duration_ms);
+    printf("  Time to provisioned   : %lu ms\n", (unsigned long)stats.last_provision_duration_ms);
+    printf("  Resumes after reset   : %lu (%lu failed, %lu with the retained lease, %lu leases renewed)\n",
+           (unsigned long)resume.resumes, (unsigned long)resume.resume_failures, (unsigned long)resume.lease_reuses,
+           (unsigned long)resume.lease_renewals);
+    printf("  Last resume           : %lu ms from boot, %lu ms to connect\n",
+           (unsigned long)resume.last_boot_to_connected_ms, (unsigned long)resume.last_resume_connect_ms);
+    printf("  Traffic-ready         : %s (%lu ms after IP, first step %lu ms)\n",
+           network_warmup_is_traffic_ready() ? "yes" : "no",
+           (unsigned long)warmup.last_traffic_ready_time_ms, (unsigned long)warmup.last_first_step_time_ms);
+    printf("  First request         : %lu ms after IP\n", (unsigned long)warmup.last_first_request_time_ms);
+    printf("  Warm-up steps         : DNS %lu ms, ARP %lu ms, SNTP %lu ms (%lu of %lu runs timed out)\n",
+           (unsigned long)warmup.last_dns_time_ms, (unsigned long)warmup.last_arp_time_ms,
+           (unsigned long)warmup.last_sntp_time_ms, (unsigned long)warmup.timeouts, (unsigned long)warmup.runs);
+    printf("  Power-save level      : %s (%s, %lu packets/s, %lu switches)\n",
+           power_save_level_name(power.level), power.is_automatic ? "automatic" : "forced",
+           (unsigned long)power.rate_pps, (unsigned long)power.switches);
+    printf("  Relay provisions      : %lu received, %lu served\n", (unsigned long)stats.relay_provisions,
+           (unsigned long)provisioning_relay_get_served_count());
+    printf("  Dropped WCM events    : %lu\n", (unsigned long)network_event_get_dropped_count());
+    printf("  Dropped journal recs  : %lu\n", (unsigned long)conn_journal_get_dropped_count());
+    printf("  Metrics requests      : %lu\n", (unsigned long)metrics_endpoint_get_served_count());
+    printf("  Faults                : %lu (%lu retry, %lu Wi-Fi reset, %lu warm reset recoveries)\n",
+           (unsigned long)recovery.faults,
+           (unsigned long)recovery.recoveries[FAULT_RECOVERY_TIER_RETRY],
+           (unsigned long)recovery.recoveries[FAULT_RECOVERY_TIER_WIFI_RESET],
+           (unsigned long)recovery.recoveries[FAULT_RECOVERY_TIER_WARM_RESET]);
+    printf("  Warm resets           : %lu\n", (unsigned long)recovery.warm_resets);
+    printf("  Last time to recovery : %lu ms\n", (unsigned long)recovery.last_recovery_time_ms);
+}
+
+
+/*******************************************************************************
+ * Function Name: command_stress
+ *******************************************************************************
+ * Summary: Runs n disconnect and connect cycles, or n WPS and connect
+ * cycles with the wps option, and prints the latency percentiles. A WPS cycle
+ * is not automatic: each one waits up to WPS_PRESCAN_TIMEOUT_MSEC for an
+ * active registrar, so the WPS button must be pressed or the PIN entered on
+ * the AP (or the registrar started from its management interface) once per
+ * cycle. A cycle without that action fails after the wait.
+ *
+ * Parameters:
+ *  int argc: Number of words in the command line.
+ *  char *argv[]: Words of the command line; argv[0] is the command name.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void command_stress(int argc, char *argv[])
+{
+    uint32_t cycles = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 0u;
+    bool is_wps_cycle = (argc > 2) && (0 == strcmp(argv[2], "wps"));
+
+    if ((0u == cycles) || ((argc > 2) && !is_wps_cycle))
+    {
+        ERR_INFO(("Usage: stress <n> [wps]\n"));
+        return;
+    }
+
+    send_command(is_wps_cycle ? WPS_ENROLLEE_CMD_STRESS_WPS : WPS_ENROLLEE_CMD_STRESS_CONNECT, cycles);
+}
+
+
+/*******************************************************************************
+ * Function Name: command_journal
+ *******************************************************************************
+ * Summary: Prints the newest n records of the connection journal, or
+ * CONN_JOURNAL_BOOT_PRINT_COUNT records without n.
+ *
+ * Parameters:
+ *  int argc: Number of words in the command line.
+ *  char *argv[]: Words of the command line; argv[0] is the command name.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void command_journal(int argc, char *argv[])
+{
+    uint32_t count = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : CONN_JOURNAL_BOOT_PRINT_COUNT;
+
+    print_connection_journal(count);
+}
+
+
+/*******************************************************************************
+ * Function Name: command_power
+ *******************************************************************************
+ * Summary: Forces a power-save level (low, balanced, or perf), returns
+ * to the automatic selection (auto), or, without an argument, prints the
+ * level, the traffic, and the time spent in each level.
+ *
+ * Parameters:
+ *  int argc: Number of words in the command line.
+ *  char *argv[]: Words of the command line; argv[0] is the command name.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void command_power(int argc, char *argv[])
+{
+    power_save_stats_t power;
+
+    if (argc > 1)
+    {
+        if (0 == strcmp(argv[1], "auto"))
+        {
+            power_save_controller_set_automatic();
+        }
+        else if (0 == strcmp(argv[1], "low"))
+        {
+            power_save_controller_force_level(POWER_SAVE_LEVEL_LOW_POWER);
+        }
+        else if (0 == strcmp(argv[1], "balanced"))
+        {
+            power_save_controller_force_level(POWER_SAVE_LEVEL_BALANCED);
+        }
+        else if (0 == strcmp(argv[1], "perf"))
+        {
+            power_save_controller_force_level(POWER_SAVE_LEVEL_PERFORMANCE);
+        }
+        else
+        {
+            ERR_INFO(("Unknown power-save level '%s'.\n", argv[1]));
+        }
+        return;
+    }
+
+    power_save_controller_get_stats(&power);
+
+    printf("  Level                 : %s (%s)\n", power_save_level_name(power.level),
+           power.is_automatic ? "automatic" : "forced");
+    printf("  Traffic               : %lu packets/s\n", (unsigned long)power.rate_pps);
+    printf("  Level switches        : %lu\n", (unsigned long)power.switches);
+    printf("  Failed level changes  : %lu\n", (unsigned long)power.apply_failures);
+    for (uint32_t level = 0; level < POWER_SAVE_LEVEL_COUNT; level++)
+    {
+        printf("  Time in %-13s : %lu ms\n", power_save_level_name((power_save_level_t)level),
+               (unsigned long)power.time_in_level_ms[level]);
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: command_heap
+ *******************************************************************************
+ * Summary: Prints the usage and internal fragmentation of each size class
+ * of the pool allocator and the requests passed to the C library heap. With
+ * trace, prints the allocation trace; with trace on or trace off, starts or
+ * stops recording it.
+ *
+ * Parameters:
+ *  int argc: Number of words in the command line.
+ *  char *argv[]: Words of the command line; argv[0] is the command name.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void command_heap(int argc, char *argv[])
+{
+    pool_allocator_class_stats_t pool;
+    pool_allocator_heap_stats_t heap;
+    uint32_t reserved_bytes;
+    uint32_t count;
+
+    if ((argc > 1) && (0 == strcmp(argv[1], "trace")))
+    {
+        if (argc > 2)
+        {
+            pool_allocator_set_trace(0 == strcmp(argv[2], "on"));
+            return;
+        }
+
+        count = pool_allocator_read_trace(trace_entries, POOL_ALLOCATOR_TRACE_DEPTH);
+        for (uint32_t index = 0; index < count; index++)
+        {
+            printf("  %10lu  %-5s  %p  %5lu  caller %p\n", (unsigned long)trace_entries[index].timestamp,
+                   (POOL_ALLOCATOR_TRACE_ALLOC == trace_entries[index].op) ? "alloc" : "free",
+                   trace_entries[index].address, (unsigned long)trace_entries[index].size,
+                   trace_entries[index].caller);
+        }
+        return;
+    }
+
+    printf("  Block   Blocks  In use  High  Allocations  Failures  Fragmentation\n");
+    for (uint32_t index = 0; index < POOL_ALLOCATOR_CLASS_COUNT; index++)
+    {
+        pool_allocator_get_class_stats(index, &pool);
+        reserved_bytes = pool.blocks_in_use * pool.block_size;
+
+        printf("  %5lu  %6lu  %6lu  %4lu  %11lu  %8lu  %12lu%%\n", (unsigned long)pool.block_size,
+               (unsigned long)pool.block_count, (unsigned long)pool.blocks_in_use, (unsigned long)pool.high_water,
+               (unsigned long)pool.allocations, (unsigned long)pool.failures,
+               (unsigned long)((0u == reserved_bytes) ? 0u :
+                               (((reserved_bytes - pool.requested_bytes_in_use) * 100u) / reserved_bytes)));
+    }
+
+    pool_allocator_get_heap_stats(&heap);
+    printf("  C library heap: %lu large, %lu overflow allocations, %lu failures\n",
+           (unsigned long)heap.large_allocations, (unsigned long)heap.overflow_allocations,
+           (unsigned long)heap.failures);
+}
+
+
+/*******************************************************************************
+ * Function Name: command_trace
+ *******************************************************************************
+ * Summary: Starts or stops the scheduler trace recorder, or prints the
+ * recorded events as dump lines for tools/trace_to_chrome (dump). Without an
+ * argument, prints the state of the recorder.
+ *
+ * Parameters:
+ *  int argc: Number of words in the command line.
+ *  char *argv[]: Words of the command line; argv[0] is the command name.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void command_trace(int argc, char *argv[])
+{
+    trace_recorder_stats_t trace;
+
+    if ((argc > 1) && (0 == strcmp(argv[1], "start")))
+    {
+        trace_recorder_start();
+    }
+    else if ((argc > 1) && (0 == strcmp(argv[1], "stop")))
+    {
+        trace_recorder_stop();
+    }
+    else if ((argc > 1) && (0 == strcmp(argv[1], "dump")))
+    {
+        trace_recorder_dump();
+    }
+    else
+    {
+        trace_recorder_get_stats(&trace);
+        printf("  Recording          : %s\n", trace.is_recording ? "yes" : "no");
+        printf("  Recorded events    : %lu\n", (unsigned long)trace.recorded_events);
+        printf("  Overwritten events : %lu\n", (unsigned long)trace.overwritten_events);
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: send_command
+ *******************************************************************************
+ * Summary: Queues a command for wps_enrollee_task and reports a full queue.
+ *
+ * Parameters:
+ *  wps_enrollee_command_type_t type: Command to be executed.
+ *  uint32_t arg: Command argument (number of cycles of the stress commands).
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void send_command(wps_enrollee_command_type_t type, uint32_t arg)
+{
+    if (CY_RSLT_SUCCESS != wps_enrollee_send_command(type, arg))
+    {
+        ERR_INFO(("WPS enrollee task is busy. Try again later.\n"));
+    }
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,82 @@
+/*******************************************************************************
+* File Name: command_console.h
+*
+* Description: This file includes the macros and function prototypes of the
+* UART command console used in command_console.c
+*
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ *  Include guard
+ ******************************************************************************/
+#ifndef SOURCE_COMMAND_CONSOLE_H_
+#define SOURCE_COMMAND_CONSOLE_H_
+
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include "cy_result.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define COMMAND_CONSOLE_TASK_STACK_SIZE     (2048u)
+#define COMMAND_CONSOLE_TASK_PRIORITY       (1u)
+
+/* Interval in milliseconds at which the UART is polled for input. */
+#define COMMAND_CONSOLE_POLL_INTERVAL_MSEC  (20u)
+
+/* Maximum length of a command line and maximum number of words in it. */
+#define COMMAND_CONSOLE_LINE_LENGTH         (64u)
+#define COMMAND_CONSOLE_MAX_ARGS            (4u)
+
+/* Console result codes. */
+#define COMMAND_CONSOLE_RSLT_MODULE         (CY_RSLT_MODULE_MIDDLEWARE_BASE + 0xF4u)
+#define COMMAND_CONSOLE_RSLT_NO_MEMORY      CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, COMMAND_CONSOLE_RSLT_MODULE, 1u)
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_rslt_t command_console_init(void);
+
+#endif /*SOURCE_COMMAND_CONSOLE_H_*/
+
+
+/* [] END OF FILE */
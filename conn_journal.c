@@ -0,0 +1,601 @@
+/*******************************************************************************
+* File Name: conn_journal.c
+*
+* Description: This file contains the append-only journal that keeps the
+* connection telemetry (disconnects, retries, and provisioning outcomes) in
+* flash across resets. The journal region is used as a ring of erase sectors;
+* records are programmed sequentially and the oldest sector is erased only when
+* the write position wraps into it, which spreads the erase cycles evenly over
+* the region.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <string.h>
+
+#include "conn_journal.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Number of bytes of the record covered by the CRC. */
+#define RECORD_CRC_LENGTH                   (CONN_JOURNAL_RECORD_SIZE - sizeof(uint16_t))
+
+#define CRC16_CCITT_POLYNOMIAL              (0x1021u)
+#define CRC16_CCITT_INIT                    (0xFFFFu)
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static const conn_journal_flash_t *journal_flash = NULL;
+static const conn_journal_port_t *journal_port = NULL;
+
+/* Number of record slots in one sector and in the whole region. */
+static uint32_t slots_per_sector;
+static uint32_t total_slots;
+
+/* Slot to be programmed next and the sequence number it gets. */
+static uint32_t write_slot;
+static uint32_t next_sequence;
+
+/* Records appended but not yet programmed, oldest at pending_head. */
+static conn_journal_record_t pending_records[CONN_JOURNAL_PENDING_COUNT];
+static uint32_t pending_head;
+static uint32_t pending_count;
+static uint32_t dropped_count;
+
+static const char* const event_names[] =
+{
+    "UNKNOWN",
+    "BOOT",
+    "WPS_START",
+    "WPS_SUCCESS",
+    "WPS_FAILED",
+    "CONNECT_RETRY",
+    "CONNECTED",
+    "CONNECT_FAILED",
+    "DISCONNECTED",
+    "RECONNECTED",
+    "IP_CHANGED",
+    "RECOVERED",
+    "WARM_RESET",
+    "RELAY_PROVISIONED",
+    "RELAY_SERVED",
+    "TRAFFIC_READY",
+    "RESUMED"
+};
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static uint16_t record_crc(const conn_journal_record_t *record);
+static bool read_slot(uint32_t slot, conn_journal_record_t *record);
+static bool is_slot_erased(uint32_t slot);
+static bool take_pending(conn_journal_record_t *record);
+static cy_rslt_t write_record(conn_journal_record_t *record);
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: conn_journal_init
+ *******************************************************************************
+ * Summary: Mounts the journal. The sector holding the newest record is found by
+ * reading the first record of each sector, and the write position inside that
+ * sector is found with a binary search for the first erased slot. Mounting
+ * therefore reads O(sectors + log(records per sector)) records. Records still
+ * pending from a previous mount are discarded.
+ *
+ * Parameters:
+ *  const conn_journal_flash_t *flash: Flash access functions of the region.
+ *  const conn_journal_port_t *port: Platform functions.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the journal was mounted.
+ *
+ ******************************************************************************/
+cy_rslt_t conn_journal_init(const conn_journal_flash_t *flash, const conn_journal_port_t *port)
+{
+    conn_journal_record_t record;
+    uint32_t head_sector = 0;
+    uint32_t head_sequence = 0;
+    bool is_empty = true;
+    uint32_t low;
+    uint32_t high;
+
+    if ((NULL == flash) || (flash->sector_count < 2u) ||
+        (flash->sector_size < CONN_JOURNAL_RECORD_SIZE) ||
+        (0u != (flash->sector_size % CONN_JOURNAL_RECORD_SIZE)))
+    {
+        return CONN_JOURNAL_RSLT_BAD_GEOMETRY;
+    }
+
+    if (NULL == port)
+    {
+        return CONN_JOURNAL_RSLT_NOT_INITIALIZED;
+    }
+
+    journal_flash = flash;
+    journal_port = port;
+    pending_head = 0;
+    pending_count = 0;
+    dropped_count = 0;
+    slots_per_sector = flash->sector_size / CONN_JOURNAL_RECORD_SIZE;
+    total_slots = slots_per_sector * flash->sector_count;
+
+    for (uint32_t sector = 0; sector < flash->sector_count; sector++)
+    {
+        if (read_slot(sector * slots_per_sector, &record) &&
+            (is_empty || (record.sequence > head_sequence)))
+        {
+            head_sector = sector;
+            head_sequence = record.sequence;
+            is_empty = false;
+        }
+    }
+
+    if (is_empty)
+    {
+        write_slot = 0;
+        next_sequence = 1;
+        return CY_RSLT_SUCCESS;
+    }
+
+    /* Slots of the head sector are programmed in order, so the programmed and
+     * erased slots form two contiguous runs.
+     */
+    low = 1;
+    high = slots_per_sector;
+    while (low < high)
+    {
+        uint32_t mid = low + ((high - low) / 2u);
+
+        if (is_slot_erased((head_sector * slots_per_sector) + mid))
+        {
+            high = mid;
+        }
+        else
+        {
+            low = mid + 1u;
+        }
+    }
+
+    write_slot = ((head_sector * slots_per_sector) + low) % total_slots;
+
+    /* Records with a bad CRC (interrupted program) keep their slot but do not
+     * advance the sequence.
+     */
+    next_sequence = head_sequence + 1u;
+    for (uint32_t slot = low; slot > 1u; slot--)
+    {
+        if (read_slot((head_sector * slots_per_sector) + slot - 1u, &record))
+        {
+            next_sequence = record.sequence + 1u;
+            break;
+        }
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/*******************************************************************************
+ * Function Name: conn_journal_append
+ *******************************************************************************
+ * Summary: Queues one record for the writer. The flash is not accessed, so the
+ * caller is never blocked by a program or a sector erase. The timestamp is
+ * taken when the record is queued.
+ *
+ * Parameters:
+ *  conn_journal_event_t event: Event to be recorded.
+ *  uint8_t detail: Event specific detail.
+ *  uint32_t value: Event specific value.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the record was queued, or
+ *  CONN_JOURNAL_RSLT_QUEUE_FULL if it was dropped.
+ *
+ ******************************************************************************/
+cy_rslt_t conn_journal_append(conn_journal_event_t event, uint8_t detail, uint32_t value)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    conn_journal_record_t record;
+
+    if (NULL == journal_flash)
+    {
+        return CONN_JOURNAL_RSLT_NOT_INITIALIZED;
+    }
+
+    memset(&record, 0, sizeof(record));
+    record.timestamp_ms = journal_port->get_time_ms();
+    record.value = value;
+    record.event = (uint8_t)event;
+    record.detail = detail;
+
+    journal_port->enter_critical();
+
+    if (pending_count < CONN_JOURNAL_PENDING_COUNT)
+    {
+        memcpy(&pending_records[(pending_head + pending_count) % CONN_JOURNAL_PENDING_COUNT],
+               &record, sizeof(record));
+        pending_count++;
+    }
+    else
+    {
+        dropped_count++;
+        result = CONN_JOURNAL_RSLT_QUEUE_FULL;
+    }
+
+    journal_port->exit_critical();
+
+    journal_port->notify_writer();
+
+    return result;
+}
+
+
+/*******************************************************************************
+ * Function Name: conn_journal_flush
+ *******************************************************************************
+ * Summary: Programs the queued records in order. Each record programs exactly
+ * one slot; a sector is erased only when the write position enters it,
+ * dropping the oldest records of the journal. Called by the writer, which may
+ * block for the duration of a sector erase.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if all the queued records were programmed,
+ *  otherwise the status of the last failed record.
+ *
+ ******************************************************************************/
+cy_rslt_t conn_journal_flush(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_rslt_t write_result;
+    conn_journal_record_t record;
+
+    if (NULL == journal_flash)
+    {
+        return CONN_JOURNAL_RSLT_NOT_INITIALIZED;
+    }
+
+    journal_port->lock();
+
+    while (take_pending(&record))
+    {
+        write_result = write_record(&record);
+        if (CY_RSLT_SUCCESS != write_result)
+        {
+            result = write_result;
+        }
+    }
+
+    journal_port->unlock();
+
+    return result;
+}
+
+
+/*******************************************************************************
+ * Function Name: conn_journal_get_dropped_count
+ *******************************************************************************
+ * Summary: Returns the number of records dropped because the queue of the
+ * writer was full.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t: Number of dropped records since the journal was mounted.
+ *
+ ******************************************************************************/
+uint32_t conn_journal_get_dropped_count(void)
+{
+    return dropped_count;
+}
+
+
+/*******************************************************************************
+ * Function Name: conn_journal_read_latest
+ *******************************************************************************
+ * Summary: Reads up to the given number of the newest records, newest first.
+ * The slot of the k-th newest record is computed directly from the write
+ * position, so only the requested records are read from flash. Records still
+ * queued for the writer are not included.
+ *
+ * Parameters:
+ *  conn_journal_record_t *records: Buffer for the records.
+ *  uint32_t count: Number of records requested.
+ *
+ * Return:
+ *  uint32_t: Number of records read.
+ *
+ ******************************************************************************/
+uint32_t conn_journal_read_latest(conn_journal_record_t *records, uint32_t count)
+{
+    uint32_t read_count = 0;
+    uint32_t slot;
+
+    if (NULL == journal_flash)
+    {
+        return 0;
+    }
+
+    journal_port->lock();
+
+    slot = write_slot;
+    for (uint32_t index = 0; (index < total_slots) && (read_count < count); index++)
+    {
+        slot = (0u == slot) ? (total_slots - 1u) : (slot - 1u);
+
+        if (is_slot_erased(slot))
+        {
+            break;
+        }
+
+        /* Skip slots left corrupted by an interrupted program. */
+        if (read_slot(slot, &records[read_count]))
+        {
+            if ((read_count > 0u) && (records[read_count].sequence >= records[read_count - 1u].sequence))
+            {
+                break;
+            }
+            read_count++;
+        }
+    }
+
+    journal_port->unlock();
+
+    return read_count;
+}
+
+
+/*******************************************************************************
+ * Function Name: conn_journal_event_name
+ *******************************************************************************
+ * Summary: Converts a journal event to a printable string.
+ *
+ * Parameters:
+ *  uint8_t event: Event stored in a record.
+ *
+ * Return:
+ *  const char*: Name of the event.
+ *
+ ******************************************************************************/
+const char* conn_journal_event_name(uint8_t event)
+{
+    if (event >= (sizeof(event_names) / sizeof(event_names[0])))
+    {
+        event = 0;
+    }
+
+    return event_names[event];
+}
+
+
+/*******************************************************************************
+ * Function Name: take_pending
+ *******************************************************************************
+ * Summary: Removes the oldest record from the queue of pending records.
+ *
+ * Parameters:
+ *  conn_journal_record_t *record: Buffer for the record.
+ *
+ * Return:
+ *  bool: true if a record was taken, false if the queue is empty.
+ *
+ ******************************************************************************/
+static bool take_pending(conn_journal_record_t *record)
+{
+    bool is_taken = false;
+
+    journal_port->enter_critical();
+
+    if (pending_count > 0u)
+    {
+        memcpy(record, &pending_records[pending_head], sizeof(conn_journal_record_t));
+        pending_head = (pending_head + 1u) % CONN_JOURNAL_PENDING_COUNT;
+        pending_count--;
+        is_taken = true;
+    }
+
+    journal_port->exit_critical();
+
+    return is_taken;
+}
+
+
+/*******************************************************************************
+ * Function Name: write_record
+ *******************************************************************************
+ * Summary: Programs a record in the next slot, erasing the sector first if the
+ * write position enters it. Must be called with the lock held. The write
+ * position only moves past a slot that is no longer erased, so that the
+ * programmed and erased slots of a sector stay contiguous for the mount:
+ *  - If the erase or the program of the first slot of a sector fails, the
+ *    position stays and the sector is erased again for the next record.
+ *  - If the program of another slot fails, the slot is marked bad by
+ *    programming it to zero, which leaves it with an invalid CRC, and skipped.
+ *    If it is still erased, it is used by the next record.
+ *
+ * Parameters:
+ *  conn_journal_record_t *record: Record; its sequence and CRC are set here.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the record was programmed.
+ *
+ ******************************************************************************/
+static cy_rslt_t write_record(conn_journal_record_t *record)
+{
+    static const uint8_t bad_slot[CONN_JOURNAL_RECORD_SIZE] = { 0 };
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    bool is_sector_start = (0u == (write_slot % slots_per_sector));
+
+    if (is_sector_start)
+    {
+        result = journal_flash->erase(write_slot * CONN_JOURNAL_RECORD_SIZE, journal_flash->sector_size);
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        record->sequence = next_sequence;
+        record->crc = record_crc(record);
+
+        result = journal_flash->program(write_slot * CONN_JOURNAL_RECORD_SIZE,
+                                        CONN_JOURNAL_RECORD_SIZE, (const uint8_t *)record);
+
+        if ((CY_RSLT_SUCCESS != result) && !is_sector_start)
+        {
+            (void)journal_flash->program(write_slot * CONN_JOURNAL_RECORD_SIZE,
+                                         CONN_JOURNAL_RECORD_SIZE, bad_slot);
+            if (!is_slot_erased(write_slot))
+            {
+                write_slot = (write_slot + 1u) % total_slots;
+            }
+        }
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        write_slot = (write_slot + 1u) % total_slots;
+        next_sequence++;
+    }
+
+    return result;
+}
+
+
+/*******************************************************************************
+ * Function Name: read_slot
+ *******************************************************************************
+ * Summary: Reads the record in a slot and validates its CRC.
+ *
+ * Parameters:
+ *  uint32_t slot: Slot index in the region.
+ *  conn_journal_record_t *record: Buffer for the record.
+ *
+ * Return:
+ *  bool: true if the slot holds a valid record.
+ *
+ ******************************************************************************/
+static bool read_slot(uint32_t slot, conn_journal_record_t *record)
+{
+    if (CY_RSLT_SUCCESS != journal_flash->read(slot * CONN_JOURNAL_RECORD_SIZE,
+                                               CONN_JOURNAL_RECORD_SIZE, (uint8_t *)record))
+    {
+        return false;
+    }
+
+    return ((CONN_JOURNAL_SEQUENCE_ERASED != record->sequence) &&
+            (record_crc(record) == record->crc));
+}
+
+
+/*******************************************************************************
+ * Function Name: is_slot_erased
+ *******************************************************************************
+ * Summary: Checks whether a slot has never been programmed since the last
+ * erase of its sector.
+ *
+ * Parameters:
+ *  uint32_t slot: Slot index in the region.
+ *
+ * Return:
+ *  bool: true if all the bytes of the slot are in the erased state.
+ *
+ ******************************************************************************/
+static bool is_slot_erased(uint32_t slot)
+{
+    uint8_t buffer[CONN_JOURNAL_RECORD_SIZE];
+
+    if (CY_RSLT_SUCCESS != journal_flash->read(slot * CONN_JOURNAL_RECORD_SIZE,
+                                               CONN_JOURNAL_RECORD_SIZE, buffer))
+    {
+        return false;
+    }
+
+    for (uint32_t index = 0; index < CONN_JOURNAL_RECORD_SIZE; index++)
+    {
+        if (0xFFu != buffer[index])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/*******************************************************************************
+ * Function Name: record_crc
+ *******************************************************************************
+ * Summary: Computes the CRC-16/CCITT of a record excluding its CRC field.
+ *
+ * Parameters:
+ *  const conn_journal_record_t *record: Record to be checked.
+ *
+ * Return:
+ *  uint16_t: CRC of the record.
+ *
+ ******************************************************************************/
+static uint16_t record_crc(const conn_journal_record_t *record)
+{
+    const uint8_t *data = (const uint8_t *)record;
+    uint16_t crc = CRC16_CCITT_INIT;
+
+    for (uint32_t index = 0; index < RECORD_CRC_LENGTH; index++)
+    {
+        crc ^= (uint16_t)(data[index] << 8);
+        for (uint32_t bit = 0; bit < 8u; bit++)
+        {
+            crc = (crc & 0x8000u) ? (uint16_t)((crc << 1) ^ CRC16_CCITT_POLYNOMIAL) : (uint16_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+
+/* [] END OF FILE */
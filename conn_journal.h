@@ -0,0 +1,167 @@
+/*******************************************************************************
+* File Name: conn_journal.h
+*
+* Description: This file includes the macros, structures, and function
+* prototypes of the connection telemetry journal used in conn_journal.c
+*
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ *  Include guard
+ ******************************************************************************/
+#ifndef SOURCE_CONN_JOURNAL_H_
+#define SOURCE_CONN_JOURNAL_H_
+
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "cy_result.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Size of one journal record in bytes. Records are programmed one at a time and
+ * never cross a flash page because the page size is a multiple of this value.
+ */
+#define CONN_JOURNAL_RECORD_SIZE            (16u)
+
+/* Sequence number of an erased (never programmed) record. */
+#define CONN_JOURNAL_SEQUENCE_ERASED        (0xFFFFFFFFu)
+
+/* Number of appended records that can wait to be programmed by the writer.
+ * Records appended while the queue is full are dropped and counted.
+ */
+#define CONN_JOURNAL_PENDING_COUNT          (16u)
+
+/* Journal result codes. */
+#define CONN_JOURNAL_RSLT_MODULE            (CY_RSLT_MODULE_MIDDLEWARE_BASE + 0xF1u)
+#define CONN_JOURNAL_RSLT_NOT_INITIALIZED   CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CONN_JOURNAL_RSLT_MODULE, 1u)
+#define CONN_JOURNAL_RSLT_BAD_GEOMETRY      CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CONN_JOURNAL_RSLT_MODULE, 2u)
+#define CONN_JOURNAL_RSLT_QUEUE_FULL        CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CONN_JOURNAL_RSLT_MODULE, 3u)
+
+
+/*******************************************************************************
+ * Enumerations
+ ******************************************************************************/
+/* Events recorded in the journal. The meaning of the detail and value fields
+ * of the record is given next to each event.
+ */
+typedef enum
+{
+    CONN_JOURNAL_EVENT_BOOT = 1,        /* value: reset reason */
+    CONN_JOURNAL_EVENT_WPS_START,       /* detail: WPS mode */
+    CONN_JOURNAL_EVENT_WPS_SUCCESS,     /* detail: credential count, value: duration in ms */
+    CONN_JOURNAL_EVENT_WPS_FAILED,      /* value: result code */
+    CONN_JOURNAL_EVENT_CONNECT_RETRY,   /* detail: attempt, value: result code */
+    CONN_JOURNAL_EVENT_CONNECTED,       /* detail: attempts, value: duration in ms */
+    CONN_JOURNAL_EVENT_CONNECT_FAILED,  /* detail: attempts, value: result code */
+    CONN_JOURNAL_EVENT_DISCONNECTED,
+    CONN_JOURNAL_EVENT_RECONNECTED,
+    CONN_JOURNAL_EVENT_IP_CHANGED,      /* detail: IP version, value: IPv4 address */
+    CONN_JOURNAL_EVENT_RECOVERED,       /* detail: recovery tier, value: time to recovery in ms */
+    CONN_JOURNAL_EVENT_WARM_RESET,      /* detail: consecutive warm resets, value: result code */
+    CONN_JOURNAL_EVENT_RELAY_PROVISIONED, /* value: time to receive the credential in ms */
+    CONN_JOURNAL_EVENT_RELAY_SERVED,    /* value: IPv4 address of the served device */
+    CONN_JOURNAL_EVENT_TRAFFIC_READY,   /* detail: completed warm-up steps, value: time to traffic-ready in ms */
+    CONN_JOURNAL_EVENT_RESUMED          /* detail: 1 if the lease was reused, value: boot to connected in ms */
+} conn_journal_event_t;
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Fixed-size binary record as stored in flash. */
+typedef struct
+{
+    uint32_t sequence;
+    uint32_t timestamp_ms;
+    uint32_t value;
+    uint8_t  event;
+    uint8_t  detail;
+    uint16_t crc;
+} conn_journal_record_t;
+
+/* Flash access functions of the journal region. The offsets are relative to
+ * the start of the region. Providing these functions over a RAM buffer allows
+ * the journal to be exercised without the serial flash.
+ */
+typedef struct
+{
+    cy_rslt_t (*read)(uint32_t offset, uint32_t length, uint8_t *buffer);
+    cy_rslt_t (*program)(uint32_t offset, uint32_t length, const uint8_t *buffer);
+    cy_rslt_t (*erase)(uint32_t offset, uint32_t length);
+    uint32_t sector_size;
+    uint32_t sector_count;
+} conn_journal_flash_t;
+
+/* Platform functions of the journal, so that it does not depend on the RTOS.
+ * lock() and unlock() serialize the flash accesses and are held for the
+ * duration of a sector erase. enter_critical() and exit_critical() protect the
+ * queue of pending records and are held only while one record is copied.
+ * notify_writer() is called after a record is queued; it must lead to a call
+ * of conn_journal_flush() from a low priority context.
+ */
+typedef struct
+{
+    uint32_t (*get_time_ms)(void);
+    void (*lock)(void);
+    void (*unlock)(void);
+    void (*enter_critical)(void);
+    void (*exit_critical)(void);
+    void (*notify_writer)(void);
+} conn_journal_port_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_rslt_t conn_journal_init(const conn_journal_flash_t *flash, const conn_journal_port_t *port);
+cy_rslt_t conn_journal_append(conn_journal_event_t event, uint8_t detail, uint32_t value);
+cy_rslt_t conn_journal_flush(void);
+uint32_t conn_journal_get_dropped_count(void);
+uint32_t conn_journal_read_latest(conn_journal_record_t *records, uint32_t count);
+const char* conn_journal_event_name(uint8_t event);
+
+#endif /*SOURCE_CONN_JOURNAL_H_*/
+
+
+/* [] END OF FILE */
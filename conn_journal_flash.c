@@ -0,0 +1,364 @@
+/*******************************************************************************
+* File Name: conn_journal_flash.c
+*
+* Description: This file contains the serial flash backend of the connection
+* journal. The journal region is placed in the last sectors of the external
+* QSPI NOR flash, away from the Wi-Fi firmware stored at the start of the flash
+* on the kits that use XIP.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include "cybsp.h"
+
+/* FreeRTOS includes */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+#include "conn_journal_flash.h"
+
+#if (CONN_JOURNAL_ENABLE)
+#include "cy_serial_flash_qspi.h"
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static cy_rslt_t qspi_read(uint32_t offset, uint32_t length, uint8_t *buffer);
+static cy_rslt_t qspi_program(uint32_t offset, uint32_t length, const uint8_t *buffer);
+static cy_rslt_t qspi_erase(uint32_t offset, uint32_t length);
+static uint32_t port_get_time_ms(void);
+static void port_lock(void);
+static void port_unlock(void);
+static void port_enter_critical(void);
+static void port_exit_critical(void);
+static void port_notify_writer(void);
+static void journal_writer_task(void *arg);
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/* Absolute address of the journal region in the serial flash. */
+static uint32_t journal_base_address;
+
+static conn_journal_flash_t journal_flash;
+
+static SemaphoreHandle_t journal_mutex;
+static TaskHandle_t writer_task_handle;
+
+static const conn_journal_port_t journal_port =
+{
+    .get_time_ms = port_get_time_ms,
+    .lock = port_lock,
+    .unlock = port_unlock,
+    .enter_critical = port_enter_critical,
+    .exit_critical = port_exit_critical,
+    .notify_writer = port_notify_writer
+};
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: conn_journal_flash_init
+ *******************************************************************************
+ * Summary: Places the journal region at the end of the serial flash, mounts
+ * the journal, and creates the writer task. The serial flash must be
+ * initialized before calling this function.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the journal was mounted.
+ *
+ ******************************************************************************/
+cy_rslt_t conn_journal_flash_init(void)
+{
+    cy_rslt_t result;
+    uint32_t flash_size = (uint32_t)cy_serial_flash_qspi_get_size();
+    uint32_t sector_size = (uint32_t)cy_serial_flash_qspi_get_erase_size(flash_size - 1u);
+
+    if ((0u == sector_size) || (flash_size < (sector_size * CONN_JOURNAL_SECTOR_COUNT)))
+    {
+        return CONN_JOURNAL_RSLT_BAD_GEOMETRY;
+    }
+
+    journal_base_address = flash_size - (sector_size * CONN_JOURNAL_SECTOR_COUNT);
+
+    journal_flash.read = qspi_read;
+    journal_flash.program = qspi_program;
+    journal_flash.erase = qspi_erase;
+    journal_flash.sector_size = sector_size;
+    journal_flash.sector_count = CONN_JOURNAL_SECTOR_COUNT;
+
+    if (NULL == journal_mutex)
+    {
+        journal_mutex = xSemaphoreCreateMutex();
+        if (NULL == journal_mutex)
+        {
+            return CONN_JOURNAL_RSLT_NOT_INITIALIZED;
+        }
+    }
+
+    result = conn_journal_init(&journal_flash, &journal_port);
+    if ((CY_RSLT_SUCCESS == result) && (NULL == writer_task_handle) &&
+        (pdPASS != xTaskCreate(journal_writer_task, "Journal writer", CONN_JOURNAL_WRITER_TASK_STACK_SIZE,
+                               NULL, CONN_JOURNAL_WRITER_TASK_PRIORITY, &writer_task_handle)))
+    {
+        result = CONN_JOURNAL_RSLT_NOT_INITIALIZED;
+    }
+
+    return result;
+}
+
+
+/*******************************************************************************
+ * Function Name: journal_writer_task
+ *******************************************************************************
+ * Summary: Programs the records queued by conn_journal_append each time it is
+ * notified.
+ *
+ * Parameters:
+ *  void *arg: Task parameter defined during task creation (unused).
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void journal_writer_task(void *arg)
+{
+    (void)arg;
+
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        conn_journal_flush();
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: qspi_read
+ *******************************************************************************
+ * Summary: Reads bytes of the journal region from the serial flash.
+ *
+ * Parameters:
+ *  uint32_t offset: Offset in the journal region.
+ *  uint32_t length: Number of bytes to be read.
+ *  uint8_t *buffer: Buffer for the bytes.
+ *
+ * Return:
+ *  cy_rslt_t: Result of the serial flash read.
+ *
+ ******************************************************************************/
+static cy_rslt_t qspi_read(uint32_t offset, uint32_t length, uint8_t *buffer)
+{
+    return cy_serial_flash_qspi_read(journal_base_address + offset, length, buffer);
+}
+
+
+/*******************************************************************************
+ * Function Name: qspi_program
+ *******************************************************************************
+ * Summary: Programs bytes of the journal region in the serial flash. A program
+ * can only clear bits.
+ *
+ * Parameters:
+ *  uint32_t offset: Offset in the journal region.
+ *  uint32_t length: Number of bytes to be programmed.
+ *  const uint8_t *buffer: Bytes to be programmed.
+ *
+ * Return:
+ *  cy_rslt_t: Result of the serial flash write.
+ *
+ ******************************************************************************/
+static cy_rslt_t qspi_program(uint32_t offset, uint32_t length, const uint8_t *buffer)
+{
+    return cy_serial_flash_qspi_write(journal_base_address + offset, length, buffer);
+}
+
+
+/*******************************************************************************
+ * Function Name: qspi_erase
+ *******************************************************************************
+ * Summary: Erases sectors of the journal region in the serial flash. Blocks for
+ * the duration of the erase.
+ *
+ * Parameters:
+ *  uint32_t offset: Offset of the first sector in the journal region.
+ *  uint32_t length: Number of bytes to be erased, a multiple of the sector
+ *  size.
+ *
+ * Return:
+ *  cy_rslt_t: Result of the serial flash erase.
+ *
+ ******************************************************************************/
+static cy_rslt_t qspi_erase(uint32_t offset, uint32_t length)
+{
+    return cy_serial_flash_qspi_erase(journal_base_address + offset, length);
+}
+
+
+/*******************************************************************************
+ * Function Name: port_get_time_ms
+ *******************************************************************************
+ * Summary: Returns the timestamp of the journal records.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t: Time since the scheduler was started in milliseconds.
+ *
+ ******************************************************************************/
+static uint32_t port_get_time_ms(void)
+{
+    return (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
+}
+
+
+/*******************************************************************************
+ * Function Name: port_lock
+ *******************************************************************************
+ * Summary: Takes the mutex that serializes the flash accesses of the journal.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void port_lock(void)
+{
+    xSemaphoreTake(journal_mutex, portMAX_DELAY);
+}
+
+
+/*******************************************************************************
+ * Function Name: port_unlock
+ *******************************************************************************
+ * Summary: Gives the mutex taken by port_lock.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void port_unlock(void)
+{
+    xSemaphoreGive(journal_mutex);
+}
+
+
+/*******************************************************************************
+ * Function Name: port_enter_critical
+ *******************************************************************************
+ * Summary: Enters the critical section that protects the queue of pending
+ * records. The queue is short, so interrupts are masked only briefly.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void port_enter_critical(void)
+{
+    taskENTER_CRITICAL();
+}
+
+
+/*******************************************************************************
+ * Function Name: port_exit_critical
+ *******************************************************************************
+ * Summary: Exits the critical section entered by port_enter_critical.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void port_exit_critical(void)
+{
+    taskEXIT_CRITICAL();
+}
+
+
+/*******************************************************************************
+ * Function Name: port_notify_writer
+ *******************************************************************************
+ * Summary: Wakes the writer task to program the queued records. Does nothing
+ * before the writer task is created.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void port_notify_writer(void)
+{
+    if (NULL != writer_task_handle)
+    {
+        xTaskNotifyGive(writer_task_handle);
+    }
+}
+
+#else
+
+cy_rslt_t conn_journal_flash_init(void)
+{
+    return CONN_JOURNAL_RSLT_NOT_INITIALIZED;
+}
+
+#endif /* CONN_JOURNAL_ENABLE */
+
+
+/* [] END OF FILE */
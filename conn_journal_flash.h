@@ -0,0 +1,101 @@
+/*******************************************************************************
+* File Name: conn_journal_flash.h
+*
+* Description: This file includes the macros and function prototypes of the
+* serial flash backend of the connection journal used in conn_journal_flash.c
+*
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ *  Include guard
+ ******************************************************************************/
+#ifndef SOURCE_CONN_JOURNAL_FLASH_H_
+#define SOURCE_CONN_JOURNAL_FLASH_H_
+
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include "cybsp.h"
+
+#include "conn_journal.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* The journal is kept in the external QSPI NOR flash of the kit. It is not
+ * enabled on the devices that execute the Wi-Fi firmware in place from the same
+ * flash (CY_DEVICE_PSOC6A512K, or any build with CY_ENABLE_XIP_PROGRAM), since
+ * programming or erasing the flash would interrupt the reads of the WHD. Set
+ * this macro to 0 to disable the journal.
+ */
+#if defined(CYBSP_QSPI_SCK) && !defined(CY_DEVICE_PSOC6A512K) && !defined(CY_ENABLE_XIP_PROGRAM)
+#define CONN_JOURNAL_ENABLE                 (1)
+#else
+#define CONN_JOURNAL_ENABLE                 (0)
+#endif
+
+/* The records are programmed by a writer task of low priority, so that the
+ * tasks appending records are not blocked by a sector erase, which takes up to
+ * a few seconds on the 256 KB sectors of the S25FL512S.
+ */
+#define CONN_JOURNAL_WRITER_TASK_STACK_SIZE (1024u)
+#define CONN_JOURNAL_WRITER_TASK_PRIORITY   (1u)
+
+/* Number of erase sectors at the end of the serial flash used by the journal.
+ * At least two sectors are required so that a full sector of history is kept
+ * while the oldest sector is being erased.
+ */
+#define CONN_JOURNAL_SECTOR_COUNT           (2u)
+
+/* Number of the newest journal records printed at startup, and the maximum
+ * number that can be printed at once.
+ */
+#define CONN_JOURNAL_BOOT_PRINT_COUNT       (8u)
+#define CONN_JOURNAL_PRINT_MAX_COUNT        (32u)
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_rslt_t conn_journal_flash_init(void);
+
+#endif /*SOURCE_CONN_JOURNAL_FLASH_H_*/
+
+
+/* [] END OF FILE */
@@ -0,0 +1,789 @@
+/*******************************************************************************
+* File Name: connection_context.c
+*
+* Description: This file contains the connection context retained across
+* resets. After every connection, the credential, the PMK derived from it, the
+* BSSID and channel of the AP and the DHCP lease are kept in RAM that is not
+* initialized at startup, protected by a CRC. After a warm reset, a watchdog
+* reset or a reset from the reset button, the application resumes the
+* connection from this context instead of waiting for WPS: the join targets
+* the cached AP with the precomputed PMK, and a recent lease is reused instead
+* of running DHCP.
+*
+* Related Document: See README.md
+*
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
+
+#include "cyhal.h"
+#include "cy_utils.h"
+
+/* FreeRTOS includes */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/* lwIP includes */
+#include "lwip/tcpip.h"
+#include "lwip/dhcp.h"
+#include "cy_network_mw_core.h"
+
+/* mbedTLS includes */
+#include "mbedtls/md.h"
+#include "mbedtls/pkcs5.h"
+
+#include "conn_journal.h"
+#include "connection_context.h"
+
+#if (CONNECTION_CONTEXT_ENABLE)
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define CONTEXT_RETAINED_MAGIC              (0x43545843uL)
+
+/* The WPA PMK is derived from the passphrase with PBKDF2-HMAC-SHA1 over the
+ * SSID. It is given to the WCM as 64 hexadecimal digits in place of the
+ * passphrase, which needs room for 64 characters. Without PBKDF2 or that
+ * room, no PMK task is created and the passphrase is retained alone.
+ */
+#if defined(MBEDTLS_PKCS5_C) && (CY_WCM_MAX_PASSPHRASE_LEN >= 64)
+#define CONTEXT_USE_PMK                     (1)
+#else
+#define CONTEXT_USE_PMK                     (0)
+#endif
+
+#define CONTEXT_PMK_SIZE                    (32u)
+#define CONTEXT_PMK_HEX_LENGTH              (2u * CONTEXT_PMK_SIZE)
+#define CONTEXT_PBKDF2_ITERATIONS           (4096u)
+#define CONTEXT_MIN_PASSPHRASE_LENGTH       (8u)
+
+#define CRC32_INIT                          (0xFFFFFFFFuL)
+#define CRC32_POLYNOMIAL                    (0xEDB88320uL)
+
+/* Channels above this one are in the 5 GHz band. */
+#define CONTEXT_MAX_2_4GHZ_CHANNEL          (14u)
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Context kept across resets. */
+typedef struct
+{
+    uint32_t                magic;
+    uint32_t                size;           /* Detects a layout change across firmware updates */
+    cy_wcm_ap_credentials_t credential;     /* As provisioned */
+    char                    pmk_hex[CONTEXT_PMK_HEX_LENGTH + 1u];  /* Empty if not derived */
+    cy_wcm_mac_t            bssid;
+    uint8_t                 channel;
+    bool                    is_lease_valid;
+    cy_wcm_ip_setting_t     lease;
+    uint32_t                lease_time;     /* RTC time in seconds when the lease was obtained */
+    uint32_t                lease_renew_sec;    /* Renewal time (T1) granted by the server */
+    uint32_t                lease_duration_sec; /* Lease time granted by the server */
+    uint32_t                crc;
+} connection_context_retained_t;
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+CY_NOINIT static connection_context_retained_t retained;
+
+static connection_context_stats_t stats;
+
+/* Protects the retained context, which the PMK task updates. */
+static SemaphoreHandle_t context_mutex = NULL;
+
+#if (CONTEXT_USE_PMK)
+static TaskHandle_t pmk_task_handle = NULL;
+#endif
+
+/* The RTC keeps running across resets, so it measures the age of the lease. */
+static cyhal_rtc_t rtc;
+static bool is_rtc_available = false;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static bool is_retained_valid(void);
+static uint32_t retained_crc(void);
+static bool read_rtc_seconds(uint32_t *seconds);
+static void store_lease(void);
+
+#if (CONTEXT_USE_PMK)
+static void pmk_task(void *arg);
+static bool derive_pmk_hex(const cy_wcm_ap_credentials_t *credential, char *pmk_hex);
+#endif
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: connection_context_init
+ *******************************************************************************
+ * Summary: Validates the context retained across resets and creates the task
+ * that derives the PMK. The context is cleared on power up, when the RAM
+ * content is random. The task is not created when the PMK cannot be used,
+ * because mbedTLS lacks PBKDF2 or the WCM passphrase cannot hold a PMK; the
+ * connection is then resumed with the passphrase.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS, or CONNECTION_CONTEXT_RSLT_NO_MEMORY if the mutex
+ *  or the task could not be created.
+ *
+ ******************************************************************************/
+cy_rslt_t connection_context_init(void)
+{
+    memset(&stats, 0, sizeof(stats));
+
+    if (!is_retained_valid())
+    {
+        memset(&retained, 0, sizeof(retained));
+    }
+
+    is_rtc_available = (CY_RSLT_SUCCESS == cyhal_rtc_init(&rtc));
+
+    context_mutex = xSemaphoreCreateMutex();
+    if (NULL == context_mutex)
+    {
+        return CONNECTION_CONTEXT_RSLT_NO_MEMORY;
+    }
+
+    #if (CONTEXT_USE_PMK)
+    if (pdPASS != xTaskCreate(pmk_task, "Context PMK", CONNECTION_CONTEXT_TASK_STACK_SIZE,
+                              NULL, CONNECTION_CONTEXT_TASK_PRIORITY, &pmk_task_handle))
+    {
+        return CONNECTION_CONTEXT_RSLT_NO_MEMORY;
+    }
+    #endif
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/*******************************************************************************
+ * Function Name: connection_context_save
+ *******************************************************************************
+ * Summary: Stores the context of the connection just made. The PMK is not
+ * derived here: the PMK task is notified when the context has none yet, and
+ * a PMK already derived is kept while the credential does not change. The
+ * lease is stored only when it was obtained through DHCP, so that a reused
+ * lease keeps its original age.
+ *
+ * Parameters:
+ *  const cy_wcm_connect_params_t *connect_param: Parameters of the connection.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void connection_context_save(const cy_wcm_connect_params_t *connect_param)
+{
+    cy_wcm_associated_ap_info_t ap_info;
+    const char *password = (const char *)connect_param->ap_credentials.password;
+    bool is_same_credential;
+    bool is_pmk_needed;
+
+    xSemaphoreTake(context_mutex, portMAX_DELAY);
+
+    /* The password is the PMK itself when the connection was resumed. */
+    is_same_credential = is_retained_valid() &&
+                         (0 == strcmp((const char *)connect_param->ap_credentials.SSID,
+                                      (const char *)retained.credential.SSID)) &&
+                         (connect_param->ap_credentials.security == retained.credential.security) &&
+                         ((0 == strcmp(password, (const char *)retained.credential.password)) ||
+                          (0 == strcmp(password, retained.pmk_hex)));
+
+    if (!is_same_credential)
+    {
+        memset(&retained, 0, sizeof(retained));
+        memcpy(&retained.credential, &connect_param->ap_credentials, sizeof(cy_wcm_ap_credentials_t));
+    }
+
+    if (CY_RSLT_SUCCESS == cy_wcm_get_associated_ap_info(&ap_info))
+    {
+        memcpy(retained.bssid, ap_info.BSSID, sizeof(cy_wcm_mac_t));
+        retained.channel = ap_info.channel;
+    }
+
+    if (NULL == connect_param->static_ip_settings)
+    {
+        store_lease();
+    }
+
+    retained.magic = CONTEXT_RETAINED_MAGIC;
+    retained.size = sizeof(retained);
+    retained.crc = retained_crc();
+    is_pmk_needed = ('\0' == retained.pmk_hex[0]);
+
+    xSemaphoreGive(context_mutex);
+
+    #if (CONTEXT_USE_PMK)
+    if (is_pmk_needed)
+    {
+        xTaskNotifyGive(pmk_task_handle);
+    }
+    #else
+    (void)is_pmk_needed;
+    #endif
+}
+
+
+/*******************************************************************************
+ * Function Name: connection_context_load
+ *******************************************************************************
+ * Summary: Builds the connection parameters for resuming the retained
+ * connection. The lease is reused only before the renewal time granted by the
+ * DHCP server (see connection_context_lease_reuse_sec()); otherwise
+ * static_ip_settings is NULL and the connection runs DHCP.
+ *
+ * Parameters:
+ *  cy_wcm_connect_params_t *connect_param: Filled with the parameters.
+ *  cy_wcm_ip_setting_t *lease: Filled with the reused lease. Must remain
+ *  valid while connect_param is used.
+ *  uint32_t *lease_remaining_ms: Time left before the reused lease must be
+ *  renewed, or 0 if the lease is not reused.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS, or CONNECTION_CONTEXT_RSLT_NOT_AVAILABLE if no
+ *  context was retained.
+ *
+ ******************************************************************************/
+cy_rslt_t connection_context_load(cy_wcm_connect_params_t *connect_param, cy_wcm_ip_setting_t *lease,
+                                  uint32_t *lease_remaining_ms)
+{
+    uint32_t now;
+    uint32_t reuse_sec;
+
+    *lease_remaining_ms = 0;
+
+    xSemaphoreTake(context_mutex, portMAX_DELAY);
+
+    if (!is_retained_valid())
+    {
+        xSemaphoreGive(context_mutex);
+        return CONNECTION_CONTEXT_RSLT_NOT_AVAILABLE;
+    }
+
+    memset(connect_param, 0, sizeof(cy_wcm_connect_params_t));
+    memcpy(&connect_param->ap_credentials, &retained.credential, sizeof(cy_wcm_ap_credentials_t));
+
+    if ('\0' != retained.pmk_hex[0])
+    {
+        memset(connect_param->ap_credentials.password, 0, sizeof(connect_param->ap_credentials.password));
+        memcpy(connect_param->ap_credentials.password, retained.pmk_hex, CONTEXT_PMK_HEX_LENGTH);
+    }
+
+    memcpy(connect_param->BSSID, retained.bssid, sizeof(cy_wcm_mac_t));
+    if (0u == retained.channel)
+    {
+        connect_param->band = CY_WCM_WIFI_BAND_ANY;
+    }
+    else
+    {
+        connect_param->band = (retained.channel > CONTEXT_MAX_2_4GHZ_CHANNEL) ?
+                              CY_WCM_WIFI_BAND_5GHZ : CY_WCM_WIFI_BAND_2_4GHZ;
+    }
+
+    if (retained.is_lease_valid && read_rtc_seconds(&now))
+    {
+        reuse_sec = connection_context_lease_reuse_sec(now, retained.lease_time, retained.lease_renew_sec,
+                                                       retained.lease_duration_sec);
+        if (0u != reuse_sec)
+        {
+            memcpy(lease, &retained.lease, sizeof(cy_wcm_ip_setting_t));
+            connect_param->static_ip_settings = lease;
+            *lease_remaining_ms = reuse_sec * 1000u;
+        }
+    }
+
+    xSemaphoreGive(context_mutex);
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/*******************************************************************************
+ * Function Name: connection_context_clear
+ *******************************************************************************
+ * Summary: Discards the retained context, for example when resuming from it
+ * failed.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void connection_context_clear(void)
+{
+    xSemaphoreTake(context_mutex, portMAX_DELAY);
+    memset(&retained, 0, sizeof(retained));
+    xSemaphoreGive(context_mutex);
+}
+
+
+/*******************************************************************************
+ * Function Name: connection_context_renew_lease
+ *******************************************************************************
+ * Summary: Obtains a DHCP lease in place of the reused one while the device
+ * stays associated. The reused lease was configured as a static address, so
+ * no DHCP client runs on the STA interface; DHCP is started on it as for a
+ * new connection. The address stays configured until the server grants the
+ * lease, and the server normally grants the address it has bound to the
+ * device. If it grants another one, the new address is reported by
+ * CY_WCM_EVENT_IP_CHANGED. lwIP then renews the lease itself, and the lease
+ * obtained is stored with its time, so that it can be reused after the next
+ * reset.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if a lease was obtained,
+ *  CONNECTION_CONTEXT_RSLT_NOT_AVAILABLE if DHCP could not be started, or
+ *  CONNECTION_CONTEXT_RSLT_TIMEOUT if the server did not answer within
+ *  CONNECTION_CONTEXT_RENEW_TIMEOUT_MSEC.
+ *
+ ******************************************************************************/
+cy_rslt_t connection_context_renew_lease(void)
+{
+    struct netif *netif;
+    uint32_t waited_ms = 0;
+    bool is_started;
+    bool is_bound = false;
+
+    LOCK_TCPIP_CORE();
+    netif = (struct netif *)cy_network_get_nw_interface(CY_NETWORK_WIFI_STA_INTERFACE, 0u);
+    is_started = (NULL != netif) && (ERR_OK == dhcp_start(netif));
+    UNLOCK_TCPIP_CORE();
+
+    if (!is_started)
+    {
+        return CONNECTION_CONTEXT_RSLT_NOT_AVAILABLE;
+    }
+
+    while (!is_bound && (waited_ms < CONNECTION_CONTEXT_RENEW_TIMEOUT_MSEC))
+    {
+        vTaskDelay(pdMS_TO_TICKS(CONNECTION_CONTEXT_RENEW_POLL_MSEC));
+        waited_ms += CONNECTION_CONTEXT_RENEW_POLL_MSEC;
+
+        LOCK_TCPIP_CORE();
+        is_bound = (0u != dhcp_supplied_address(netif));
+        UNLOCK_TCPIP_CORE();
+    }
+
+    if (!is_bound)
+    {
+        return CONNECTION_CONTEXT_RSLT_TIMEOUT;
+    }
+
+    xSemaphoreTake(context_mutex, portMAX_DELAY);
+    if (is_retained_valid())
+    {
+        store_lease();
+        retained.crc = retained_crc();
+    }
+    xSemaphoreGive(context_mutex);
+
+    taskENTER_CRITICAL();
+    stats.lease_renewals++;
+    taskEXIT_CRITICAL();
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/*******************************************************************************
+ * Function Name: connection_context_record_resume
+ *******************************************************************************
+ * Summary: Records the outcome of resuming the retained connection in the
+ * statistics and in the connection journal.
+ *
+ * Parameters:
+ *  bool is_success: true if the device connected.
+ *  bool is_lease_reused: true if the retained lease was used instead of DHCP.
+ *  uint32_t connect_time_ms: Time taken by the connection.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void connection_context_record_resume(bool is_success, bool is_lease_reused, uint32_t connect_time_ms)
+{
+    if (!is_success)
+    {
+        stats.resume_failures++;
+        return;
+    }
+
+    stats.resumes++;
+    if (is_lease_reused)
+    {
+        stats.lease_reuses++;
+    }
+    stats.last_boot_to_connected_ms = xTaskGetTickCount() * portTICK_PERIOD_MS;
+    stats.last_resume_connect_ms = connect_time_ms;
+
+    conn_journal_append(CONN_JOURNAL_EVENT_RESUMED, is_lease_reused ? 1u : 0u, stats.last_boot_to_connected_ms);
+}
+
+
+/*******************************************************************************
+ * Function Name: connection_context_get_stats
+ *******************************************************************************
+ * Summary: Copies the resume statistics.
+ *
+ * Parameters:
+ *  connection_context_stats_t *stats_copy: Filled with the statistics.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void connection_context_get_stats(connection_context_stats_t *stats_copy)
+{
+    taskENTER_CRITICAL();
+    memcpy(stats_copy, &stats, sizeof(connection_context_stats_t));
+    taskEXIT_CRITICAL();
+}
+
+
+/*******************************************************************************
+ * Function Name: is_retained_valid
+ *******************************************************************************
+ * Summary: Checks the integrity of the retained context.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  bool: true if a context is retained and intact.
+ *
+ ******************************************************************************/
+static bool is_retained_valid(void)
+{
+    return (CONTEXT_RETAINED_MAGIC == retained.magic) && (sizeof(retained) == retained.size) &&
+           (retained_crc() == retained.crc);
+}
+
+
+/*******************************************************************************
+ * Function Name: retained_crc
+ *******************************************************************************
+ * Summary: Computes the CRC-32 of the retained context.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t: CRC of all the fields before the CRC itself.
+ *
+ ******************************************************************************/
+static uint32_t retained_crc(void)
+{
+    const uint8_t *data = (const uint8_t *)&retained;
+    uint32_t crc = CRC32_INIT;
+
+    for (uint32_t index = 0; index < offsetof(connection_context_retained_t, crc); index++)
+    {
+        crc ^= data[index];
+        for (uint32_t bit = 0; bit < 8u; bit++)
+        {
+            crc = (crc & 1u) ? ((crc >> 1) ^ CRC32_POLYNOMIAL) : (crc >> 1);
+        }
+    }
+
+    return ~crc;
+}
+
+
+/*******************************************************************************
+ * Function Name: read_rtc_seconds
+ *******************************************************************************
+ * Summary: Reads the RTC as a number of seconds.
+ *
+ * Parameters:
+ *  uint32_t *seconds: Set to the RTC time in seconds.
+ *
+ * Return:
+ *  bool: true if the RTC could be read.
+ *
+ ******************************************************************************/
+static bool read_rtc_seconds(uint32_t *seconds)
+{
+    struct tm date_time;
+    time_t time_seconds;
+
+    if (!is_rtc_available || (CY_RSLT_SUCCESS != cyhal_rtc_read(&rtc, &date_time)))
+    {
+        return false;
+    }
+
+    time_seconds = mktime(&date_time);
+    if ((time_t)-1 == time_seconds)
+    {
+        return false;
+    }
+
+    *seconds = (uint32_t)time_seconds;
+    return true;
+}
+
+
+/*******************************************************************************
+ * Function Name: store_lease
+ *******************************************************************************
+ * Summary: Stores the IP settings of the STA interface as the retained lease,
+ * obtained now, with the renewal and lease times granted by the DHCP server.
+ * No lease is retained if the address was not supplied by DHCP. The caller
+ * holds the context mutex and updates the CRC.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void store_lease(void)
+{
+    struct netif *netif;
+    struct dhcp *dhcp;
+    bool is_bound = false;
+
+    LOCK_TCPIP_CORE();
+    netif = (struct netif *)cy_network_get_nw_interface(CY_NETWORK_WIFI_STA_INTERFACE, 0u);
+    dhcp = (NULL != netif) ? netif_dhcp_data(netif) : NULL;
+    if ((NULL != dhcp) && (0u != dhcp_supplied_address(netif)))
+    {
+        retained.lease_renew_sec = dhcp->offered_t1_renew;
+        retained.lease_duration_sec = dhcp->offered_t0_lease;
+        is_bound = true;
+    }
+    UNLOCK_TCPIP_CORE();
+
+    retained.is_lease_valid =
+        is_bound &&
+        (CY_RSLT_SUCCESS == cy_wcm_get_ip_addr(CY_WCM_INTERFACE_TYPE_STA, &retained.lease.ip_address)) &&
+        (CY_RSLT_SUCCESS == cy_wcm_get_gateway_ip_address(CY_WCM_INTERFACE_TYPE_STA, &retained.lease.gateway)) &&
+        (CY_RSLT_SUCCESS == cy_wcm_get_ip_netmask(CY_WCM_INTERFACE_TYPE_STA, &retained.lease.netmask)) &&
+        (CY_WCM_IP_VER_V4 == retained.lease.ip_address.version) &&
+        read_rtc_seconds(&retained.lease_time);
+}
+
+
+#if (CONTEXT_USE_PMK)
+/*******************************************************************************
+ * Function Name: pmk_task
+ *******************************************************************************
+ * Summary: Derives the PMK of the retained credential each time it is
+ * notified. The derivation runs without the mutex held; its result is
+ * dropped if the credential was replaced meanwhile, in which case the task
+ * has been notified again.
+ *
+ * Parameters:
+ *  void *arg: Task parameter defined during task creation (unused).
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void pmk_task(void *arg)
+{
+    cy_wcm_ap_credentials_t credential;
+    char pmk_hex[CONTEXT_PMK_HEX_LENGTH + 1u];
+    bool is_pmk_needed;
+
+    (void)arg;
+
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        xSemaphoreTake(context_mutex, portMAX_DELAY);
+        is_pmk_needed = is_retained_valid() && ('\0' == retained.pmk_hex[0]);
+        memcpy(&credential, &retained.credential, sizeof(credential));
+        xSemaphoreGive(context_mutex);
+
+        if (is_pmk_needed && derive_pmk_hex(&credential, pmk_hex))
+        {
+            xSemaphoreTake(context_mutex, portMAX_DELAY);
+            if (is_retained_valid() && (0 == memcmp(&credential, &retained.credential, sizeof(credential))))
+            {
+                memcpy(retained.pmk_hex, pmk_hex, sizeof(retained.pmk_hex));
+                retained.crc = retained_crc();
+            }
+            xSemaphoreGive(context_mutex);
+        }
+
+        memset(&credential, 0, sizeof(credential));
+        memset(pmk_hex, 0, sizeof(pmk_hex));
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: derive_pmk_hex
+ *******************************************************************************
+ * Summary: Derives the PMK of a WPA/WPA2 personal credential, so that the join
+ * after a reset does not have to derive it again from the passphrase.
+ *
+ * Parameters:
+ *  const cy_wcm_ap_credentials_t *credential: Credential of the network.
+ *  char *pmk_hex: Set to the PMK as a string of hexadecimal digits.
+ *
+ * Return:
+ *  bool: true if the PMK was derived; false for the other security types,
+ *  when the passphrase is already a PMK, or on error.
+ *
+ ******************************************************************************/
+static bool derive_pmk_hex(const cy_wcm_ap_credentials_t *credential, char *pmk_hex)
+{
+    static const char hex_digits[] = "0123456789abcdef";
+    mbedtls_md_context_t md_context;
+    uint8_t pmk[CONTEXT_PMK_SIZE];
+    size_t passphrase_length = strlen((const char *)credential->password);
+    int crypto_result;
+
+    switch (credential->security)
+    {
+        case CY_WCM_SECURITY_WPA_TKIP_PSK:
+        case CY_WCM_SECURITY_WPA_AES_PSK:
+        case CY_WCM_SECURITY_WPA_MIXED_PSK:
+        case CY_WCM_SECURITY_WPA2_AES_PSK:
+        case CY_WCM_SECURITY_WPA2_TKIP_PSK:
+        case CY_WCM_SECURITY_WPA2_MIXED_PSK:
+            break;
+
+        /* WPA3-SAE does not use a PMK derived from the passphrase. */
+        default:
+            return false;
+    }
+
+    if ((passphrase_length < CONTEXT_MIN_PASSPHRASE_LENGTH) || (passphrase_length >= CONTEXT_PMK_HEX_LENGTH))
+    {
+        return false;
+    }
+
+    mbedtls_md_init(&md_context);
+    crypto_result = mbedtls_md_setup(&md_context, mbedtls_md_info_from_type(MBEDTLS_MD_SHA1), 1);
+    if (0 == crypto_result)
+    {
+        crypto_result = mbedtls_pkcs5_pbkdf2_hmac(&md_context, credential->password, passphrase_length,
+                                                  credential->SSID, strlen((const char *)credential->SSID),
+                                                  CONTEXT_PBKDF2_ITERATIONS, CONTEXT_PMK_SIZE, pmk);
+    }
+    mbedtls_md_free(&md_context);
+
+    if (0 != crypto_result)
+    {
+        return false;
+    }
+
+    for (uint32_t index = 0; index < CONTEXT_PMK_SIZE; index++)
+    {
+        pmk_hex[2u * index] = hex_digits[pmk[index] >> 4];
+        pmk_hex[(2u * index) + 1u] = hex_digits[pmk[index] & 0x0Fu];
+    }
+    pmk_hex[CONTEXT_PMK_HEX_LENGTH] = '\0';
+    memset(pmk, 0, sizeof(pmk));
+
+    return true;
+}
+#endif /* CONTEXT_USE_PMK */
+
+#else
+
+cy_rslt_t connection_context_init(void)
+{
+    return CY_RSLT_SUCCESS;
+}
+
+void connection_context_save(const cy_wcm_connect_params_t *connect_param)
+{
+    (void)connect_param;
+}
+
+cy_rslt_t connection_context_load(cy_wcm_connect_params_t *connect_param, cy_wcm_ip_setting_t *lease,
+                                  uint32_t *lease_remaining_ms)
+{
+    (void)connect_param;
+    (void)lease;
+    *lease_remaining_ms = 0;
+    return CONNECTION_CONTEXT_RSLT_NOT_AVAILABLE;
+}
+
+void connection_context_clear(void)
+{
+}
+
+cy_rslt_t connection_context_renew_lease(void)
+{
+    return CONNECTION_CONTEXT_RSLT_NOT_AVAILABLE;
+}
+
+void connection_context_record_resume(bool is_success, bool is_lease_reused, uint32_t connect_time_ms)
+{
+    (void)is_success;
+    (void)is_lease_reused;
+    (void)connect_time_ms;
+}
+
+void connection_context_get_stats(connection_context_stats_t *stats_copy)
+{
+    memset(stats_copy, 0, sizeof(connection_context_stats_t));
+}
+
+#endif /* CONNECTION_CONTEXT_ENABLE */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,137 @@
+/*******************************************************************************
+* File Name: connection_context.h
+*
+* Description: This file includes the macros, structures, and function
+* prototypes of the connection context retained across resets used in
+* connection_context.c
+*
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ *  Include guard
+ ******************************************************************************/
+#ifndef SOURCE_CONNECTION_CONTEXT_H_
+#define SOURCE_CONNECTION_CONTEXT_H_
+
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+/* Wi-Fi Connection Manager includes */
+#include "cy_wcm.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Set this macro to 0 to provision or connect from scratch after every
+ * reset.
+ */
+#define CONNECTION_CONTEXT_ENABLE           (1)
+
+/* A retained DHCP lease is reused on resume until the renewal time (T1)
+ * granted by the DHCP server, and for at most this number of seconds after it
+ * was obtained for servers that grant very long or infinite leases. When that
+ * time is reached, DHCP is started on the STA interface without leaving the
+ * AP.
+ */
+#define CONNECTION_CONTEXT_MAX_LEASE_REUSE_SEC (86400u)
+
+/* Time in milliseconds to wait for the DHCP server to grant a lease, and
+ * the interval at which the DHCP state is checked meanwhile. DHCP goes on in
+ * the background after the timeout.
+ */
+#define CONNECTION_CONTEXT_RENEW_TIMEOUT_MSEC (10000u)
+#define CONNECTION_CONTEXT_RENEW_POLL_MSEC  (100u)
+
+/* The PMK is derived by a task of low priority after the connection, so that
+ * the 4096 iterations of PBKDF2 do not delay the connection or the tasks
+ * that run after it. A reset before it completes resumes with the
+ * passphrase.
+ */
+#define CONNECTION_CONTEXT_TASK_STACK_SIZE  (2048u)
+#define CONNECTION_CONTEXT_TASK_PRIORITY    (1u)
+
+/* Connection context result codes. */
+#define CONNECTION_CONTEXT_RSLT_MODULE      (CY_RSLT_MODULE_MIDDLEWARE_BASE + 0xF9u)
+#define CONNECTION_CONTEXT_RSLT_NOT_AVAILABLE CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CONNECTION_CONTEXT_RSLT_MODULE, 1u)
+#define CONNECTION_CONTEXT_RSLT_NO_MEMORY   CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CONNECTION_CONTEXT_RSLT_MODULE, 2u)
+#define CONNECTION_CONTEXT_RSLT_TIMEOUT     CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CONNECTION_CONTEXT_RSLT_MODULE, 3u)
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Resume statistics since startup. The latencies are those of the last
+ * successful resume.
+ */
+typedef struct
+{
+    uint32_t resumes;
+    uint32_t resume_failures;
+    uint32_t lease_reuses;
+    uint32_t lease_renewals;                /* Reused leases replaced by a DHCP lease */
+    uint32_t last_boot_to_connected_ms;     /* From the scheduler start */
+    uint32_t last_resume_connect_ms;        /* Association and IP configuration only */
+} connection_context_stats_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_rslt_t connection_context_init(void);
+void connection_context_save(const cy_wcm_connect_params_t *connect_param);
+cy_rslt_t connection_context_load(cy_wcm_connect_params_t *connect_param, cy_wcm_ip_setting_t *lease,
+                                  uint32_t *lease_remaining_ms);
+void connection_context_clear(void);
+cy_rslt_t connection_context_renew_lease(void);
+void connection_context_record_resume(bool is_success, bool is_lease_reused, uint32_t connect_time_ms);
+void connection_context_get_stats(connection_context_stats_t *stats_copy);
+
+/* Lease reuse decision, in connection_context_lease.c. It uses no RTOS or
+ * Wi-Fi services so that it can be tested on the host.
+ */
+uint32_t connection_context_lease_reuse_sec(uint32_t now, uint32_t obtained, uint32_t renew_sec,
+                                            uint32_t lease_sec);
+
+#endif /*SOURCE_CONNECTION_CONTEXT_H_*/
+
+
+/* [] END OF FILE */
@@ -0,0 +1,100 @@
+/*******************************************************************************
+* File Name: connection_context_lease.c
+*
+* Description: This file contains the decision to reuse the DHCP lease retained
+* across a reset. It uses no RTOS or Wi-Fi services so that it can be tested
+* on the host.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include "connection_context.h"
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: connection_context_lease_reuse_sec
+ *******************************************************************************
+ * Summary: Computes how long a retained lease can still be used without
+ * contacting the DHCP server. The lease is used until the renewal time (T1)
+ * granted by the server, or until the end of the lease if the server granted
+ * a shorter lease than T1, and at most until
+ * CONNECTION_CONTEXT_MAX_LEASE_REUSE_SEC after it was obtained.
+ *
+ * Parameters:
+ *  uint32_t now: RTC time in seconds.
+ *  uint32_t obtained: RTC time in seconds when the lease was obtained.
+ *  uint32_t renew_sec: Renewal time (T1) granted by the server.
+ *  uint32_t lease_sec: Lease time granted by the server.
+ *
+ * Return:
+ *  uint32_t: Seconds left before DHCP must run, or 0 if the lease must not be
+ *  reused, including when the RTC is earlier than the time the lease was
+ *  obtained.
+ *
+ ******************************************************************************/
+uint32_t connection_context_lease_reuse_sec(uint32_t now, uint32_t obtained, uint32_t renew_sec,
+                                            uint32_t lease_sec)
+{
+    uint32_t limit = (renew_sec < lease_sec) ? renew_sec : lease_sec;
+    uint32_t age;
+
+    if (limit > CONNECTION_CONTEXT_MAX_LEASE_REUSE_SEC)
+    {
+        limit = CONNECTION_CONTEXT_MAX_LEASE_REUSE_SEC;
+    }
+
+    if (now < obtained)
+    {
+        return 0u;
+    }
+
+    age = now - obtained;
+    if (age >= limit)
+    {
+        return 0u;
+    }
+
+    return limit - age;
+}
+
+
+/* [] END OF FILE */
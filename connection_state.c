@@ -0,0 +1,279 @@
+/*******************************************************************************
+* File Name: connection_state.c
+*
+* Description: This file contains the connection state shared by the tasks of
+* the application. The state, its generation counter and the time of the last
+* change are updated together in a critical section, so a reader always gets a
+* consistent snapshot. The current state is also mirrored in an event group, so
+* a task can sleep until a state is reached instead of polling.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+/* FreeRTOS includes */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "event_groups.h"
+
+#include "connection_state.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Event group bit of a state. */
+#define CONNECTION_STATE_BIT(state)         ((EventBits_t)1u << (uint32_t)(state))
+#define CONNECTION_STATE_ALL_BITS           (CONNECTION_STATE_BIT(CONNECTION_STATE_COUNT) - 1u)
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static connection_state_snapshot_t current;
+
+/* Exactly one bit, the one of the current state, is set. */
+static EventGroupHandle_t state_event_group = NULL;
+
+/* Serializes the writers so that the event group follows the order of the
+ * state changes.
+ */
+static SemaphoreHandle_t writer_mutex = NULL;
+
+static const char* const state_names[CONNECTION_STATE_COUNT] =
+{
+    "DISCONNECTED",
+    "PROVISIONING",
+    "CONNECTING",
+    "CONNECTED"
+};
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: connection_state_init
+ *******************************************************************************
+ * Summary: Creates the event group and the writer mutex, and sets the state
+ * to CONNECTION_STATE_DISCONNECTED.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS on success, CONNECTION_STATE_RSLT_NO_MEMORY if
+ *  the event group or the mutex could not be created.
+ *
+ ******************************************************************************/
+cy_rslt_t connection_state_init(void)
+{
+    state_event_group = xEventGroupCreate();
+    writer_mutex = xSemaphoreCreateMutex();
+
+    if ((NULL == state_event_group) || (NULL == writer_mutex))
+    {
+        return CONNECTION_STATE_RSLT_NO_MEMORY;
+    }
+
+    current.state = CONNECTION_STATE_DISCONNECTED;
+    current.generation = 0;
+    current.timestamp = xTaskGetTickCount();
+    xEventGroupSetBits(state_event_group, CONNECTION_STATE_BIT(CONNECTION_STATE_DISCONNECTED));
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/*******************************************************************************
+ * Function Name: connection_state_set
+ *******************************************************************************
+ * Summary: Changes the state and wakes up the tasks waiting for it. Setting the
+ * current state again has no effect.
+ *
+ * Parameters:
+ *  connection_state_t state: New state.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void connection_state_set(connection_state_t state)
+{
+    bool is_changed = false;
+
+    if ((NULL == writer_mutex) || (state >= CONNECTION_STATE_COUNT))
+    {
+        return;
+    }
+
+    xSemaphoreTake(writer_mutex, portMAX_DELAY);
+
+    taskENTER_CRITICAL();
+    if (current.state != state)
+    {
+        current.state = state;
+        current.generation++;
+        current.timestamp = xTaskGetTickCount();
+        is_changed = true;
+    }
+    taskEXIT_CRITICAL();
+
+    if (is_changed)
+    {
+        xEventGroupClearBits(state_event_group, CONNECTION_STATE_ALL_BITS & ~CONNECTION_STATE_BIT(state));
+        xEventGroupSetBits(state_event_group, CONNECTION_STATE_BIT(state));
+    }
+
+    xSemaphoreGive(writer_mutex);
+}
+
+
+/*******************************************************************************
+ * Function Name: connection_state_get
+ *******************************************************************************
+ * Summary: Returns the current state.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  connection_state_t: Current state.
+ *
+ ******************************************************************************/
+connection_state_t connection_state_get(void)
+{
+    connection_state_t state;
+
+    taskENTER_CRITICAL();
+    state = current.state;
+    taskEXIT_CRITICAL();
+
+    return state;
+}
+
+
+/*******************************************************************************
+ * Function Name: connection_state_get_snapshot
+ *******************************************************************************
+ * Summary: Copies the state, its generation, and the time of the last change.
+ *
+ * Parameters:
+ *  connection_state_snapshot_t *snapshot: Filled with the current values.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void connection_state_get_snapshot(connection_state_snapshot_t *snapshot)
+{
+    taskENTER_CRITICAL();
+    *snapshot = current;
+    taskEXIT_CRITICAL();
+}
+
+
+/*******************************************************************************
+ * Function Name: connection_state_is_connected
+ *******************************************************************************
+ * Summary: Checks whether the device is connected to the AP.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  bool: true in CONNECTION_STATE_CONNECTED.
+ *
+ ******************************************************************************/
+bool connection_state_is_connected(void)
+{
+    return (CONNECTION_STATE_CONNECTED == connection_state_get());
+}
+
+
+/*******************************************************************************
+ * Function Name: connection_state_wait_for_state
+ *******************************************************************************
+ * Summary: Blocks the calling task until the given state is reached. Returns
+ * immediately if it is the current state.
+ *
+ * Parameters:
+ *  connection_state_t state: State to wait for.
+ *  uint32_t timeout_ms: Maximum time to wait, or CONNECTION_STATE_WAIT_FOREVER.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the state was reached,
+ *  CONNECTION_STATE_RSLT_TIMEOUT otherwise.
+ *
+ ******************************************************************************/
+cy_rslt_t connection_state_wait_for_state(connection_state_t state, uint32_t timeout_ms)
+{
+    EventBits_t bits;
+    TickType_t ticks = (CONNECTION_STATE_WAIT_FOREVER == timeout_ms) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+
+    if ((NULL == state_event_group) || (state >= CONNECTION_STATE_COUNT))
+    {
+        return CONNECTION_STATE_RSLT_TIMEOUT;
+    }
+
+    bits = xEventGroupWaitBits(state_event_group, CONNECTION_STATE_BIT(state), pdFALSE, pdTRUE, ticks);
+
+    return (0u != (bits & CONNECTION_STATE_BIT(state))) ? CY_RSLT_SUCCESS : CONNECTION_STATE_RSLT_TIMEOUT;
+}
+
+
+/*******************************************************************************
+ * Function Name: connection_state_name
+ *******************************************************************************
+ * Summary: Returns the printable name of a state.
+ *
+ * Parameters:
+ *  connection_state_t state: State.
+ *
+ * Return:
+ *  const char*: Name of the state.
+ *
+ ******************************************************************************/
+const char* connection_state_name(connection_state_t state)
+{
+    return (state < CONNECTION_STATE_COUNT) ? state_names[state] : "UNKNOWN";
+}
+
+
+/* [] END OF FILE */
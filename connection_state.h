@@ -0,0 +1,116 @@
+/*******************************************************************************
+* File Name: connection_state.h
+*
+* Description: This file includes the macros, structures, and function
+* prototypes of the connection state used in connection_state.c
+*
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ *  Include guard
+ ******************************************************************************/
+#ifndef SOURCE_CONNECTION_STATE_H_
+#define SOURCE_CONNECTION_STATE_H_
+
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+/* FreeRTOS includes */
+#include "FreeRTOS.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "cy_result.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Timeout value that waits for the state without a time limit. */
+#define CONNECTION_STATE_WAIT_FOREVER       (0xFFFFFFFFu)
+
+/* Connection state result codes. */
+#define CONNECTION_STATE_RSLT_MODULE        (CY_RSLT_MODULE_MIDDLEWARE_BASE + 0xF5u)
+#define CONNECTION_STATE_RSLT_NO_MEMORY     CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CONNECTION_STATE_RSLT_MODULE, 1u)
+#define CONNECTION_STATE_RSLT_TIMEOUT       CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CONNECTION_STATE_RSLT_MODULE, 2u)
+
+
+/*******************************************************************************
+ * Enumerations
+ ******************************************************************************/
+typedef enum
+{
+    CONNECTION_STATE_DISCONNECTED = 0,  /* Not connected to the AP */
+    CONNECTION_STATE_PROVISIONING,      /* Obtaining the credential through a relay or WPS */
+    CONNECTION_STATE_CONNECTING,        /* Joining the AP */
+    CONNECTION_STATE_CONNECTED,         /* Connected to the AP */
+    CONNECTION_STATE_COUNT
+} connection_state_t;
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Consistent copy of the connection state. The generation is incremented on
+ * every state change, so a reader can detect a change that happened between
+ * two snapshots even if the state is the same again.
+ */
+typedef struct
+{
+    connection_state_t state;
+    uint32_t           generation;
+    TickType_t         timestamp;
+} connection_state_snapshot_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_rslt_t connection_state_init(void);
+void connection_state_set(connection_state_t state);
+connection_state_t connection_state_get(void);
+void connection_state_get_snapshot(connection_state_snapshot_t *snapshot);
+bool connection_state_is_connected(void);
+cy_rslt_t connection_state_wait_for_state(connection_state_t state, uint32_t timeout_ms);
+const char* connection_state_name(connection_state_t state);
+
+#endif /*SOURCE_CONNECTION_STATE_H_*/
+
+
+/* [] END OF FILE */
@@ -0,0 +1,380 @@
+/*******************************************************************************
+* File Name: fault_recovery.c
+*
+* Description: This file contains the tiered recovery from initialization
+* faults. A failed operation is first retried after re-initializing the WCM,
+* then after powering the Wi-Fi device off and on, and finally a controlled
+* warm reset of the MCU is done. The warm reset count and the time of the
+* fault are kept in RAM that is not initialized at startup, so the time to
+* recovery is also measured across the warm reset.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <string.h>
+
+#include "cyhal.h"
+#include "cybsp.h"
+
+/* FreeRTOS includes */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Wi-Fi Connection Manager includes */
+#include "cy_wcm.h"
+
+#include "wps_enrollee_task.h"
+#include "conn_journal.h"
+#include "fault_recovery.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define FAULT_RECOVERY_RETAINED_MAGIC       (0x52435652uL)
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* State kept across warm resets. */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t warm_resets;
+    uint32_t consecutive_warm_resets;
+    uint32_t last_fault_result;
+    uint32_t fault_to_reset_time_ms;
+    uint32_t checksum;
+} fault_recovery_retained_t;
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+CY_NOINIT static fault_recovery_retained_t retained;
+
+static fault_recovery_stats_t stats;
+
+/* True from a warm reset until the application reports that it is healthy. */
+static bool is_recovering_from_reset = false;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static uint32_t retained_checksum(void);
+static void record_recovery(fault_recovery_tier_t tier, uint32_t recovery_time_ms);
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: fault_recovery_init
+ *******************************************************************************
+ * Summary: Validates the state retained across resets. It is cleared on power
+ * up, when the RAM content is random.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void fault_recovery_init(void)
+{
+    memset(&stats, 0, sizeof(stats));
+
+    if ((FAULT_RECOVERY_RETAINED_MAGIC != retained.magic) || (retained_checksum() != retained.checksum))
+    {
+        memset(&retained, 0, sizeof(retained));
+        retained.magic = FAULT_RECOVERY_RETAINED_MAGIC;
+        retained.checksum = retained_checksum();
+    }
+
+    stats.warm_resets = retained.warm_resets;
+    is_recovering_from_reset = (retained.consecutive_warm_resets > 0u);
+}
+
+
+/*******************************************************************************
+ * Function Name: fault_recovery_run
+ *******************************************************************************
+ * Summary: Runs the operation and recovers from its failure in tiers. The
+ * operation is retried with an increasing delay, re-initializing the WCM first
+ * if it is a Wi-Fi operation. If that fails, the Wi-Fi device is kept powered
+ * off for FAULT_RECOVERY_WIFI_OFF_TIME_MSEC before the last retry. If the
+ * operation still fails, a warm reset is done.
+ *
+ * Parameters:
+ *  fault_recovery_operation_t operation: Operation to run.
+ *  void *arg: Argument of the operation.
+ *  bool is_wifi_operation: true if the operation is the WCM initialization.
+ *  const char *message: Message printed when the operation fails.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the operation succeeded. The function does
+ *  not return if the operation could not be recovered.
+ *
+ ******************************************************************************/
+cy_rslt_t fault_recovery_run(fault_recovery_operation_t operation, void *arg,
+                             bool is_wifi_operation, const char *message)
+{
+    cy_rslt_t result = operation(arg);
+    TickType_t fault_time;
+    uint32_t delay_ms = FAULT_RECOVERY_RETRY_DELAY_MSEC;
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        return result;
+    }
+
+    fault_time = xTaskGetTickCount();
+    stats.faults++;
+
+    if (NULL != message)
+    {
+        ERR_INFO(("%s", message));
+    }
+
+    /* Tier 1: retry the operation. */
+    for (uint32_t retry = 0; (retry < FAULT_RECOVERY_RETRY_COUNT) && (CY_RSLT_SUCCESS != result); retry++)
+    {
+        APP_INFO(("Recovery: retry %lu of %lu in %lu ms.\n", (unsigned long)(retry + 1),
+                  (unsigned long)FAULT_RECOVERY_RETRY_COUNT, (unsigned long)delay_ms));
+        vTaskDelay(pdMS_TO_TICKS(delay_ms));
+        delay_ms *= 2u;
+
+        if (is_wifi_operation)
+        {
+            cy_wcm_deinit();
+        }
+
+        result = operation(arg);
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        record_recovery(FAULT_RECOVERY_TIER_RETRY, (xTaskGetTickCount() - fault_time) * portTICK_PERIOD_MS);
+        return result;
+    }
+
+    /* Tier 2: power cycle the Wi-Fi device. De-initializing the WCM turns off
+     * the Wi-Fi device; it is powered on again by the WCM initialization.
+     */
+    if (is_wifi_operation)
+    {
+        APP_INFO(("Recovery: resetting the Wi-Fi device.\n"));
+        cy_wcm_deinit();
+        vTaskDelay(pdMS_TO_TICKS(FAULT_RECOVERY_WIFI_OFF_TIME_MSEC));
+
+        result = operation(arg);
+        if (CY_RSLT_SUCCESS == result)
+        {
+            record_recovery(FAULT_RECOVERY_TIER_WIFI_RESET, (xTaskGetTickCount() - fault_time) * portTICK_PERIOD_MS);
+            return result;
+        }
+    }
+
+    /* Tier 3: warm reset. */
+    retained.fault_to_reset_time_ms = (xTaskGetTickCount() - fault_time) * portTICK_PERIOD_MS;
+    error_handler(result, NULL);
+
+    return result;
+}
+
+
+/*******************************************************************************
+ * Function Name: fault_recovery_mark_healthy
+ *******************************************************************************
+ * Summary: Reports that the application completed its initialization. If the
+ * device was warm reset to recover from a fault, the recovery is recorded with
+ * the time from the fault until now, and the consecutive reset count is
+ * cleared.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void fault_recovery_mark_healthy(void)
+{
+    if (is_recovering_from_reset)
+    {
+        is_recovering_from_reset = false;
+
+        APP_INFO(("Recovered by warm reset from error 0x%08lx.\n", (unsigned long)retained.last_fault_result));
+        record_recovery(FAULT_RECOVERY_TIER_WARM_RESET,
+                        retained.fault_to_reset_time_ms + (xTaskGetTickCount() * portTICK_PERIOD_MS));
+
+        retained.consecutive_warm_resets = 0;
+        retained.fault_to_reset_time_ms = 0;
+        retained.checksum = retained_checksum();
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: fault_recovery_is_reset_allowed
+ *******************************************************************************
+ * Summary: Checks whether another warm reset may be done.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  bool: false after FAULT_RECOVERY_MAX_WARM_RESETS consecutive warm resets.
+ *
+ ******************************************************************************/
+bool fault_recovery_is_reset_allowed(void)
+{
+    return (retained.consecutive_warm_resets < FAULT_RECOVERY_MAX_WARM_RESETS);
+}
+
+
+/*******************************************************************************
+ * Function Name: fault_recovery_warm_reset
+ *******************************************************************************
+ * Summary: Records the fault in the retained state and the journal, and resets
+ * the MCU. The journal record is programmed before the reset.
+ *
+ * Parameters:
+ *  cy_rslt_t result: Result of the failed operation.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void fault_recovery_warm_reset(cy_rslt_t result)
+{
+    cy_rslt_t journal_result;
+
+    retained.warm_resets++;
+    retained.consecutive_warm_resets++;
+    retained.last_fault_result = (uint32_t)result;
+    retained.checksum = retained_checksum();
+
+    /* The append only queues the record; program it before the reset, since
+     * the writer task does not run again.
+     */
+    journal_result = conn_journal_append(CONN_JOURNAL_EVENT_WARM_RESET,
+                                         (uint8_t)retained.consecutive_warm_resets, (uint32_t)result);
+    if (CY_RSLT_SUCCESS == journal_result)
+    {
+        journal_result = conn_journal_flush();
+    }
+
+    if (CY_RSLT_SUCCESS != journal_result)
+    {
+        /* The retained state still records the fault. */
+        ERR_INFO(("Recovery: warm reset not journaled, error 0x%08lx.\n", (unsigned long)journal_result));
+    }
+
+    NVIC_SystemReset();
+}
+
+
+/*******************************************************************************
+ * Function Name: fault_recovery_get_stats
+ *******************************************************************************
+ * Summary: Copies the recovery statistics.
+ *
+ * Parameters:
+ *  fault_recovery_stats_t *stats_copy: Filled with the statistics.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void fault_recovery_get_stats(fault_recovery_stats_t *stats_copy)
+{
+    taskENTER_CRITICAL();
+    memcpy(stats_copy, &stats, sizeof(fault_recovery_stats_t));
+    taskEXIT_CRITICAL();
+}
+
+
+/*******************************************************************************
+ * Function Name: record_recovery
+ *******************************************************************************
+ * Summary: Updates the statistics and the journal with a successful recovery.
+ *
+ * Parameters:
+ *  fault_recovery_tier_t tier: Tier that recovered from the fault.
+ *  uint32_t recovery_time_ms: Time from the fault to the recovery.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void record_recovery(fault_recovery_tier_t tier, uint32_t recovery_time_ms)
+{
+    stats.recoveries[tier]++;
+    stats.last_recovery_tier = tier;
+    stats.last_recovery_time_ms = recovery_time_ms;
+
+    APP_INFO(("Recovery: recovered at tier %d in %lu ms.\n", (int)tier, (unsigned long)recovery_time_ms));
+    conn_journal_append(CONN_JOURNAL_EVENT_RECOVERED, (uint8_t)tier, recovery_time_ms);
+}
+
+
+/*******************************************************************************
+ * Function Name: retained_checksum
+ *******************************************************************************
+ * Summary: Computes the checksum of the retained state.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t: Checksum of all the fields except the checksum itself.
+ *
+ ******************************************************************************/
+static uint32_t retained_checksum(void)
+{
+    return ~(retained.magic + retained.warm_resets + retained.consecutive_warm_resets +
+             retained.last_fault_result + retained.fault_to_reset_time_ms);
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,125 @@
+/*******************************************************************************
+* File Name: fault_recovery.h
+*
+* Description: This file includes the macros, structures, and function
+* prototypes of the fault recovery used in fault_recovery.c
+*
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ *  Include guard
+ ******************************************************************************/
+#ifndef SOURCE_FAULT_RECOVERY_H_
+#define SOURCE_FAULT_RECOVERY_H_
+
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "cy_result.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Tier 1: number of times a failed operation is retried, and the delay before
+ * the first retry. The delay doubles on every retry.
+ */
+#define FAULT_RECOVERY_RETRY_COUNT          (3u)
+#define FAULT_RECOVERY_RETRY_DELAY_MSEC     (100u)
+
+/* Tier 2: time in milliseconds for which the Wi-Fi device is kept powered off
+ * after the WCM is de-initialized.
+ */
+#define FAULT_RECOVERY_WIFI_OFF_TIME_MSEC   (1000u)
+
+/* Tier 3: number of consecutive warm resets after which the device halts
+ * instead of resetting again, so that a permanent fault does not cause an
+ * endless reset loop.
+ */
+#define FAULT_RECOVERY_MAX_WARM_RESETS      (5u)
+
+
+/*******************************************************************************
+ * Enumerations
+ ******************************************************************************/
+typedef enum
+{
+    FAULT_RECOVERY_TIER_NONE = 0,
+    FAULT_RECOVERY_TIER_RETRY,          /* Operation retried (WCM re-initialized) */
+    FAULT_RECOVERY_TIER_WIFI_RESET,     /* Wi-Fi device powered off and on */
+    FAULT_RECOVERY_TIER_WARM_RESET      /* Controlled reset of the MCU */
+} fault_recovery_tier_t;
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Recovery statistics since startup. The warm reset count is kept across
+ * warm resets.
+ */
+typedef struct
+{
+    uint32_t faults;
+    uint32_t recoveries[FAULT_RECOVERY_TIER_WARM_RESET + 1];
+    uint32_t warm_resets;
+    uint32_t last_recovery_time_ms;
+    fault_recovery_tier_t last_recovery_tier;
+} fault_recovery_stats_t;
+
+/* Operation run under fault recovery, such as a component initialization. */
+typedef cy_rslt_t (*fault_recovery_operation_t)(void *arg);
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+void fault_recovery_init(void);
+cy_rslt_t fault_recovery_run(fault_recovery_operation_t operation, void *arg,
+                             bool is_wifi_operation, const char *message);
+void fault_recovery_mark_healthy(void);
+void fault_recovery_warm_reset(cy_rslt_t result);
+bool fault_recovery_is_reset_allowed(void);
+void fault_recovery_get_stats(fault_recovery_stats_t *stats_copy);
+
+#endif /*SOURCE_FAULT_RECOVERY_H_*/
+
+
+/* [] END OF FILE */
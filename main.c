@@ -49,17 +49,33 @@
 /* Task header files */
 #include "wps_enrollee_task.h"
 
+/* FreeRTOS heap and the mbedTLS allocator hooks */
+#include "pool_allocator.h"
+#include "mbedtls/platform.h"
+
 /* Wi-Fi Conection Manager (WCM) header file. */
 #include "cy_wcm.h"
 
+/* Connection journal header file */
+#include "conn_journal_flash.h"
+#include "fault_recovery.h"
+
 /* Include serial flash library and QSPI memory configurations only for the
- * kits that require the Wi-Fi firmware to be loaded in external QSPI NOR flash.
+ * kits that require the Wi-Fi firmware to be loaded in external QSPI NOR flash
+ * or that keep the connection journal in it.
  */
-#if defined(CY_DEVICE_PSOC6A512K)
+#if defined(CY_DEVICE_PSOC6A512K) || (CONN_JOURNAL_ENABLE)
 #include "cy_serial_flash_qspi.h"
 #include "cycfg_qspi_memslot.h"
 #endif
 
+/* MBEDTLS_PLATFORM_MEMORY is defined in the Makefile so that the allocations
+ * of mbedTLS can be routed to the pool allocator.
+ */
+#if (configHEAP_ALLOCATION_SCHEME == NO_HEAP_ALLOCATION) && !defined(MBEDTLS_PLATFORM_MEMORY)
+#error "MBEDTLS_PLATFORM_MEMORY is required to route the mbedTLS allocations to the pool allocator."
+#endif
+
 
 /*******************************************************************************
  * Global Variables
@@ -94,6 +110,18 @@ int main()
     /* This enables RTOS aware debugging in OpenOCD */
     uxTopUsedPriority = configMAX_PRIORITIES - 1;
 
+    /* Validate the fault recovery state retained across warm resets before
+     * the error handler can be called.
+     */
+    fault_recovery_init();
+
+    /* Serve the allocations of mbedTLS from the FreeRTOS heap before any task
+     * can use it.
+     */
+    #if (configHEAP_ALLOCATION_SCHEME == NO_HEAP_ALLOCATION)
+    mbedtls_platform_set_calloc_free(pvPortCalloc, vPortFree);
+    #endif
+
     /* Initialize the board support package */
     result = cybsp_init();
     error_handler(result, NULL);
@@ -111,13 +139,15 @@ int main()
     is_retarget_io_initialized = true;
 
     /* Init QSPI and enable XIP to get the Wi-Fi firmware from the QSPI NOR flash */
-    #if defined(CY_DEVICE_PSOC6A512K)
+    #if defined(CY_DEVICE_PSOC6A512K) || (CONN_JOURNAL_ENABLE)
         const uint32_t bus_frequency = 50000000lu;
         cy_serial_flash_qspi_init(smifMemConfigs[0], CYBSP_QSPI_D0, CYBSP_QSPI_D1,
                                       CYBSP_QSPI_D2, CYBSP_QSPI_D3, NC, NC, NC, NC,
                                       CYBSP_QSPI_SCK, CYBSP_QSPI_SS, bus_frequency);
 
+        #if defined(CY_DEVICE_PSOC6A512K)
         cy_serial_flash_qspi_enable_xip(true);
+        #endif
     #endif
 
     /* \x1b[2J\x1b[;H - ANSI ESC sequence for clear screen */
@@ -127,6 +157,14 @@ int main()
            "CE230105 WiFi Example: WPS Enrollee\n"
            "********************************************************\n");
 
+    /* The journal is optional; the example runs without it if the serial
+     * flash is not usable.
+     */
+    if (CY_RSLT_SUCCESS != conn_journal_flash_init())
+    {
+        printf("Connection journal is not available.\n");
+    }
+
     /* Create the task. */
     xTaskCreate(wps_enrollee_task, "WPS Enrollee Task", WPS_ENROLLEE_TASK_STACK_SIZE,
                 NULL, WPS_ENROLLEE_TASK_PRIORITY, &wps_enrollee_task_handle);
@@ -0,0 +1,450 @@
+/*******************************************************************************
+* File Name: metrics_endpoint.c
+*
+* Description: This file contains the UDP metrics endpoint. Once the device is
+* connected, a datagram with the payload METRICS_ENDPOINT_REQUEST sent to
+* METRICS_ENDPOINT_PORT is answered with a text snapshot of the device health,
+* one "name value" pair per line. The request and the response are held in
+* static buffers and the snapshot is encoded without the C library formatting
+* functions, so serving a request does not allocate memory.
+*
+* Related Document: See README.md
+*
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <string.h>
+#if defined(__GNUC__) && !defined(__ARMCC_VERSION)
+#include <malloc.h>
+#include <unistd.h>
+#endif
+
+/* FreeRTOS includes */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "ip_addr.h"
+
+/* Wi-Fi Connection Manager includes */
+#include "cy_wcm.h"
+
+/* Secure Sockets includes */
+#include "cy_secure_sockets.h"
+
+#include "wps_enrollee_task.h"
+#include "connection_state.h"
+#include "pool_allocator.h"
+#include "provisioning_relay.h"
+#include "metrics_endpoint.h"
+
+#if (METRICS_ENDPOINT_ENABLE)
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Delay in milliseconds after a failed receive, so that a persistent socket
+ * error does not keep the task busy.
+ */
+#define METRICS_RECEIVE_ERROR_DELAY_MSEC    (100u)
+
+/* Receive timeout in milliseconds, after which the task checks that the
+ * socket is still bound to the current STA address.
+ */
+#define METRICS_ADDRESS_CHECK_MSEC          (1000u)
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/* One byte longer than the request, so that longer datagrams are told apart. */
+static uint8_t request_buffer[sizeof(METRICS_ENDPOINT_REQUEST)];
+static char response_buffer[METRICS_ENDPOINT_RESPONSE_SIZE];
+
+static volatile uint32_t served_count = 0;
+
+#if defined(__GNUC__) && !defined(__ARMCC_VERSION)
+/* End of the C library heap, defined by the linker script. */
+extern uint8_t __HeapLimit;
+#endif
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static void metrics_endpoint_task(void *arg);
+static cy_rslt_t create_server_socket(cy_socket_t *server, uint32_t ipv4_address);
+static bool get_sta_ipv4_address(uint32_t *ipv4_address);
+static bool is_relay_client(const cy_socket_sockaddr_t *peer);
+static uint32_t build_snapshot(char *buffer, uint32_t size);
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: metrics_endpoint_init
+ *******************************************************************************
+ * Summary: Creates the task that serves the metrics. The task opens the UDP
+ * socket when the device first connects.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS, or METRICS_ENDPOINT_RSLT_NO_MEMORY if the task
+ *  could not be created.
+ *
+ ******************************************************************************/
+cy_rslt_t metrics_endpoint_init(void)
+{
+    if (pdPASS != xTaskCreate(metrics_endpoint_task, "Metrics endpoint", METRICS_ENDPOINT_TASK_STACK_SIZE,
+                              NULL, METRICS_ENDPOINT_TASK_PRIORITY, NULL))
+    {
+        return METRICS_ENDPOINT_RSLT_NO_MEMORY;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/*******************************************************************************
+ * Function Name: metrics_endpoint_get_served_count
+ *******************************************************************************
+ * Summary: Returns the number of metrics requests answered since startup.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t: Number of requests answered.
+ *
+ ******************************************************************************/
+uint32_t metrics_endpoint_get_served_count(void)
+{
+    return served_count;
+}
+
+
+/*******************************************************************************
+ * Function Name: metrics_endpoint_task
+ *******************************************************************************
+ * Summary: Answers the metrics requests one at a time while the device is
+ * connected. The socket is bound to the address of the STA interface only, and
+ * is bound again when that address changes. lwIP also delivers datagrams sent
+ * to the STA address through the relay soft-AP, so requests from the soft-AP
+ * subnet are ignored as well.
+ *
+ * Parameters:
+ *  void *arg: Task parameter defined during task creation (unused).
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void metrics_endpoint_task(void *arg)
+{
+    cy_socket_t server = NULL;
+    cy_socket_sockaddr_t peer;
+    uint32_t peer_length;
+    uint32_t received;
+    uint32_t sent;
+    uint32_t length;
+    uint32_t sta_address;
+    uint32_t bound_address = 0;
+    cy_rslt_t result;
+
+    if (CY_RSLT_SUCCESS != cy_socket_init())
+    {
+        ERR_INFO(("Failed to start the metrics endpoint.\n"));
+        vTaskDelete(NULL);
+        return;
+    }
+
+    while (true)
+    {
+        (void)connection_state_wait_for_state(CONNECTION_STATE_CONNECTED, CONNECTION_STATE_WAIT_FOREVER);
+
+        if (!get_sta_ipv4_address(&sta_address))
+        {
+            vTaskDelay(pdMS_TO_TICKS(METRICS_ADDRESS_CHECK_MSEC));
+            continue;
+        }
+
+        if ((NULL == server) || (sta_address != bound_address))
+        {
+            if (NULL != server)
+            {
+                cy_socket_delete(server);
+                server = NULL;
+            }
+
+            if (CY_RSLT_SUCCESS != create_server_socket(&server, sta_address))
+            {
+                ERR_INFO(("Failed to start the metrics endpoint.\n"));
+                if (NULL != server)
+                {
+                    cy_socket_delete(server);
+                    server = NULL;
+                }
+                vTaskDelay(pdMS_TO_TICKS(METRICS_ADDRESS_CHECK_MSEC));
+                continue;
+            }
+
+            bound_address = sta_address;
+            APP_INFO(("Metrics endpoint listening on %s UDP port %u.\n",
+                      ip4addr_ntoa((const ip4_addr_t *)&bound_address), (unsigned int)METRICS_ENDPOINT_PORT));
+        }
+
+        peer_length = sizeof(peer);
+        result = cy_socket_recvfrom(server, request_buffer, sizeof(request_buffer), CY_SOCKET_FLAGS_NONE,
+                                    &peer, &peer_length, &received);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            if (CY_RSLT_MODULE_SECURE_SOCKETS_TIMEOUT != result)
+            {
+                vTaskDelay(pdMS_TO_TICKS(METRICS_RECEIVE_ERROR_DELAY_MSEC));
+            }
+            continue;
+        }
+
+        if ((received != (sizeof(METRICS_ENDPOINT_REQUEST) - 1u)) ||
+            (0 != memcmp(request_buffer, METRICS_ENDPOINT_REQUEST, received)) ||
+            is_relay_client(&peer))
+        {
+            continue;
+        }
+
+        length = build_snapshot(response_buffer, sizeof(response_buffer));
+
+        if (CY_RSLT_SUCCESS == cy_socket_sendto(server, response_buffer, length, CY_SOCKET_FLAGS_NONE,
+                                                &peer, peer_length, &sent))
+        {
+            served_count++;
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: create_server_socket
+ *******************************************************************************
+ * Summary: Creates the UDP socket of the endpoint, bound to
+ * METRICS_ENDPOINT_PORT on the given address, that waits up to
+ * METRICS_ADDRESS_CHECK_MSEC for a request.
+ *
+ * Parameters:
+ *  cy_socket_t *server: Set to the created socket, or left NULL.
+ *  uint32_t ipv4_address: Address of the STA interface.
+ *
+ * Return:
+ *  cy_rslt_t: Result of the first secure sockets call that failed, or
+ *  CY_RSLT_SUCCESS.
+ *
+ ******************************************************************************/
+static cy_rslt_t create_server_socket(cy_socket_t *server, uint32_t ipv4_address)
+{
+    cy_socket_sockaddr_t address;
+    uint32_t timeout = METRICS_ADDRESS_CHECK_MSEC;
+    cy_rslt_t result;
+
+    result = cy_socket_create(CY_SOCKET_DOMAIN_AF_INET, CY_SOCKET_TYPE_DGRAM, CY_SOCKET_IPPROTO_UDP, server);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cy_socket_setsockopt(*server, CY_SOCKET_SOL_SOCKET, CY_SOCKET_SO_RCVTIMEO,
+                                      &timeout, sizeof(timeout));
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        memset(&address, 0, sizeof(address));
+        address.port = METRICS_ENDPOINT_PORT;
+        address.ip_address.version = CY_SOCKET_IP_VER_V4;
+        address.ip_address.ip.v4 = ipv4_address;
+        result = cy_socket_bind(*server, &address, sizeof(address));
+    }
+
+    return result;
+}
+
+
+/*******************************************************************************
+ * Function Name: get_sta_ipv4_address
+ *******************************************************************************
+ * Summary: Reads the IPv4 address of the STA interface. An address in the
+ * subnet of a provisioning relay, which the STA interface holds while it is
+ * joined to a relay to request the credential, is not used.
+ *
+ * Parameters:
+ *  uint32_t *ipv4_address: Filled with the address.
+ *
+ * Return:
+ *  bool: false if the STA interface has no IPv4 address on the AP network.
+ *
+ ******************************************************************************/
+static bool get_sta_ipv4_address(uint32_t *ipv4_address)
+{
+    cy_wcm_ip_address_t ip_address;
+
+    if ((CY_RSLT_SUCCESS != cy_wcm_get_ip_addr(CY_WCM_INTERFACE_TYPE_STA, &ip_address)) ||
+        (CY_WCM_IP_VER_V4 != ip_address.version) || (0u == ip_address.ip.v4) ||
+        provisioning_relay_is_relay_network(ip_address.ip.v4))
+    {
+        return false;
+    }
+
+    *ipv4_address = ip_address.ip.v4;
+    return true;
+}
+
+
+/*******************************************************************************
+ * Function Name: is_relay_client
+ *******************************************************************************
+ * Summary: Checks whether a request comes from the subnet of the provisioning
+ * relay soft-AP.
+ *
+ * Parameters:
+ *  const cy_socket_sockaddr_t *peer: Sender of the request.
+ *
+ * Return:
+ *  bool: true if the sender is a client of the relay soft-AP.
+ *
+ ******************************************************************************/
+static bool is_relay_client(const cy_socket_sockaddr_t *peer)
+{
+    return (CY_SOCKET_IP_VER_V4 == peer->ip_address.version) &&
+           provisioning_relay_is_relay_network(peer->ip_address.ip.v4);
+}
+
+
+/*******************************************************************************
+ * Function Name: build_snapshot
+ *******************************************************************************
+ * Summary: Reads the current metrics and encodes them into the buffer with
+ * metrics_snapshot_encode().
+ *
+ * Parameters:
+ *  char *buffer: Buffer for the snapshot.
+ *  uint32_t size: Size of the buffer in bytes.
+ *
+ * Return:
+ *  uint32_t: Length of the snapshot in bytes.
+ *
+ ******************************************************************************/
+static uint32_t build_snapshot(char *buffer, uint32_t size)
+{
+    wps_enrollee_stats_t stats;
+    pool_allocator_class_stats_t pool;
+    cy_wcm_associated_ap_info_t ap_info;
+    metrics_snapshot_t snapshot;
+    bool is_connected = connection_state_is_connected();
+    uint32_t pool_free_bytes = 0;
+#if defined(__GNUC__) && !defined(__ARMCC_VERSION)
+    struct mallinfo heap_info;
+    uint8_t *heap_break;
+#endif
+
+    wps_enrollee_get_stats(&stats);
+
+    for (uint32_t index = 0; index < POOL_ALLOCATOR_CLASS_COUNT; index++)
+    {
+        pool_allocator_get_class_stats(index, &pool);
+        pool_free_bytes += (pool.block_count - pool.blocks_in_use) * pool.block_size;
+    }
+
+    memset(&snapshot, 0, sizeof(snapshot));
+    snapshot.present_mask = (1uL << METRICS_SNAPSHOT_METRIC_COUNT) - 1u;
+
+    snapshot.values[METRICS_SNAPSHOT_UPTIME_S] = (int32_t)(xTaskGetTickCount() / configTICK_RATE_HZ);
+    snapshot.values[METRICS_SNAPSHOT_CONNECTED] = is_connected ? 1 : 0;
+    snapshot.values[METRICS_SNAPSHOT_CONNECTIONS] = (int32_t)stats.connect_successes;
+    snapshot.values[METRICS_SNAPSHOT_CONNECT_FAILURES] = (int32_t)stats.connect_failures;
+    snapshot.values[METRICS_SNAPSHOT_DISCONNECTS_LINK_LOSS] = (int32_t)stats.link_losses;
+    snapshot.values[METRICS_SNAPSHOT_DISCONNECTS_REQUESTED] = (int32_t)stats.user_disconnects;
+    snapshot.values[METRICS_SNAPSHOT_LINK_RESTORATIONS] = (int32_t)stats.link_restorations;
+    snapshot.values[METRICS_SNAPSHOT_RESTORE_MTTR_MS] =
+        (int32_t)((0u == stats.link_restorations) ? 0u : (stats.total_restore_time_ms / stats.link_restorations));
+
+    if (is_connected && (CY_RSLT_SUCCESS == cy_wcm_get_associated_ap_info(&ap_info)))
+    {
+        snapshot.values[METRICS_SNAPSHOT_RSSI_DBM] = ap_info.signal_strength;
+    }
+    else
+    {
+        snapshot.present_mask &= ~(1uL << METRICS_SNAPSHOT_RSSI_DBM);
+    }
+
+    snapshot.values[METRICS_SNAPSHOT_POOL_FREE_BYTES] = (int32_t)pool_free_bytes;
+
+#if defined(__GNUC__) && !defined(__ARMCC_VERSION)
+    /* The C library heap has the free chunks of its arena and the space
+     * between the program break and the end of the heap region.
+     */
+    heap_info = mallinfo();
+    heap_break = (uint8_t *)sbrk(0);
+    snapshot.values[METRICS_SNAPSHOT_C_HEAP_FREE_BYTES] =
+        (int32_t)((uint32_t)heap_info.fordblks + (uint32_t)(&__HeapLimit - heap_break));
+#else
+    snapshot.present_mask &= ~(1uL << METRICS_SNAPSHOT_C_HEAP_FREE_BYTES);
+#endif
+
+    snapshot.values[METRICS_SNAPSHOT_PROVISIONING_LATENCY_MS] = (int32_t)stats.last_provision_duration_ms;
+    snapshot.values[METRICS_SNAPSHOT_WPS_LATENCY_MS] = (int32_t)stats.last_wps_duration_ms;
+    snapshot.values[METRICS_SNAPSHOT_CONNECT_LATENCY_MS] = (int32_t)stats.last_connect_duration_ms;
+
+    return metrics_snapshot_encode(&snapshot, buffer, size);
+}
+
+#else
+
+cy_rslt_t metrics_endpoint_init(void)
+{
+    return CY_RSLT_SUCCESS;
+}
+
+uint32_t metrics_endpoint_get_served_count(void)
+{
+    return 0;
+}
+
+#endif /* METRICS_ENDPOINT_ENABLE */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,137 @@
+/*******************************************************************************
+* File Name: metrics_endpoint.h
+*
+* Description: This file includes the macros and function prototypes of the
+* UDP metrics endpoint used in metrics_endpoint.c
+*
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ *  Include guard
+ ******************************************************************************/
+#ifndef SOURCE_METRICS_ENDPOINT_H_
+#define SOURCE_METRICS_ENDPOINT_H_
+
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdint.h>
+
+#include "cy_result.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Set this macro to 0 to remove the metrics endpoint. */
+#define METRICS_ENDPOINT_ENABLE             (1)
+
+/* UDP port on the STA interface on which the metrics are served. */
+#define METRICS_ENDPOINT_PORT               (50008u)
+
+/* Payload of a metrics request. Datagrams with any other payload are
+ * ignored, so that stray traffic on the port is not answered.
+ */
+#define METRICS_ENDPOINT_REQUEST            "metrics"
+
+/* Size in bytes of the response buffer. The snapshot is truncated at a line
+ * boundary if it does not fit; the metrics of metrics_snapshot_metric_t at
+ * their longest values take 395 bytes.
+ */
+#define METRICS_ENDPOINT_RESPONSE_SIZE      (512u)
+
+#define METRICS_ENDPOINT_TASK_STACK_SIZE    (2048u)
+#define METRICS_ENDPOINT_TASK_PRIORITY      (1u)
+
+/* Metrics endpoint result codes. */
+#define METRICS_ENDPOINT_RSLT_MODULE        (CY_RSLT_MODULE_MIDDLEWARE_BASE + 0xF8u)
+#define METRICS_ENDPOINT_RSLT_NO_MEMORY     CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, METRICS_ENDPOINT_RSLT_MODULE, 1u)
+
+
+/*******************************************************************************
+ * Enumerations
+ ******************************************************************************/
+/* Metrics of the snapshot, in the order in which they are sent. */
+typedef enum
+{
+    METRICS_SNAPSHOT_UPTIME_S,
+    METRICS_SNAPSHOT_CONNECTED,
+    METRICS_SNAPSHOT_CONNECTIONS,
+    METRICS_SNAPSHOT_CONNECT_FAILURES,
+    METRICS_SNAPSHOT_DISCONNECTS_LINK_LOSS,
+    METRICS_SNAPSHOT_DISCONNECTS_REQUESTED,
+    METRICS_SNAPSHOT_LINK_RESTORATIONS,
+    METRICS_SNAPSHOT_RESTORE_MTTR_MS,
+    METRICS_SNAPSHOT_RSSI_DBM,
+    METRICS_SNAPSHOT_POOL_FREE_BYTES,
+    METRICS_SNAPSHOT_C_HEAP_FREE_BYTES,
+    METRICS_SNAPSHOT_PROVISIONING_LATENCY_MS,
+    METRICS_SNAPSHOT_WPS_LATENCY_MS,
+    METRICS_SNAPSHOT_CONNECT_LATENCY_MS,
+    METRICS_SNAPSHOT_METRIC_COUNT
+} metrics_snapshot_metric_t;
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Values of the metrics. A metric whose bit is clear in present_mask, such as
+ * the RSSI while disconnected, is left out of the snapshot.
+ */
+typedef struct
+{
+    int32_t  values[METRICS_SNAPSHOT_METRIC_COUNT];
+    uint32_t present_mask;
+} metrics_snapshot_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_rslt_t metrics_endpoint_init(void);
+uint32_t metrics_endpoint_get_served_count(void);
+
+/* Snapshot encoding, in metrics_snapshot.c. It uses no RTOS or network
+ * services so that it can be tested on the host.
+ */
+uint32_t metrics_snapshot_encode(const metrics_snapshot_t *snapshot, char *buffer, uint32_t size);
+
+#endif /*SOURCE_METRICS_ENDPOINT_H_*/
+
+
+/* [] END OF FILE */
@@ -0,0 +1,184 @@
+/*******************************************************************************
+* File Name: metrics_snapshot.c
+*
+* Description: This file contains the text encoding of the snapshot served by
+* the metrics endpoint. It uses no RTOS or network services so that it can be
+* tested on the host.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdbool.h>
+#include <string.h>
+
+#include "metrics_endpoint.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Maximum number of characters of a decimal int32_t, including the sign. */
+#define METRICS_MAX_DIGITS                  (11u)
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static const char *const metric_names[METRICS_SNAPSHOT_METRIC_COUNT] =
+{
+    [METRICS_SNAPSHOT_UPTIME_S]                = "uptime_s",
+    [METRICS_SNAPSHOT_CONNECTED]               = "connected",
+    [METRICS_SNAPSHOT_CONNECTIONS]             = "connections",
+    [METRICS_SNAPSHOT_CONNECT_FAILURES]        = "connect_failures",
+    [METRICS_SNAPSHOT_DISCONNECTS_LINK_LOSS]   = "disconnects_link_loss",
+    [METRICS_SNAPSHOT_DISCONNECTS_REQUESTED]   = "disconnects_requested",
+    [METRICS_SNAPSHOT_LINK_RESTORATIONS]       = "link_restorations",
+    [METRICS_SNAPSHOT_RESTORE_MTTR_MS]         = "restore_mttr_ms",
+    [METRICS_SNAPSHOT_RSSI_DBM]                = "rssi_dbm",
+    [METRICS_SNAPSHOT_POOL_FREE_BYTES]         = "pool_free_bytes",
+    [METRICS_SNAPSHOT_C_HEAP_FREE_BYTES]       = "c_heap_free_bytes",
+    [METRICS_SNAPSHOT_PROVISIONING_LATENCY_MS] = "provisioning_latency_ms",
+    [METRICS_SNAPSHOT_WPS_LATENCY_MS]          = "wps_latency_ms",
+    [METRICS_SNAPSHOT_CONNECT_LATENCY_MS]      = "connect_latency_ms",
+};
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static bool append_metric(char *buffer, uint32_t size, uint32_t *length, const char *name, int32_t value);
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: metrics_snapshot_encode
+ *******************************************************************************
+ * Summary: Encodes the metrics present in the snapshot as "name value" lines.
+ * The snapshot is truncated after the last line that fits in the buffer, so
+ * a scraper never sees a partial line, and the lines it sees are always the
+ * first ones of the snapshot. The buffer is not NUL-terminated.
+ *
+ * Parameters:
+ *  const metrics_snapshot_t *snapshot: Values of the metrics.
+ *  char *buffer: Buffer for the snapshot.
+ *  uint32_t size: Size of the buffer in bytes.
+ *
+ * Return:
+ *  uint32_t: Length of the snapshot in bytes.
+ *
+ ******************************************************************************/
+uint32_t metrics_snapshot_encode(const metrics_snapshot_t *snapshot, char *buffer, uint32_t size)
+{
+    uint32_t length = 0;
+
+    for (uint32_t metric = 0; metric < (uint32_t)METRICS_SNAPSHOT_METRIC_COUNT; metric++)
+    {
+        if ((0u != (snapshot->present_mask & (1uL << metric))) &&
+            !append_metric(buffer, size, &length, metric_names[metric], snapshot->values[metric]))
+        {
+            break;
+        }
+    }
+
+    return length;
+}
+
+
+/*******************************************************************************
+ * Function Name: append_metric
+ *******************************************************************************
+ * Summary: Appends a "name value" line to the snapshot if it fits in the
+ * buffer.
+ *
+ * Parameters:
+ *  char *buffer: Buffer of the snapshot.
+ *  uint32_t size: Size of the buffer in bytes.
+ *  uint32_t *length: Length of the snapshot, updated.
+ *  const char *name: Name of the metric.
+ *  int32_t value: Value of the metric.
+ *
+ * Return:
+ *  bool: false if the line does not fit.
+ *
+ ******************************************************************************/
+static bool append_metric(char *buffer, uint32_t size, uint32_t *length, const char *name, int32_t value)
+{
+    char digits[METRICS_MAX_DIGITS];
+    uint32_t digit_count = 0;
+    uint32_t name_length = (uint32_t)strlen(name);
+    uint32_t magnitude = (value < 0) ? (0u - (uint32_t)value) : (uint32_t)value;
+    uint32_t position = *length;
+
+    /* Digits in reverse order */
+    do
+    {
+        digits[digit_count++] = (char)('0' + (magnitude % 10u));
+        magnitude /= 10u;
+    } while (magnitude > 0u);
+
+    if (value < 0)
+    {
+        digits[digit_count++] = '-';
+    }
+
+    /* Name, space, value and newline */
+    if ((position + name_length + digit_count + 2u) > size)
+    {
+        return false;
+    }
+
+    memcpy(&buffer[position], name, name_length);
+    position += name_length;
+    buffer[position++] = ' ';
+
+    while (digit_count > 0u)
+    {
+        buffer[position++] = digits[--digit_count];
+    }
+
+    buffer[position++] = '\n';
+    *length = position;
+
+    return true;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,293 @@
+/*******************************************************************************
+* File Name: network_event_dispatcher.c
+*
+* Description: This file contains the dispatcher of the WCM network events. The
+* WCM event callback only copies the event into a bounded queue and returns, so
+* that the WCM thread is never blocked by the consumers. The dispatcher task
+* delivers the events to every subscriber whose filter mask matches.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <string.h>
+
+/* FreeRTOS includes */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+/* Wi-Fi Connection Manager includes */
+#include "cy_wcm.h"
+
+#include "network_event_dispatcher.h"
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef struct
+{
+    cy_wcm_event_t      event;
+    cy_wcm_event_data_t event_data;
+} network_event_message_t;
+
+typedef struct
+{
+    network_event_subscriber_t subscriber;
+    uint32_t                   event_mask;
+    void                       *arg;
+} network_event_subscription_t;
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static QueueHandle_t network_event_queue;
+static TaskHandle_t network_event_dispatcher_task_handle;
+static network_event_subscription_t subscriptions[NETWORK_EVENT_MAX_SUBSCRIBERS];
+static volatile uint32_t dropped_event_count = 0;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static void wcm_event_callback(cy_wcm_event_t event, cy_wcm_event_data_t *event_data);
+static void network_event_dispatcher_task(void *arg);
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: network_event_dispatcher_init
+ *******************************************************************************
+ * Summary: Creates the event queue and the dispatcher task, and registers the
+ * WCM event callback. Must be called after the WCM is initialized.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the dispatcher was started.
+ *
+ ******************************************************************************/
+cy_rslt_t network_event_dispatcher_init(void)
+{
+    network_event_queue = xQueueCreate(NETWORK_EVENT_QUEUE_LENGTH, sizeof(network_event_message_t));
+    if (NULL == network_event_queue)
+    {
+        return NETWORK_EVENT_RSLT_NO_MEMORY;
+    }
+    vQueueAddToRegistry(network_event_queue, "Network event");
+
+    if (pdPASS != xTaskCreate(network_event_dispatcher_task, "Net Event Task",
+                              NETWORK_EVENT_DISPATCHER_TASK_STACK_SIZE, NULL,
+                              NETWORK_EVENT_DISPATCHER_TASK_PRIORITY,
+                              &network_event_dispatcher_task_handle))
+    {
+        return NETWORK_EVENT_RSLT_NO_MEMORY;
+    }
+
+    return cy_wcm_register_event_callback(wcm_event_callback);
+}
+
+
+/*******************************************************************************
+ * Function Name: network_event_subscribe
+ *******************************************************************************
+ * Summary: Registers a subscriber for the events selected by the mask. The
+ * mask is built with NETWORK_EVENT_MASK().
+ *
+ * Parameters:
+ *  network_event_subscriber_t subscriber: Callback of the subscriber.
+ *  uint32_t event_mask: Events delivered to the subscriber.
+ *  void *arg: Argument passed back to the subscriber.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the subscriber was registered.
+ *
+ ******************************************************************************/
+cy_rslt_t network_event_subscribe(network_event_subscriber_t subscriber, uint32_t event_mask, void *arg)
+{
+    cy_rslt_t result = NETWORK_EVENT_RSLT_FULL;
+
+    taskENTER_CRITICAL();
+    for (uint32_t index = 0; index < NETWORK_EVENT_MAX_SUBSCRIBERS; index++)
+    {
+        if (NULL == subscriptions[index].subscriber)
+        {
+            subscriptions[index].subscriber = subscriber;
+            subscriptions[index].event_mask = event_mask;
+            subscriptions[index].arg = arg;
+            result = CY_RSLT_SUCCESS;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    return result;
+}
+
+
+/*******************************************************************************
+ * Function Name: network_event_unsubscribe
+ *******************************************************************************
+ * Summary: Removes a subscriber registered with network_event_subscribe.
+ *
+ * Parameters:
+ *  network_event_subscriber_t subscriber: Callback of the subscriber.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void network_event_unsubscribe(network_event_subscriber_t subscriber)
+{
+    taskENTER_CRITICAL();
+    for (uint32_t index = 0; index < NETWORK_EVENT_MAX_SUBSCRIBERS; index++)
+    {
+        if (subscriber == subscriptions[index].subscriber)
+        {
+            subscriptions[index].subscriber = NULL;
+        }
+    }
+    taskEXIT_CRITICAL();
+}
+
+
+/*******************************************************************************
+ * Function Name: network_event_get_dropped_count
+ *******************************************************************************
+ * Summary: Returns the number of events dropped because the queue was full.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t: Number of dropped events.
+ *
+ ******************************************************************************/
+uint32_t network_event_get_dropped_count(void)
+{
+    return dropped_event_count;
+}
+
+
+/*******************************************************************************
+ * Function Name: wcm_event_callback
+ *******************************************************************************
+ * Summary: WCM event callback. It runs in the WCM thread context, so it only
+ * copies the event into the queue without blocking.
+ *
+ * Parameters:
+ *  cy_wcm_event_t event: Network event as listed in the enumeration
+ *                        cy_wcm_event_t.
+ *  cy_wcm_event_data_t *event_data: Contains data related to the network event.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void wcm_event_callback(cy_wcm_event_t event, cy_wcm_event_data_t *event_data)
+{
+    network_event_message_t message;
+
+    message.event = event;
+    if (NULL != event_data)
+    {
+        memcpy(&message.event_data, event_data, sizeof(cy_wcm_event_data_t));
+    }
+    else
+    {
+        memset(&message.event_data, 0, sizeof(cy_wcm_event_data_t));
+    }
+
+    if (pdTRUE != xQueueSend(network_event_queue, &message, 0))
+    {
+        dropped_event_count++;
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: network_event_dispatcher_task
+ *******************************************************************************
+ * Summary: Waits for events in the queue and delivers each event to the
+ * subscribers whose mask matches. The subscription table is copied before the
+ * delivery so that subscribers may register or unregister from their callback.
+ *
+ * Parameters:
+ *  void* arg: Task parameter defined during task creation (unused).
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void network_event_dispatcher_task(void *arg)
+{
+    network_event_message_t message;
+    network_event_subscription_t active_subscriptions[NETWORK_EVENT_MAX_SUBSCRIBERS];
+
+    (void)arg;
+
+    while (true)
+    {
+        if (pdTRUE != xQueueReceive(network_event_queue, &message, portMAX_DELAY))
+        {
+            continue;
+        }
+
+        taskENTER_CRITICAL();
+        memcpy(active_subscriptions, subscriptions, sizeof(subscriptions));
+        taskEXIT_CRITICAL();
+
+        for (uint32_t index = 0; index < NETWORK_EVENT_MAX_SUBSCRIBERS; index++)
+        {
+            if ((NULL != active_subscriptions[index].subscriber) &&
+                (0u != (active_subscriptions[index].event_mask & NETWORK_EVENT_MASK(message.event))))
+            {
+                active_subscriptions[index].subscriber(message.event, &message.event_data,
+                                                       active_subscriptions[index].arg);
+            }
+        }
+    }
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,103 @@
+/*******************************************************************************
+* File Name: network_event_dispatcher.h
+*
+* Description: This file includes the macros, types, and function prototypes
+* of the network event dispatcher used in network_event_dispatcher.c
+*
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ *  Include guard
+ ******************************************************************************/
+#ifndef SOURCE_NETWORK_EVENT_DISPATCHER_H_
+#define SOURCE_NETWORK_EVENT_DISPATCHER_H_
+
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+/* Wi-Fi Connection Manager includes */
+#include "cy_wcm.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Number of WCM events that can be pending for dispatch. Events arriving while
+ * the queue is full are dropped and counted.
+ */
+#define NETWORK_EVENT_QUEUE_LENGTH          (8u)
+
+/* Maximum number of registered subscribers. */
+#define NETWORK_EVENT_MAX_SUBSCRIBERS       (6u)
+
+#define NETWORK_EVENT_DISPATCHER_TASK_STACK_SIZE    (2048u)
+#define NETWORK_EVENT_DISPATCHER_TASK_PRIORITY      (3u)
+
+/* Filter mask selecting a single WCM event. */
+#define NETWORK_EVENT_MASK(event)           (1uL << (uint32_t)(event))
+#define NETWORK_EVENT_MASK_ALL              (0xFFFFFFFFuL)
+
+/* Dispatcher result codes. */
+#define NETWORK_EVENT_RSLT_MODULE           (CY_RSLT_MODULE_MIDDLEWARE_BASE + 0xF2u)
+#define NETWORK_EVENT_RSLT_NO_MEMORY        CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, NETWORK_EVENT_RSLT_MODULE, 1u)
+#define NETWORK_EVENT_RSLT_FULL             CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, NETWORK_EVENT_RSLT_MODULE, 2u)
+
+
+/*******************************************************************************
+ * Types
+ ******************************************************************************/
+/* Subscriber callback. It is called from the dispatcher task with a copy of the
+ * event data, which is valid only for the duration of the call.
+ */
+typedef void (*network_event_subscriber_t)(cy_wcm_event_t event,
+                                           const cy_wcm_event_data_t *event_data,
+                                           void *arg);
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_rslt_t network_event_dispatcher_init(void);
+cy_rslt_t network_event_subscribe(network_event_subscriber_t subscriber, uint32_t event_mask, void *arg);
+void network_event_unsubscribe(network_event_subscriber_t subscriber);
+uint32_t network_event_get_dropped_count(void);
+
+#endif /*SOURCE_NETWORK_EVENT_DISPATCHER_H_*/
+
+
+/* [] END OF FILE */
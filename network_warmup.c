@@ -0,0 +1,763 @@
+/*******************************************************************************
+* File Name: network_warmup.c
+*
+* Description: This file contains the post-connect network warm-up. When the
+* IP address is assigned, the DNS lookups, the gateway ARP request, and the
+* SNTP request are all started at once from the lwIP thread, so their round
+* trips overlap instead of being paid one after another by the first
+* application request. The device is marked traffic-ready when all of them
+* have completed or timed out.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <string.h>
+
+/* FreeRTOS includes */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "event_groups.h"
+
+/* lwIP includes */
+#include "lwip/tcpip.h"
+#include "lwip/dns.h"
+#include "lwip/etharp.h"
+#include "lwip/udp.h"
+#include "lwip/pbuf.h"
+
+#include "wps_enrollee_task.h"
+#include "conn_journal.h"
+#include "connection_state.h"
+#include "network_event_dispatcher.h"
+#include "provisioning_relay.h"
+#include "network_warmup.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define WARMUP_BIT_START                    ((EventBits_t)1u << 0)
+#define WARMUP_BIT_DNS_DONE                 ((EventBits_t)1u << 1)
+#define WARMUP_BIT_ARP_DONE                 ((EventBits_t)1u << 2)
+#define WARMUP_BIT_SNTP_DONE                ((EventBits_t)1u << 3)
+#define WARMUP_BIT_TRAFFIC_READY            ((EventBits_t)1u << 4)
+#define WARMUP_DONE_BITS                    (WARMUP_BIT_DNS_DONE | WARMUP_BIT_ARP_DONE | WARMUP_BIT_SNTP_DONE)
+
+/* DNS callback argument: the run it belongs to and the job. Answers for an
+ * earlier run are ignored.
+ */
+#define WARMUP_JOB_HOST                     (0u)
+#define WARMUP_JOB_SNTP_SERVER              (1u)
+#define WARMUP_DNS_ARG(run, job)            ((void *)(uintptr_t)(((run) << 1) | (job)))
+#define WARMUP_DNS_ARG_RUN(arg)             ((uint32_t)(uintptr_t)(arg) >> 1)
+#define WARMUP_DNS_ARG_JOB(arg)             ((uint32_t)(uintptr_t)(arg) & 1u)
+
+/* SNTP (RFC 4330) message. */
+#define SNTP_MESSAGE_SIZE                   (48u)
+#define SNTP_LI_VN_MODE_CLIENT              (0x1Bu)     /* No warning, version 3, client */
+#define SNTP_MODE_MASK                      (0x07u)
+#define SNTP_MODE_SERVER                    (4u)
+#define SNTP_STRATUM_OFFSET                 (1u)
+#define SNTP_ORIGINATE_TIME_OFFSET          (24u)
+#define SNTP_TRANSMIT_TIME_OFFSET           (40u)
+#define SNTP_TIMESTAMP_SIZE                 (8u)
+
+/* Seconds from 1900 (NTP epoch) to 1970 (Unix epoch). */
+#define SNTP_UNIX_EPOCH_OFFSET              (2208988800uL)
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static EventGroupHandle_t warmup_event_group = NULL;
+static network_warmup_stats_t stats;
+
+/* Incremented at the start of every warm-up. Accessed from the lwIP thread. */
+static volatile uint32_t warmup_run = 0;
+
+static struct udp_pcb *sntp_pcb = NULL;
+
+/* Server and transmit timestamp of the outstanding SNTP request. The server
+ * copies the transmit timestamp into the originate timestamp of its response,
+ * so a response that does not carry it does not answer this request. Accessed
+ * from the lwIP thread only.
+ */
+static ip_addr_t sntp_server_address;
+static uint8_t sntp_request_timestamp[SNTP_TIMESTAMP_SIZE];
+static bool is_sntp_request_pending = false;
+
+/* IPv4 address the last warm-up was started for, 0 after a link loss.
+ * Accessed from the network event dispatcher task only.
+ */
+static uint32_t warmup_ipv4_address = 0;
+
+/* Tick count of the last IP address assignment, and whether an application
+ * request has succeeded since then.
+ */
+static TickType_t ip_assigned_tick = 0;
+static bool is_first_request_pending = false;
+
+/* Time received from the SNTP server and the tick count at reception. */
+static uint32_t sntp_unix_time = 0;
+static TickType_t sntp_sync_tick = 0;
+static bool is_time_synchronized = false;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static void network_warmup_task(void *arg);
+static void run_warmup(void);
+static void request_warmup(void);
+static void start_requests(void *arg);
+static void warmup_dns_callback(const char *name, const ip_addr_t *ipaddr, void *arg);
+static void send_sntp_request(const ip_addr_t *server);
+static void sntp_receive_callback(void *arg, struct udp_pcb *pcb, struct pbuf *p,
+                                  const ip_addr_t *addr, uint16_t port);
+static bool poll_gateway_arp(bool is_request_needed);
+static void network_event_callback(cy_wcm_event_t event, const cy_wcm_event_data_t *event_data, void *arg);
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: network_warmup_init
+ *******************************************************************************
+ * Summary: Creates the warm-up task and subscribes to the IP address and link
+ * events. The network event dispatcher must be started before calling this
+ * function.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS on success, NETWORK_WARMUP_RSLT_NO_MEMORY or the
+ *  subscription error otherwise.
+ *
+ ******************************************************************************/
+cy_rslt_t network_warmup_init(void)
+{
+    memset(&stats, 0, sizeof(stats));
+
+    warmup_event_group = xEventGroupCreate();
+    if (NULL == warmup_event_group)
+    {
+        return NETWORK_WARMUP_RSLT_NO_MEMORY;
+    }
+
+    if (pdPASS != xTaskCreate(network_warmup_task, "Network warm-up", NETWORK_WARMUP_TASK_STACK_SIZE,
+                              NULL, NETWORK_WARMUP_TASK_PRIORITY, NULL))
+    {
+        return NETWORK_WARMUP_RSLT_NO_MEMORY;
+    }
+
+    return network_event_subscribe(network_event_callback,
+                                   NETWORK_EVENT_MASK(CY_WCM_EVENT_CONNECTED) |
+                                   NETWORK_EVENT_MASK(CY_WCM_EVENT_IP_CHANGED) |
+                                   NETWORK_EVENT_MASK(CY_WCM_EVENT_RECONNECTED) |
+                                   NETWORK_EVENT_MASK(CY_WCM_EVENT_DISCONNECTED), NULL);
+}
+
+
+/*******************************************************************************
+ * Function Name: network_warmup_is_traffic_ready
+ *******************************************************************************
+ * Summary: Checks whether the warm-up after the last IP address assignment has
+ * finished.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  bool: true if the device is traffic-ready.
+ *
+ ******************************************************************************/
+bool network_warmup_is_traffic_ready(void)
+{
+    return (NULL != warmup_event_group) &&
+           (0u != (xEventGroupGetBits(warmup_event_group) & WARMUP_BIT_TRAFFIC_READY));
+}
+
+
+/*******************************************************************************
+ * Function Name: network_warmup_wait_traffic_ready
+ *******************************************************************************
+ * Summary: Blocks the calling task until the device is traffic-ready.
+ *
+ * Parameters:
+ *  uint32_t timeout_ms: Maximum time to wait.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the device is traffic-ready,
+ *  NETWORK_WARMUP_RSLT_TIMEOUT otherwise.
+ *
+ ******************************************************************************/
+cy_rslt_t network_warmup_wait_traffic_ready(uint32_t timeout_ms)
+{
+    EventBits_t bits;
+
+    if (NULL == warmup_event_group)
+    {
+        return NETWORK_WARMUP_RSLT_TIMEOUT;
+    }
+
+    bits = xEventGroupWaitBits(warmup_event_group, WARMUP_BIT_TRAFFIC_READY, pdFALSE, pdTRUE,
+                               pdMS_TO_TICKS(timeout_ms));
+
+    return (0u != (bits & WARMUP_BIT_TRAFFIC_READY)) ? CY_RSLT_SUCCESS : NETWORK_WARMUP_RSLT_TIMEOUT;
+}
+
+
+/*******************************************************************************
+ * Function Name: network_warmup_get_time
+ *******************************************************************************
+ * Summary: Returns the current time based on the last SNTP response.
+ *
+ * Parameters:
+ *  uint32_t *unix_time: Filled with the seconds since 1 January 1970 UTC.
+ *
+ * Return:
+ *  bool: false if the time has not been received yet.
+ *
+ ******************************************************************************/
+bool network_warmup_get_time(uint32_t *unix_time)
+{
+    bool is_synchronized;
+
+    taskENTER_CRITICAL();
+    is_synchronized = is_time_synchronized;
+    *unix_time = sntp_unix_time + (((xTaskGetTickCount() - sntp_sync_tick) * portTICK_PERIOD_MS) / 1000u);
+    taskEXIT_CRITICAL();
+
+    return is_synchronized;
+}
+
+
+/*******************************************************************************
+ * Function Name: network_warmup_get_stats
+ *******************************************************************************
+ * Summary: Copies the warm-up statistics.
+ *
+ * Parameters:
+ *  network_warmup_stats_t *stats_copy: Filled with the statistics.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void network_warmup_get_stats(network_warmup_stats_t *stats_copy)
+{
+    taskENTER_CRITICAL();
+    memcpy(stats_copy, &stats, sizeof(network_warmup_stats_t));
+    taskEXIT_CRITICAL();
+}
+
+
+/*******************************************************************************
+ * Function Name: network_warmup_note_request_success
+ *******************************************************************************
+ * Summary: Called by the application after each request to its server that
+ * succeeds, such as an HTTP or MQTT exchange. The first call after the device
+ * becomes traffic-ready records the time from the IP address assignment to
+ * that call as the time to the first successful request. The other calls
+ * only return.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void network_warmup_note_request_success(void)
+{
+    if (!network_warmup_is_traffic_ready())
+    {
+        return;
+    }
+
+    taskENTER_CRITICAL();
+    if (is_first_request_pending)
+    {
+        is_first_request_pending = false;
+        stats.last_first_request_time_ms = (xTaskGetTickCount() - ip_assigned_tick) * portTICK_PERIOD_MS;
+        if (0u == stats.last_first_request_time_ms)
+        {
+            stats.last_first_request_time_ms = 1u;
+        }
+    }
+    taskEXIT_CRITICAL();
+}
+
+
+/*******************************************************************************
+ * Function Name: network_warmup_task
+ *******************************************************************************
+ * Summary: Runs a warm-up every time one is requested.
+ *
+ * Parameters:
+ *  void *arg: Task parameter defined during task creation (unused).
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void network_warmup_task(void *arg)
+{
+    while (true)
+    {
+        xEventGroupWaitBits(warmup_event_group, WARMUP_BIT_START, pdTRUE, pdFALSE, portMAX_DELAY);
+        run_warmup();
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: run_warmup
+ *******************************************************************************
+ * Summary: Starts all the configured steps in the lwIP thread and waits until
+ * they complete or NETWORK_WARMUP_TIMEOUT_MSEC elapses. The gateway ARP entry
+ * has no completion callback, so the ARP cache is polled.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void run_warmup(void)
+{
+    TickType_t start_time;
+    TickType_t last_arp_request;
+    TickType_t timeout = pdMS_TO_TICKS(NETWORK_WARMUP_TIMEOUT_MSEC);
+    TickType_t elapsed = 0;
+    uint32_t pending = NETWORK_WARMUP_STEPS;
+    uint32_t completed = 0;
+    uint32_t step_time_ms[3] = { 0, 0, 0 };
+    uint32_t first_step_ms = 0;
+    bool is_arp_retry;
+    EventBits_t bits;
+
+    taskENTER_CRITICAL();
+    start_time = ip_assigned_tick;
+    taskEXIT_CRITICAL();
+    last_arp_request = xTaskGetTickCount();
+
+    xEventGroupClearBits(warmup_event_group, WARMUP_DONE_BITS | WARMUP_BIT_TRAFFIC_READY);
+    warmup_run++;
+
+    if ((0u != pending) && (ERR_OK != tcpip_callback(start_requests, NULL)))
+    {
+        pending = 0;
+    }
+
+    while ((0u != pending) && (elapsed < timeout))
+    {
+        bits = xEventGroupWaitBits(warmup_event_group, WARMUP_DONE_BITS, pdFALSE, pdFALSE,
+                                   pdMS_TO_TICKS(NETWORK_WARMUP_ARP_POLL_MSEC));
+        elapsed = xTaskGetTickCount() - start_time;
+
+        if (0u != (pending & NETWORK_WARMUP_STEP_ARP))
+        {
+            is_arp_retry = ((xTaskGetTickCount() - last_arp_request) >= pdMS_TO_TICKS(NETWORK_WARMUP_ARP_RETRY_MSEC));
+            if (is_arp_retry)
+            {
+                last_arp_request = xTaskGetTickCount();
+            }
+
+            if (poll_gateway_arp(is_arp_retry))
+            {
+                bits |= WARMUP_BIT_ARP_DONE;
+            }
+        }
+
+        /* Record the time of each step when its completion is first seen. */
+        for (uint32_t step = 0; step < 3u; step++)
+        {
+            uint32_t step_mask = (1uL << step);
+
+            if ((0u != (pending & step_mask)) && (0u != (bits & (WARMUP_BIT_DNS_DONE << step))))
+            {
+                pending &= ~step_mask;
+                completed |= step_mask;
+                step_time_ms[step] = elapsed * portTICK_PERIOD_MS;
+
+                if (0u == first_step_ms)
+                {
+                    first_step_ms = (0u != step_time_ms[step]) ? step_time_ms[step] : 1u;
+                }
+            }
+        }
+    }
+
+    taskENTER_CRITICAL();
+    stats.runs++;
+    stats.timeouts += (0u != pending) ? 1u : 0u;
+    stats.last_completed_steps = completed;
+    stats.last_dns_time_ms = step_time_ms[0];
+    stats.last_arp_time_ms = step_time_ms[1];
+    stats.last_sntp_time_ms = step_time_ms[2];
+    stats.last_first_step_time_ms = first_step_ms;
+    stats.last_traffic_ready_time_ms = (xTaskGetTickCount() - start_time) * portTICK_PERIOD_MS;
+    taskEXIT_CRITICAL();
+
+    if (0u != pending)
+    {
+        ERR_INFO(("Network warm-up steps 0x%lx did not complete.\n", (unsigned long)pending));
+    }
+
+    APP_INFO(("Traffic-ready in %lu ms (first step %lu ms).\n",
+              (unsigned long)stats.last_traffic_ready_time_ms, (unsigned long)first_step_ms));
+    conn_journal_append(CONN_JOURNAL_EVENT_TRAFFIC_READY, (uint8_t)completed, stats.last_traffic_ready_time_ms);
+
+    /* A new IP address may have been assigned during the warm-up. In that
+     * case, the device becomes traffic-ready after the next warm-up.
+     */
+    if (0u == (xEventGroupGetBits(warmup_event_group) & WARMUP_BIT_START))
+    {
+        xEventGroupSetBits(warmup_event_group, WARMUP_BIT_TRAFFIC_READY);
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: start_requests
+ *******************************************************************************
+ * Summary: Starts the DNS lookups and the gateway ARP request. Runs in the
+ * lwIP thread. A host name already in the DNS cache completes immediately.
+ *
+ * Parameters:
+ *  void *arg: Unused.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void start_requests(void *arg)
+{
+    ip_addr_t address;
+    err_t err;
+    uint32_t run = warmup_run;
+
+    if (0u != (NETWORK_WARMUP_STEPS & NETWORK_WARMUP_STEP_DNS))
+    {
+        err = dns_gethostbyname(NETWORK_WARMUP_DNS_HOSTNAME, &address, warmup_dns_callback,
+                                WARMUP_DNS_ARG(run, WARMUP_JOB_HOST));
+        if (ERR_OK == err)
+        {
+            xEventGroupSetBits(warmup_event_group, WARMUP_BIT_DNS_DONE);
+        }
+    }
+
+    if ((0u != (NETWORK_WARMUP_STEPS & NETWORK_WARMUP_STEP_ARP)) && (NULL != netif_default))
+    {
+        etharp_request(netif_default, netif_ip4_gw(netif_default));
+    }
+
+    if (0u != (NETWORK_WARMUP_STEPS & NETWORK_WARMUP_STEP_SNTP))
+    {
+        err = dns_gethostbyname(NETWORK_WARMUP_SNTP_SERVER, &address, warmup_dns_callback,
+                                WARMUP_DNS_ARG(run, WARMUP_JOB_SNTP_SERVER));
+        if (ERR_OK == err)
+        {
+            send_sntp_request(&address);
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: warmup_dns_callback
+ *******************************************************************************
+ * Summary: Completes the DNS step, or sends the SNTP request when the address
+ * of the SNTP server is resolved. Runs in the lwIP thread.
+ *
+ * Parameters:
+ *  const char *name: Resolved host name.
+ *  const ip_addr_t *ipaddr: Address of the host, or NULL if not found.
+ *  void *arg: Run and job encoded with WARMUP_DNS_ARG().
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void warmup_dns_callback(const char *name, const ip_addr_t *ipaddr, void *arg)
+{
+    if ((NULL == ipaddr) || (WARMUP_DNS_ARG_RUN(arg) != (warmup_run & (UINT32_MAX >> 1))))
+    {
+        return;
+    }
+
+    if (WARMUP_JOB_HOST == WARMUP_DNS_ARG_JOB(arg))
+    {
+        xEventGroupSetBits(warmup_event_group, WARMUP_BIT_DNS_DONE);
+    }
+    else
+    {
+        send_sntp_request(ipaddr);
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: send_sntp_request
+ *******************************************************************************
+ * Summary: Sends an SNTP client request to the server. Runs in the lwIP
+ * thread.
+ *
+ * Parameters:
+ *  const ip_addr_t *server: Address of the SNTP server.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void send_sntp_request(const ip_addr_t *server)
+{
+    struct pbuf *p;
+    uint32_t nonce;
+
+    if (NULL == sntp_pcb)
+    {
+        sntp_pcb = udp_new();
+        if (NULL == sntp_pcb)
+        {
+            return;
+        }
+        udp_recv(sntp_pcb, sntp_receive_callback, NULL);
+    }
+
+    p = pbuf_alloc(PBUF_TRANSPORT, SNTP_MESSAGE_SIZE, PBUF_RAM);
+    if (NULL == p)
+    {
+        return;
+    }
+
+    /* The client time is not known yet, so the transmit timestamp is random
+     * (RFC 4330 section 5) and only serves to match the response.
+     */
+    nonce = LWIP_RAND();
+    memcpy(&sntp_request_timestamp[0], &nonce, sizeof(nonce));
+    nonce = LWIP_RAND();
+    memcpy(&sntp_request_timestamp[sizeof(nonce)], &nonce, sizeof(nonce));
+
+    memset(p->payload, 0, SNTP_MESSAGE_SIZE);
+    ((uint8_t *)p->payload)[0] = SNTP_LI_VN_MODE_CLIENT;
+    memcpy(&((uint8_t *)p->payload)[SNTP_TRANSMIT_TIME_OFFSET], sntp_request_timestamp, SNTP_TIMESTAMP_SIZE);
+
+    ip_addr_copy(sntp_server_address, *server);
+    is_sntp_request_pending = (ERR_OK == udp_sendto(sntp_pcb, p, server, NETWORK_WARMUP_SNTP_PORT));
+    pbuf_free(p);
+}
+
+
+/*******************************************************************************
+ * Function Name: sntp_receive_callback
+ *******************************************************************************
+ * Summary: Stores the time of a valid SNTP server response and completes the
+ * SNTP step. Only the first response from the server and port the request was
+ * sent to, carrying the transmit timestamp of the request as its originate
+ * timestamp, is accepted. Runs in the lwIP thread.
+ *
+ * Parameters:
+ *  void *arg: Unused.
+ *  struct udp_pcb *pcb: SNTP PCB.
+ *  struct pbuf *p: Received message.
+ *  const ip_addr_t *addr: Address of the sender.
+ *  uint16_t port: Port of the sender.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void sntp_receive_callback(void *arg, struct udp_pcb *pcb, struct pbuf *p,
+                                  const ip_addr_t *addr, uint16_t port)
+{
+    uint8_t message[SNTP_MESSAGE_SIZE];
+    uint32_t ntp_seconds;
+
+    if (is_sntp_request_pending &&
+        (NETWORK_WARMUP_SNTP_PORT == port) && ip_addr_cmp(addr, &sntp_server_address) &&
+        (SNTP_MESSAGE_SIZE == pbuf_copy_partial(p, message, SNTP_MESSAGE_SIZE, 0)) &&
+        (0 == memcmp(&message[SNTP_ORIGINATE_TIME_OFFSET], sntp_request_timestamp, SNTP_TIMESTAMP_SIZE)) &&
+        (SNTP_MODE_SERVER == (message[0] & SNTP_MODE_MASK)) &&
+        (0u != message[SNTP_STRATUM_OFFSET]))
+    {
+        ntp_seconds = ((uint32_t)message[SNTP_TRANSMIT_TIME_OFFSET] << 24) |
+                      ((uint32_t)message[SNTP_TRANSMIT_TIME_OFFSET + 1u] << 16) |
+                      ((uint32_t)message[SNTP_TRANSMIT_TIME_OFFSET + 2u] << 8) |
+                      (uint32_t)message[SNTP_TRANSMIT_TIME_OFFSET + 3u];
+        is_sntp_request_pending = false;
+
+        taskENTER_CRITICAL();
+        sntp_unix_time = ntp_seconds - SNTP_UNIX_EPOCH_OFFSET;
+        sntp_sync_tick = xTaskGetTickCount();
+        is_time_synchronized = true;
+        taskEXIT_CRITICAL();
+
+        xEventGroupSetBits(warmup_event_group, WARMUP_BIT_SNTP_DONE);
+    }
+
+    pbuf_free(p);
+}
+
+
+/*******************************************************************************
+ * Function Name: poll_gateway_arp
+ *******************************************************************************
+ * Summary: Checks whether the MAC address of the gateway is in the ARP cache
+ * and repeats the ARP request if needed.
+ *
+ * Parameters:
+ *  bool is_request_needed: true to send a new ARP request if the entry is
+ *  not yet resolved.
+ *
+ * Return:
+ *  bool: true if the gateway entry is resolved.
+ *
+ ******************************************************************************/
+static bool poll_gateway_arp(bool is_request_needed)
+{
+    struct eth_addr *eth_address;
+    const ip4_addr_t *ip_address;
+    bool is_resolved = false;
+
+    LOCK_TCPIP_CORE();
+    if (NULL != netif_default)
+    {
+        is_resolved = (etharp_find_addr(netif_default, netif_ip4_gw(netif_default),
+                                        &eth_address, &ip_address) >= 0);
+        if (!is_resolved && is_request_needed)
+        {
+            etharp_request(netif_default, netif_ip4_gw(netif_default));
+        }
+    }
+    UNLOCK_TCPIP_CORE();
+
+    return is_resolved;
+}
+
+
+/*******************************************************************************
+ * Function Name: request_warmup
+ *******************************************************************************
+ * Summary: Records the time of the IP address assignment and requests a
+ * warm-up. A request made during a warm-up runs after it.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void request_warmup(void)
+{
+    if (NULL != warmup_event_group)
+    {
+        xEventGroupClearBits(warmup_event_group, WARMUP_BIT_TRAFFIC_READY);
+
+        taskENTER_CRITICAL();
+        ip_assigned_tick = xTaskGetTickCount();
+        is_first_request_pending = true;
+        stats.last_first_request_time_ms = 0u;
+        taskEXIT_CRITICAL();
+
+        xEventGroupSetBits(warmup_event_group, WARMUP_BIT_START);
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: network_event_callback
+ *******************************************************************************
+ * Summary: Starts a warm-up when the device connects, the link is restored, or
+ * the IPv4 address changes, and clears the traffic-ready state when the link
+ * is lost. This is the only place where warm-ups are started. The WCM may
+ * report the same address with more than one of these events, so a warm-up
+ * is started only for an address that has not been warmed up since the last
+ * link loss. The steps use IPv4 only, so IPv6 address changes are ignored, and
+ * so are the addresses of the provisioning relay subnet.
+ *
+ * Parameters:
+ *  cy_wcm_event_t event: WCM event.
+ *  const cy_wcm_event_data_t *event_data: New address for
+ *  CY_WCM_EVENT_IP_CHANGED.
+ *  void *arg: Subscriber argument (unused).
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void network_event_callback(cy_wcm_event_t event, const cy_wcm_event_data_t *event_data, void *arg)
+{
+    cy_wcm_ip_address_t ip_address;
+
+    if (CY_WCM_EVENT_DISCONNECTED == event)
+    {
+        warmup_ipv4_address = 0;
+        xEventGroupClearBits(warmup_event_group, WARMUP_BIT_TRAFFIC_READY);
+        return;
+    }
+
+    if (CY_WCM_EVENT_IP_CHANGED == event)
+    {
+        ip_address = event_data->ip_addr;
+    }
+    else if (CY_RSLT_SUCCESS != cy_wcm_get_ip_addr(CY_WCM_INTERFACE_TYPE_STA, &ip_address))
+    {
+        return;
+    }
+
+    /* A join to a provisioning relay to request the credential is not a
+     * connection to the AP network.
+     */
+    if ((CY_WCM_IP_VER_V4 == ip_address.version) && (0u != ip_address.ip.v4) &&
+        !provisioning_relay_is_relay_network(ip_address.ip.v4) &&
+        (warmup_ipv4_address != ip_address.ip.v4))
+    {
+        warmup_ipv4_address = ip_address.ip.v4;
+        request_warmup();
+    }
+}
+
+
+/* [] END OF FILE */
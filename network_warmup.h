@@ -0,0 +1,138 @@
+/*******************************************************************************
+* File Name: network_warmup.h
+*
+* Description: This file includes the macros, structures, and function
+* prototypes of the post-connect network warm-up used in network_warmup.c
+*
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ *  Include guard
+ ******************************************************************************/
+#ifndef SOURCE_NETWORK_WARMUP_H_
+#define SOURCE_NETWORK_WARMUP_H_
+
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "cy_result.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Warm-up steps. */
+#define NETWORK_WARMUP_STEP_DNS             (0x01u)     /* Resolve NETWORK_WARMUP_DNS_HOSTNAME */
+#define NETWORK_WARMUP_STEP_ARP             (0x02u)     /* Resolve the MAC address of the gateway */
+#define NETWORK_WARMUP_STEP_SNTP            (0x04u)     /* Get the time from NETWORK_WARMUP_SNTP_SERVER */
+
+/* Steps run after every IP address assignment. Set to 0 to mark the device
+ * traffic-ready as soon as the IP address is assigned.
+ */
+#define NETWORK_WARMUP_STEPS                (NETWORK_WARMUP_STEP_DNS | NETWORK_WARMUP_STEP_ARP | \
+                                             NETWORK_WARMUP_STEP_SNTP)
+
+/* Host name of the server the application talks to. Resolving it fills the
+ * lwIP DNS cache before the first request.
+ */
+#define NETWORK_WARMUP_DNS_HOSTNAME         "www.infineon.com"
+
+/* SNTP server, resolved in parallel with NETWORK_WARMUP_DNS_HOSTNAME. */
+#define NETWORK_WARMUP_SNTP_SERVER          "pool.ntp.org"
+#define NETWORK_WARMUP_SNTP_PORT            (123u)
+
+/* Maximum time in milliseconds for all the steps. Steps that have not
+ * completed by then are reported as failed and the device is marked
+ * traffic-ready.
+ */
+#define NETWORK_WARMUP_TIMEOUT_MSEC         (5000u)
+
+/* Interval in milliseconds at which the ARP cache is checked and at which the
+ * ARP request is repeated.
+ */
+#define NETWORK_WARMUP_ARP_POLL_MSEC        (20u)
+#define NETWORK_WARMUP_ARP_RETRY_MSEC       (500u)
+
+#define NETWORK_WARMUP_TASK_STACK_SIZE      (2048u)
+#define NETWORK_WARMUP_TASK_PRIORITY        (2u)
+
+/* Warm-up result codes. */
+#define NETWORK_WARMUP_RSLT_MODULE          (CY_RSLT_MODULE_MIDDLEWARE_BASE + 0xF6u)
+#define NETWORK_WARMUP_RSLT_NO_MEMORY       CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, NETWORK_WARMUP_RSLT_MODULE, 1u)
+#define NETWORK_WARMUP_RSLT_TIMEOUT         CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, NETWORK_WARMUP_RSLT_MODULE, 2u)
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Warm-up statistics. The times are measured from the last IP address
+ * assignment, which starts the warm-up. A step time of 0 means that the step
+ * did not complete, and a first request time of 0 means that no request has
+ * succeeded since the assignment.
+ */
+typedef struct
+{
+    uint32_t runs;
+    uint32_t timeouts;
+    uint32_t last_completed_steps;
+    uint32_t last_dns_time_ms;
+    uint32_t last_arp_time_ms;
+    uint32_t last_sntp_time_ms;
+    uint32_t last_first_step_time_ms;      /* First step to complete */
+    uint32_t last_traffic_ready_time_ms;
+    uint32_t last_first_request_time_ms;   /* First successful application request */
+} network_warmup_stats_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_rslt_t network_warmup_init(void);
+bool network_warmup_is_traffic_ready(void);
+cy_rslt_t network_warmup_wait_traffic_ready(uint32_t timeout_ms);
+bool network_warmup_get_time(uint32_t *unix_time);
+void network_warmup_get_stats(network_warmup_stats_t *stats_copy);
+void network_warmup_note_request_success(void);
+
+#endif /*SOURCE_NETWORK_WARMUP_H_*/
+
+
+/* [] END OF FILE */
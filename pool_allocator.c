@@ -0,0 +1,615 @@
+/*******************************************************************************
+* File Name: pool_allocator.c
+*
+* Description: This file contains the FreeRTOS heap of the application. It
+* replaces heap_3. Requests are served from fixed-size blocks of the smallest
+* size class that fits, so allocation and free take constant time and blocks
+* freed during one WPS or connection cycle are reused as is by the next one,
+* instead of fragmenting a general-purpose heap. A request whose size class is
+* full is served by the next larger class. Requests larger than the largest
+* class, and requests for which all the suitable classes are full, are served
+* by the C library heap as heap_3 does. mbedTLS allocates through
+* pvPortCalloc() and vPortFree() (see main.c). lwIP allocates as configured in
+* the lwipopts.h of the wifi-core-freertos-lwip-mbedtls library and does not
+* use this allocator.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "cy_utils.h"
+
+/* FreeRTOS includes */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "pool_allocator.h"
+
+#if (configHEAP_ALLOCATION_SCHEME == NO_HEAP_ALLOCATION)
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define POOL_CLASS_ARENA_SIZE(size, blocks)     + ((size) * (blocks))
+#define POOL_CLASS_BLOCK_COUNT(size, blocks)    + (blocks)
+#define POOL_CLASS_CONFIG(size, blocks)         { (size), (blocks) },
+
+#define POOL_ARENA_SIZE                     (0u POOL_ALLOCATOR_CLASSES(POOL_CLASS_ARENA_SIZE))
+#define POOL_TOTAL_BLOCKS                   (0u POOL_ALLOCATOR_CLASSES(POOL_CLASS_BLOCK_COUNT))
+
+#if defined(__GNUC__)
+#define POOL_CALLER_ADDRESS()               __builtin_return_address(0)
+#else
+#define POOL_CALLER_ADDRESS()               (NULL)
+#endif
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* A free block holds the link to the next free block of its class. */
+typedef struct pool_free_block
+{
+    struct pool_free_block *next;
+} pool_free_block_t;
+
+typedef struct
+{
+    uint8_t                      *start;
+    uint8_t                      *end;
+    uint32_t                     first_block;   /* Index of the first block in requested_sizes */
+    pool_free_block_t            *free_list;
+    pool_allocator_class_stats_t stats;
+} pool_class_t;
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static const uint32_t class_config[POOL_ALLOCATOR_CLASS_COUNT][2] =
+{
+    POOL_ALLOCATOR_CLASSES(POOL_CLASS_CONFIG)
+};
+
+static CY_ALIGN(portBYTE_ALIGNMENT) uint8_t pool_arena[POOL_ARENA_SIZE];
+
+/* Requested size of every block in use. */
+static uint16_t requested_sizes[POOL_TOTAL_BLOCKS];
+
+static pool_class_t pool_classes[POOL_ALLOCATOR_CLASS_COUNT];
+static pool_allocator_heap_stats_t heap_stats;
+static bool is_pool_initialized = false;
+
+#if (POOL_ALLOCATOR_TRACE_ENABLE)
+static pool_allocator_trace_entry_t trace_buffer[POOL_ALLOCATOR_TRACE_DEPTH];
+static uint32_t trace_count = 0;
+static bool is_trace_enabled = false;
+#endif
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static void *allocate(size_t wanted_size, void *caller);
+static void pool_init(void);
+static pool_class_t* find_class(const void *block);
+static void record_trace(pool_allocator_trace_op_t op, void *address, uint32_t size, void *caller);
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: pvPortMalloc
+ *******************************************************************************
+ * Summary: Allocates a block from the smallest size class that fits the
+ * request and is not full, or from the C library heap.
+ *
+ * Parameters:
+ *  size_t wanted_size: Number of bytes requested.
+ *
+ * Return:
+ *  void*: Allocated memory, aligned to portBYTE_ALIGNMENT, or NULL if no
+ *  memory is available or wanted_size is 0.
+ *
+ ******************************************************************************/
+void *pvPortMalloc(size_t wanted_size)
+{
+    return allocate(wanted_size, POOL_CALLER_ADDRESS());
+}
+
+
+/*******************************************************************************
+ * Function Name: pvPortCalloc
+ *******************************************************************************
+ * Summary: Allocates zeroed memory for an array as pvPortMalloc() does, and
+ * records its own caller in the trace. It is the allocator installed for
+ * mbedTLS with mbedtls_platform_set_calloc_free().
+ *
+ * Parameters:
+ *  size_t count: Number of elements.
+ *  size_t size: Size of an element in bytes.
+ *
+ * Return:
+ *  void*: Zeroed memory, or NULL if no memory is available, the total size
+ *  is 0, or it overflows size_t.
+ *
+ ******************************************************************************/
+void *pvPortCalloc(size_t count, size_t size)
+{
+    void *block = NULL;
+
+    if ((0u != size) && (count <= (SIZE_MAX / size)))
+    {
+        block = allocate(count * size, POOL_CALLER_ADDRESS());
+    }
+
+    if (NULL != block)
+    {
+        memset(block, 0, count * size);
+    }
+
+    return block;
+}
+
+
+/*******************************************************************************
+ * Function Name: vPortFree
+ *******************************************************************************
+ * Summary: Returns a block to its size class, or to the C library heap.
+ *
+ * Parameters:
+ *  void *pv: Memory returned by pvPortMalloc(), or NULL.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void vPortFree(void *pv)
+{
+    void *caller = POOL_CALLER_ADDRESS();
+    pool_class_t *pool_class;
+    uint32_t block_index;
+
+    if (NULL == pv)
+    {
+        return;
+    }
+
+    vTaskSuspendAll();
+    {
+        pool_class = find_class(pv);
+
+        if (NULL != pool_class)
+        {
+            block_index = pool_class->first_block + (((uint8_t *)pv - pool_class->start) / pool_class->stats.block_size);
+
+            pool_class->stats.blocks_in_use--;
+            pool_class->stats.requested_bytes_in_use -= requested_sizes[block_index];
+            requested_sizes[block_index] = 0;
+
+            ((pool_free_block_t *)pv)->next = pool_class->free_list;
+            pool_class->free_list = (pool_free_block_t *)pv;
+        }
+        else
+        {
+            free(pv);
+        }
+
+        traceFREE(pv, 0);
+        record_trace(POOL_ALLOCATOR_TRACE_FREE, pv, 0, caller);
+    }
+    (void)xTaskResumeAll();
+}
+
+
+/*******************************************************************************
+ * Function Name: pool_allocator_get_class_stats
+ *******************************************************************************
+ * Summary: Copies the statistics of a size class.
+ *
+ * Parameters:
+ *  uint32_t class_index: Index of the class, less than
+ *  POOL_ALLOCATOR_CLASS_COUNT.
+ *  pool_allocator_class_stats_t *stats_copy: Filled with the statistics.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void pool_allocator_get_class_stats(uint32_t class_index, pool_allocator_class_stats_t *stats_copy)
+{
+    memset(stats_copy, 0, sizeof(pool_allocator_class_stats_t));
+
+    if (class_index < POOL_ALLOCATOR_CLASS_COUNT)
+    {
+        vTaskSuspendAll();
+        if (!is_pool_initialized)
+        {
+            pool_init();
+        }
+        memcpy(stats_copy, &pool_classes[class_index].stats, sizeof(pool_allocator_class_stats_t));
+        (void)xTaskResumeAll();
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: pool_allocator_get_heap_stats
+ *******************************************************************************
+ * Summary: Copies the statistics of the requests served by the C library
+ * heap.
+ *
+ * Parameters:
+ *  pool_allocator_heap_stats_t *stats_copy: Filled with the statistics.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void pool_allocator_get_heap_stats(pool_allocator_heap_stats_t *stats_copy)
+{
+    vTaskSuspendAll();
+    memcpy(stats_copy, &heap_stats, sizeof(pool_allocator_heap_stats_t));
+    (void)xTaskResumeAll();
+}
+
+
+/*******************************************************************************
+ * Function Name: pool_allocator_set_trace
+ *******************************************************************************
+ * Summary: Starts or stops recording the allocations and frees. Starting
+ * clears the trace buffer. Has no effect if POOL_ALLOCATOR_TRACE_ENABLE is 0.
+ *
+ * Parameters:
+ *  bool is_enabled: true to start recording.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void pool_allocator_set_trace(bool is_enabled)
+{
+    #if (POOL_ALLOCATOR_TRACE_ENABLE)
+    vTaskSuspendAll();
+    if (is_enabled && !is_trace_enabled)
+    {
+        trace_count = 0;
+    }
+    is_trace_enabled = is_enabled;
+    (void)xTaskResumeAll();
+    #else
+    (void)is_enabled;
+    #endif
+}
+
+
+/*******************************************************************************
+ * Function Name: pool_allocator_read_trace
+ *******************************************************************************
+ * Summary: Copies the newest trace entries, oldest first.
+ *
+ * Parameters:
+ *  pool_allocator_trace_entry_t *entries: Buffer for the entries.
+ *  uint32_t count: Maximum number of entries to copy.
+ *
+ * Return:
+ *  uint32_t: Number of entries copied.
+ *
+ ******************************************************************************/
+uint32_t pool_allocator_read_trace(pool_allocator_trace_entry_t *entries, uint32_t count)
+{
+    uint32_t copied = 0;
+
+    #if (POOL_ALLOCATOR_TRACE_ENABLE)
+    uint32_t available;
+    uint32_t first;
+
+    vTaskSuspendAll();
+    available = (trace_count < POOL_ALLOCATOR_TRACE_DEPTH) ? trace_count : POOL_ALLOCATOR_TRACE_DEPTH;
+    copied = (count < available) ? count : available;
+    first = trace_count - copied;
+
+    for (uint32_t index = 0; index < copied; index++)
+    {
+        entries[index] = trace_buffer[(first + index) % POOL_ALLOCATOR_TRACE_DEPTH];
+    }
+    (void)xTaskResumeAll();
+    #else
+    (void)entries;
+    (void)count;
+    #endif
+
+    return copied;
+}
+
+
+/*******************************************************************************
+ * Function Name: allocate
+ *******************************************************************************
+ * Summary: Allocates a block from the smallest size class that fits the
+ * request and is not full, or from the C library heap, and records the
+ * allocation in the trace.
+ *
+ * Parameters:
+ *  size_t wanted_size: Number of bytes requested.
+ *  void *caller: Return address of pvPortMalloc() or pvPortCalloc(), recorded
+ *  in the trace.
+ *
+ * Return:
+ *  void*: Allocated memory, aligned to portBYTE_ALIGNMENT, or NULL if no
+ *  memory is available or wanted_size is 0.
+ *
+ ******************************************************************************/
+static void *allocate(size_t wanted_size, void *caller)
+{
+    void *block = NULL;
+    bool is_native_class = true;
+    pool_class_t *pool_class;
+
+    /* A request for no memory gets none. It is not counted as a failure. */
+    if (0u == wanted_size)
+    {
+        return NULL;
+    }
+
+    vTaskSuspendAll();
+    {
+        if (!is_pool_initialized)
+        {
+            pool_init();
+        }
+
+        for (uint32_t index = 0; (index < POOL_ALLOCATOR_CLASS_COUNT) && (NULL == block); index++)
+        {
+            pool_class = &pool_classes[index];
+
+            if (wanted_size > pool_class->stats.block_size)
+            {
+                continue;
+            }
+
+            if (NULL != pool_class->free_list)
+            {
+                block = pool_class->free_list;
+                pool_class->free_list = pool_class->free_list->next;
+
+                requested_sizes[pool_class->first_block +
+                                (((uint8_t *)block - pool_class->start) / pool_class->stats.block_size)] =
+                    (uint16_t)wanted_size;
+
+                pool_class->stats.blocks_in_use++;
+                pool_class->stats.allocations++;
+                pool_class->stats.requested_bytes_in_use += (uint32_t)wanted_size;
+                if (pool_class->stats.blocks_in_use > pool_class->stats.high_water)
+                {
+                    pool_class->stats.high_water = pool_class->stats.blocks_in_use;
+                }
+            }
+            else if (is_native_class)
+            {
+                pool_class->stats.failures++;
+            }
+
+            is_native_class = false;
+        }
+
+        if (NULL == block)
+        {
+            block = malloc(wanted_size);
+
+            if (NULL == block)
+            {
+                heap_stats.failures++;
+            }
+            else if (is_native_class)
+            {
+                heap_stats.large_allocations++;
+            }
+            else
+            {
+                heap_stats.overflow_allocations++;
+            }
+        }
+
+        traceMALLOC(block, wanted_size);
+        record_trace(POOL_ALLOCATOR_TRACE_ALLOC, block, (uint32_t)wanted_size, caller);
+    }
+    (void)xTaskResumeAll();
+
+    #if (configUSE_MALLOC_FAILED_HOOK == 1)
+    if (NULL == block)
+    {
+        extern void vApplicationMallocFailedHook(void);
+        vApplicationMallocFailedHook();
+    }
+    #endif
+
+    return block;
+}
+
+
+/*******************************************************************************
+ * Function Name: pool_init
+ *******************************************************************************
+ * Summary: Splits the arena into the size classes and links the blocks of
+ * every class into its free list. Called with the scheduler suspended.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void pool_init(void)
+{
+    uint8_t *start = pool_arena;
+    uint32_t first_block = 0;
+    pool_class_t *pool_class;
+
+    memset(pool_classes, 0, sizeof(pool_classes));
+
+    for (uint32_t index = 0; index < POOL_ALLOCATOR_CLASS_COUNT; index++)
+    {
+        pool_class = &pool_classes[index];
+        pool_class->stats.block_size = class_config[index][0];
+        pool_class->stats.block_count = class_config[index][1];
+        pool_class->start = start;
+        pool_class->end = start + (pool_class->stats.block_size * pool_class->stats.block_count);
+        pool_class->first_block = first_block;
+
+        /* Link the blocks so that the lowest address is allocated first. */
+        for (uint32_t block = pool_class->stats.block_count; block > 0u; block--)
+        {
+            pool_free_block_t *free_block =
+                (pool_free_block_t *)(start + ((block - 1u) * pool_class->stats.block_size));
+            free_block->next = pool_class->free_list;
+            pool_class->free_list = free_block;
+        }
+
+        start = pool_class->end;
+        first_block += pool_class->stats.block_count;
+    }
+
+    is_pool_initialized = true;
+}
+
+
+/*******************************************************************************
+ * Function Name: find_class
+ *******************************************************************************
+ * Summary: Finds the size class a block belongs to.
+ *
+ * Parameters:
+ *  const void *block: Allocated memory.
+ *
+ * Return:
+ *  pool_class_t*: Size class, or NULL if the block is not in the arena.
+ *
+ ******************************************************************************/
+static pool_class_t* find_class(const void *block)
+{
+    const uint8_t *address = (const uint8_t *)block;
+
+    if ((address < pool_arena) || (address >= &pool_arena[POOL_ARENA_SIZE]))
+    {
+        return NULL;
+    }
+
+    for (uint32_t index = 0; index < POOL_ALLOCATOR_CLASS_COUNT; index++)
+    {
+        if (address < pool_classes[index].end)
+        {
+            return &pool_classes[index];
+        }
+    }
+
+    return NULL;
+}
+
+
+/*******************************************************************************
+ * Function Name: record_trace
+ *******************************************************************************
+ * Summary: Adds an entry to the trace buffer, overwriting the oldest one.
+ * Called with the scheduler suspended.
+ *
+ * Parameters:
+ *  pool_allocator_trace_op_t op: Allocation or free.
+ *  void *address: Allocated or freed memory.
+ *  uint32_t size: Requested size of an allocation.
+ *  void *caller: Return address of pvPortMalloc(), pvPortCalloc(), or
+ *  vPortFree().
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void record_trace(pool_allocator_trace_op_t op, void *address, uint32_t size, void *caller)
+{
+    #if (POOL_ALLOCATOR_TRACE_ENABLE)
+    pool_allocator_trace_entry_t *entry;
+
+    if (is_trace_enabled)
+    {
+        entry = &trace_buffer[trace_count % POOL_ALLOCATOR_TRACE_DEPTH];
+        entry->timestamp = (uint32_t)xTaskGetTickCount();
+        entry->address = address;
+        entry->caller = caller;
+        entry->size = size;
+        entry->op = op;
+        trace_count++;
+    }
+    #else
+    (void)op;
+    (void)address;
+    (void)size;
+    (void)caller;
+    #endif
+}
+
+#else
+
+void pool_allocator_get_class_stats(uint32_t class_index, pool_allocator_class_stats_t *stats_copy)
+{
+    memset(stats_copy, 0, sizeof(pool_allocator_class_stats_t));
+}
+
+void pool_allocator_get_heap_stats(pool_allocator_heap_stats_t *stats_copy)
+{
+    memset(stats_copy, 0, sizeof(pool_allocator_heap_stats_t));
+}
+
+void pool_allocator_set_trace(bool is_enabled)
+{
+}
+
+uint32_t pool_allocator_read_trace(pool_allocator_trace_entry_t *entries, uint32_t count)
+{
+    return 0;
+}
+
+#endif /* configHEAP_ALLOCATION_SCHEME == NO_HEAP_ALLOCATION */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,146 @@
+/*******************************************************************************
+* File Name: pool_allocator.h
+*
+* Description: This file includes the macros, structures, and function
+* prototypes of the fixed-block pool allocator used in pool_allocator.c.
+* The pool trades memory and average speed for predictability: a request
+* takes a whole block of its class, and on the host a call is slower on
+* average than heap_3, but the call time does not depend on the state of the
+* heap and freed blocks never fragment it (see tests/bench_pool_allocator.c).
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ *  Include guard
+ ******************************************************************************/
+#ifndef SOURCE_POOL_ALLOCATOR_H_
+#define SOURCE_POOL_ALLOCATOR_H_
+
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Size classes as (block size in bytes, number of blocks), in increasing
+ * order of size. The sizes must be multiples of portBYTE_ALIGNMENT. Requests
+ * larger than the largest class, such as task stacks, are served by the C
+ * library heap.
+ */
+#define POOL_ALLOCATOR_CLASSES(CLASS)       \
+    CLASS(32u,   96u)                       \
+    CLASS(64u,   64u)                       \
+    CLASS(128u,  32u)                       \
+    CLASS(256u,  16u)                       \
+    CLASS(512u,  8u)                        \
+    CLASS(1024u, 4u)
+
+#define POOL_ALLOCATOR_COUNT_CLASS(size, blocks)    + 1u
+#define POOL_ALLOCATOR_CLASS_COUNT          (0u POOL_ALLOCATOR_CLASSES(POOL_ALLOCATOR_COUNT_CLASS))
+
+/* Set to 1 to reserve the allocation trace buffer. Tracing is then started
+ * and stopped at run time with pool_allocator_set_trace().
+ */
+#define POOL_ALLOCATOR_TRACE_ENABLE         (1)
+
+/* Number of the newest allocations and frees kept in the trace buffer. */
+#define POOL_ALLOCATOR_TRACE_DEPTH          (64u)
+
+
+/*******************************************************************************
+ * Enumerations
+ ******************************************************************************/
+typedef enum
+{
+    POOL_ALLOCATOR_TRACE_ALLOC = 0,
+    POOL_ALLOCATOR_TRACE_FREE
+} pool_allocator_trace_op_t;
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Statistics of one size class. The requested bytes of the blocks in use show
+ * the internal fragmentation of the class.
+ */
+typedef struct
+{
+    uint32_t block_size;
+    uint32_t block_count;
+    uint32_t blocks_in_use;
+    uint32_t high_water;            /* Maximum blocks in use */
+    uint32_t allocations;
+    uint32_t failures;              /* Requests for this class when it was full */
+    uint32_t requested_bytes_in_use;
+} pool_allocator_class_stats_t;
+
+/* Statistics of the requests served by the C library heap. */
+typedef struct
+{
+    uint32_t large_allocations;     /* Larger than the largest class */
+    uint32_t overflow_allocations;  /* All the suitable classes were full */
+    uint32_t failures;
+} pool_allocator_heap_stats_t;
+
+typedef struct
+{
+    uint32_t                  timestamp;    /* Tick count */
+    void                      *address;
+    void                      *caller;
+    uint32_t                  size;         /* Requested size of allocations */
+    pool_allocator_trace_op_t op;
+} pool_allocator_trace_entry_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+void *pvPortCalloc(size_t count, size_t size);
+void pool_allocator_get_class_stats(uint32_t class_index, pool_allocator_class_stats_t *stats_copy);
+void pool_allocator_get_heap_stats(pool_allocator_heap_stats_t *stats_copy);
+void pool_allocator_set_trace(bool is_enabled);
+uint32_t pool_allocator_read_trace(pool_allocator_trace_entry_t *entries, uint32_t count);
+
+#endif /*SOURCE_POOL_ALLOCATOR_H_*/
+
+
+/* [] END OF FILE */
@@ -0,0 +1,409 @@
+/*******************************************************************************
+* File Name: power_save_controller.c
+*
+* Description: This file contains the adaptive Wi-Fi power-save controller.
+* While the device is connected, the packet rate of the STA interface is
+* sampled periodically and the Wi-Fi power-save mode and listen interval are
+* switched between three levels. The controller moves up a level as soon as
+* the rate crosses the enter threshold, so bursty traffic gets low latency,
+* and moves down only after the rate has stayed below a lower exit threshold
+* for several samples, so the mode does not toggle on a rate near a threshold.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <string.h>
+
+/* FreeRTOS includes */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Wi-Fi Connection Manager includes */
+#include "cy_wcm.h"
+#include "whd_wifi_api.h"
+
+#include "wps_enrollee_task.h"
+#include "connection_state.h"
+#include "power_save_controller.h"
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static const char* const level_names[POWER_SAVE_LEVEL_COUNT] =
+{
+    "low power",
+    "balanced",
+    "performance"
+};
+
+static power_save_stats_t stats;
+
+/* Level requested from the console when the controller is not automatic. */
+static volatile power_save_level_t forced_level = POWER_SAVE_LEVEL_BALANCED;
+
+/* Level selection state, used by the controller task only. */
+static power_save_policy_t policy;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static void power_save_task(void *arg);
+static cy_rslt_t apply_level(power_save_level_t level);
+static uint32_t read_packet_count(void);
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: power_save_controller_init
+ *******************************************************************************
+ * Summary: Creates the controller task. The controller starts in automatic
+ * mode and stays idle while the device is not connected.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS on success, POWER_SAVE_RSLT_NO_MEMORY if the task
+ *  could not be created.
+ *
+ ******************************************************************************/
+cy_rslt_t power_save_controller_init(void)
+{
+    memset(&stats, 0, sizeof(stats));
+    stats.level = POWER_SAVE_LEVEL_BALANCED;
+    stats.is_automatic = true;
+
+    if (pdPASS != xTaskCreate(power_save_task, "Power save", POWER_SAVE_TASK_STACK_SIZE,
+                              NULL, POWER_SAVE_TASK_PRIORITY, NULL))
+    {
+        return POWER_SAVE_RSLT_NO_MEMORY;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/*******************************************************************************
+ * Function Name: power_save_controller_set_automatic
+ *******************************************************************************
+ * Summary: Lets the controller select the level from the traffic rate.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void power_save_controller_set_automatic(void)
+{
+    taskENTER_CRITICAL();
+    stats.is_automatic = true;
+    taskEXIT_CRITICAL();
+}
+
+
+/*******************************************************************************
+ * Function Name: power_save_controller_force_level
+ *******************************************************************************
+ * Summary: Keeps the given level regardless of the traffic rate until
+ * power_save_controller_set_automatic() is called. The level is applied at the
+ * next sample.
+ *
+ * Parameters:
+ *  power_save_level_t level: Level to keep.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void power_save_controller_force_level(power_save_level_t level)
+{
+    if (level < POWER_SAVE_LEVEL_COUNT)
+    {
+        taskENTER_CRITICAL();
+        forced_level = level;
+        stats.is_automatic = false;
+        taskEXIT_CRITICAL();
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: power_save_controller_get_stats
+ *******************************************************************************
+ * Summary: Copies the controller statistics.
+ *
+ * Parameters:
+ *  power_save_stats_t *stats_copy: Filled with the statistics.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void power_save_controller_get_stats(power_save_stats_t *stats_copy)
+{
+    taskENTER_CRITICAL();
+    memcpy(stats_copy, &stats, sizeof(power_save_stats_t));
+    taskEXIT_CRITICAL();
+}
+
+
+/*******************************************************************************
+ * Function Name: power_save_level_name
+ *******************************************************************************
+ * Summary: Returns the printable name of a level.
+ *
+ * Parameters:
+ *  power_save_level_t level: Level.
+ *
+ * Return:
+ *  const char*: Name of the level.
+ *
+ ******************************************************************************/
+const char* power_save_level_name(power_save_level_t level)
+{
+    return (level < POWER_SAVE_LEVEL_COUNT) ? level_names[level] : "unknown";
+}
+
+
+/*******************************************************************************
+ * Function Name: power_save_task
+ *******************************************************************************
+ * Summary: Waits for the connection, applies the starting level on every new
+ * connection, then samples the packet rate every POWER_SAVE_SAMPLE_MSEC and
+ * switches the level as needed. A level that could not be applied is not
+ * taken as the current level: the selection state is restored and the level
+ * is applied again at the next sample.
+ *
+ * Parameters:
+ *  void *arg: Task parameter defined during task creation (unused).
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void power_save_task(void *arg)
+{
+    connection_state_snapshot_t snapshot;
+    uint32_t connected_generation = 0;
+    uint32_t last_packet_count = 0;
+    uint32_t packet_count;
+    uint32_t elapsed_ms;
+    uint32_t rate_pps;
+    TickType_t last_sample_time = 0;
+    power_save_level_t level = POWER_SAVE_LEVEL_COUNT;   /* Level applied, or COUNT if not known */
+    power_save_level_t target;
+    power_save_policy_t last_policy;
+    bool is_automatic;
+
+    while (true)
+    {
+        connection_state_wait_for_state(CONNECTION_STATE_CONNECTED, CONNECTION_STATE_WAIT_FOREVER);
+
+        /* The power-save mode is set up again after every connection, and the
+         * packet counters may have been reset with it.
+         */
+        connection_state_get_snapshot(&snapshot);
+        if (snapshot.generation != connected_generation)
+        {
+            connected_generation = snapshot.generation;
+            taskENTER_CRITICAL();
+            target = stats.is_automatic ? POWER_SAVE_LEVEL_BALANCED : forced_level;
+            taskEXIT_CRITICAL();
+            level = (CY_RSLT_SUCCESS == apply_level(target)) ? target : POWER_SAVE_LEVEL_COUNT;
+            power_save_policy_reset(&policy, target);
+            last_packet_count = read_packet_count();
+            last_sample_time = xTaskGetTickCount();
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(POWER_SAVE_SAMPLE_MSEC));
+
+        if (!connection_state_is_connected())
+        {
+            continue;
+        }
+
+        packet_count = read_packet_count();
+        elapsed_ms = (xTaskGetTickCount() - last_sample_time) * portTICK_PERIOD_MS;
+        last_sample_time = xTaskGetTickCount();
+        rate_pps = ((packet_count >= last_packet_count) && (elapsed_ms > 0u)) ?
+                   (((packet_count - last_packet_count) * 1000u) / elapsed_ms) : 0u;
+        last_packet_count = packet_count;
+
+        taskENTER_CRITICAL();
+        stats.rate_pps = rate_pps;
+        if (level < POWER_SAVE_LEVEL_COUNT)
+        {
+            stats.time_in_level_ms[level] += elapsed_ms;
+        }
+        is_automatic = stats.is_automatic;
+        taskEXIT_CRITICAL();
+
+        last_policy = policy;
+        if (is_automatic)
+        {
+            target = power_save_policy_update(&policy, rate_pps);
+        }
+        else
+        {
+            /* Automatic selection resumes from the forced level. */
+            target = forced_level;
+            power_save_policy_reset(&policy, target);
+        }
+
+        if (target != level)
+        {
+            if (CY_RSLT_SUCCESS == apply_level(target))
+            {
+                level = target;
+            }
+            else
+            {
+                /* Select the level again from the same state next time. */
+                policy = last_policy;
+            }
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: apply_level
+ *******************************************************************************
+ * Summary: Configures the power-save mode and listen interval of the STA
+ * interface for the level. The statistics are updated only if every setting
+ * was applied.
+ *
+ * Parameters:
+ *  power_save_level_t level: Level to apply.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the level was applied,
+ *  POWER_SAVE_RSLT_APPLY_FAILED otherwise.
+ *
+ ******************************************************************************/
+static cy_rslt_t apply_level(power_save_level_t level)
+{
+    whd_interface_t ifp;
+    whd_result_t result = WHD_SUCCESS;
+    bool is_applied = false;
+
+    if (CY_RSLT_SUCCESS == cy_wcm_get_whd_interface(CY_WCM_INTERFACE_TYPE_STA, &ifp))
+    {
+        switch (level)
+        {
+        case POWER_SAVE_LEVEL_PERFORMANCE:
+            result = whd_wifi_disable_powersave(ifp);
+            break;
+
+        case POWER_SAVE_LEVEL_BALANCED:
+            result = whd_wifi_set_listen_interval(ifp, 1u, WHD_LISTEN_INTERVAL_TIME_UNIT_DTIM);
+            if (WHD_SUCCESS == result)
+            {
+                result = whd_wifi_enable_powersave_with_throughput(ifp, POWER_SAVE_RETURN_TO_SLEEP_MSEC);
+            }
+            break;
+
+        case POWER_SAVE_LEVEL_LOW_POWER:
+        default:
+            result = whd_wifi_set_listen_interval(ifp, POWER_SAVE_LOW_POWER_LISTEN_DTIM,
+                                                  WHD_LISTEN_INTERVAL_TIME_UNIT_DTIM);
+            if (WHD_SUCCESS == result)
+            {
+                result = whd_wifi_enable_powersave(ifp);
+            }
+            break;
+        }
+
+        is_applied = (WHD_SUCCESS == result);
+    }
+
+    if (!is_applied)
+    {
+        ERR_INFO(("Failed to set the %s power-save level.\n", power_save_level_name(level)));
+        taskENTER_CRITICAL();
+        stats.apply_failures++;
+        taskEXIT_CRITICAL();
+        return POWER_SAVE_RSLT_APPLY_FAILED;
+    }
+
+    taskENTER_CRITICAL();
+    if (stats.level != level)
+    {
+        stats.switches++;
+    }
+    stats.level = level;
+    taskEXIT_CRITICAL();
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/*******************************************************************************
+ * Function Name: read_packet_count
+ *******************************************************************************
+ * Summary: Returns the number of packets sent and received on the STA
+ * interface.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t: TX + RX packet count, or 0 if the statistics are not available.
+ *
+ ******************************************************************************/
+static uint32_t read_packet_count(void)
+{
+    cy_wcm_wlan_statistics_t wlan_statistics;
+
+    if (CY_RSLT_SUCCESS != cy_wcm_get_wlan_statistics(CY_WCM_INTERFACE_TYPE_STA, &wlan_statistics))
+    {
+        return 0;
+    }
+
+    return wlan_statistics.tx_packets + wlan_statistics.rx_packets;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,163 @@
+/*******************************************************************************
+* File Name: power_save_controller.h
+*
+* Description: This file includes the macros, structures, and function
+* prototypes of the adaptive power-save controller used in
+* power_save_controller.c
+*
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ *  Include guard
+ ******************************************************************************/
+#ifndef SOURCE_POWER_SAVE_CONTROLLER_H_
+#define SOURCE_POWER_SAVE_CONTROLLER_H_
+
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "cy_result.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Interval in milliseconds at which the traffic rate is sampled. */
+#define POWER_SAVE_SAMPLE_MSEC              (1000u)
+
+/* Traffic rates in packets per second (TX + RX) that move the controller to a
+ * higher level. A single sample above the threshold is enough, so that bursty
+ * traffic gets low latency quickly.
+ */
+#define POWER_SAVE_BALANCED_ENTER_PPS       (5u)
+#define POWER_SAVE_PERFORMANCE_ENTER_PPS    (50u)
+
+/* Traffic rates below which the controller moves to a lower level, and the
+ * number of consecutive samples the rate must stay below it. The exit rates are
+ * lower than the enter rates, so a rate near a threshold does not toggle the
+ * mode.
+ */
+#define POWER_SAVE_BALANCED_EXIT_PPS        (1u)
+#define POWER_SAVE_BALANCED_EXIT_SAMPLES    (10u)
+#define POWER_SAVE_PERFORMANCE_EXIT_PPS     (20u)
+#define POWER_SAVE_PERFORMANCE_EXIT_SAMPLES (5u)
+
+/* A level entered again less than POWER_SAVE_FLAP_WINDOW_SAMPLES after it was
+ * left is held twice as long before it is left the next time, up to
+ * POWER_SAVE_MAX_EXIT_BACKOFF times the exit samples above. Traffic bursts that
+ * come back faster than the level is left then keep the level instead of
+ * switching twice per burst. The hold returns to normal once the controller
+ * has stayed below the level for longer than the window.
+ */
+#define POWER_SAVE_FLAP_WINDOW_SAMPLES      (30u)
+#define POWER_SAVE_MAX_EXIT_BACKOFF         (8u)
+
+/* Time in milliseconds the Wi-Fi device stays awake after the last packet in
+ * the balanced level.
+ */
+#define POWER_SAVE_RETURN_TO_SLEEP_MSEC     (50u)
+
+/* Listen interval in DTIM periods of the low power level. */
+#define POWER_SAVE_LOW_POWER_LISTEN_DTIM    (3u)
+
+#define POWER_SAVE_TASK_STACK_SIZE          (2048u)
+#define POWER_SAVE_TASK_PRIORITY            (1u)
+
+/* Power-save controller result codes. */
+#define POWER_SAVE_RSLT_MODULE              (CY_RSLT_MODULE_MIDDLEWARE_BASE + 0xF7u)
+#define POWER_SAVE_RSLT_NO_MEMORY           CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, POWER_SAVE_RSLT_MODULE, 1u)
+#define POWER_SAVE_RSLT_APPLY_FAILED        CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, POWER_SAVE_RSLT_MODULE, 2u)
+
+
+/*******************************************************************************
+ * Enumerations
+ ******************************************************************************/
+typedef enum
+{
+    POWER_SAVE_LEVEL_LOW_POWER = 0,     /* PS-Poll power save, longer listen interval */
+    POWER_SAVE_LEVEL_BALANCED,          /* Power save with throughput, every DTIM */
+    POWER_SAVE_LEVEL_PERFORMANCE,       /* Power save disabled */
+    POWER_SAVE_LEVEL_COUNT
+} power_save_level_t;
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef struct
+{
+    power_save_level_t level;                               /* Last level applied */
+    bool               is_automatic;
+    uint32_t           rate_pps;                            /* Last sampled rate */
+    uint32_t           switches;
+    uint32_t           apply_failures;                      /* Levels not applied, retried at the next sample */
+    uint32_t           time_in_level_ms[POWER_SAVE_LEVEL_COUNT];
+} power_save_stats_t;
+
+/* State of the level selection, kept by the controller task. */
+typedef struct
+{
+    power_save_level_t level;
+    uint32_t           samples_below_exit;                          /* Consecutive samples below the exit rate */
+    uint32_t           samples_since_exit[POWER_SAVE_LEVEL_COUNT];  /* Samples since each level was left */
+    uint32_t           exit_backoff[POWER_SAVE_LEVEL_COUNT];        /* Multiplier of the exit samples */
+} power_save_policy_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_rslt_t power_save_controller_init(void);
+void power_save_controller_set_automatic(void);
+void power_save_controller_force_level(power_save_level_t level);
+void power_save_controller_get_stats(power_save_stats_t *stats_copy);
+const char* power_save_level_name(power_save_level_t level);
+
+/* Level selection, in power_save_policy.c. It uses no RTOS or Wi-Fi services so
+ * that it can be tested on the host.
+ */
+void power_save_policy_reset(power_save_policy_t *policy, power_save_level_t level);
+power_save_level_t power_save_policy_update(power_save_policy_t *policy, uint32_t rate_pps);
+
+#endif /*SOURCE_POWER_SAVE_CONTROLLER_H_*/
+
+
+/* [] END OF FILE */
@@ -0,0 +1,192 @@
+/*******************************************************************************
+* File Name: power_save_policy.c
+*
+* Description: This file contains the selection of the power-save level from
+* the sampled packet rate. It uses no RTOS or Wi-Fi services so that it can be
+* tested on the host.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include "power_save_controller.h"
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Thresholds to leave a level for the level below it. */
+typedef struct
+{
+    uint32_t exit_pps;
+    uint32_t exit_samples;
+} power_save_exit_t;
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static const power_save_exit_t level_exits[POWER_SAVE_LEVEL_COUNT] =
+{
+    [POWER_SAVE_LEVEL_LOW_POWER]   = { 0u, 0u },
+    [POWER_SAVE_LEVEL_BALANCED]    = { POWER_SAVE_BALANCED_EXIT_PPS, POWER_SAVE_BALANCED_EXIT_SAMPLES },
+    [POWER_SAVE_LEVEL_PERFORMANCE] = { POWER_SAVE_PERFORMANCE_EXIT_PPS, POWER_SAVE_PERFORMANCE_EXIT_SAMPLES },
+};
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: power_save_policy_reset
+ *******************************************************************************
+ * Summary: Starts the level selection at the given level with no history.
+ *
+ * Parameters:
+ *  power_save_policy_t *policy: Selection state.
+ *  power_save_level_t level: Starting level.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void power_save_policy_reset(power_save_policy_t *policy, power_save_level_t level)
+{
+    uint32_t i;
+
+    policy->level = level;
+    policy->samples_below_exit = 0u;
+
+    for (i = 0u; i < (uint32_t)POWER_SAVE_LEVEL_COUNT; i++)
+    {
+        policy->samples_since_exit[i] = UINT32_MAX;
+        policy->exit_backoff[i] = 1u;
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: power_save_policy_update
+ *******************************************************************************
+ * Summary: Selects the level for the sampled rate with hysteresis. A level is
+ * entered on a single sample at or above its entry rate and left for the level
+ * below it after its exit samples in a row below its exit rate. A level entered
+ * again within POWER_SAVE_FLAP_WINDOW_SAMPLES of being left doubles its exit
+ * samples, up to POWER_SAVE_MAX_EXIT_BACKOFF times, and goes back to the
+ * configured exit samples once the level has not been used for that window.
+ *
+ * Parameters:
+ *  power_save_policy_t *policy: Selection state.
+ *  uint32_t rate_pps: Sampled packet rate.
+ *
+ * Return:
+ *  power_save_level_t: Level to use.
+ *
+ ******************************************************************************/
+power_save_level_t power_save_policy_update(power_save_policy_t *policy, uint32_t rate_pps)
+{
+    power_save_level_t level = policy->level;
+    power_save_level_t target = level;
+    uint32_t i;
+
+    /* Age the levels above the current one and forget the hold of those that
+     * have not been used for the window.
+     */
+    for (i = (uint32_t)level + 1u; i < (uint32_t)POWER_SAVE_LEVEL_COUNT; i++)
+    {
+        if (policy->samples_since_exit[i] < UINT32_MAX)
+        {
+            policy->samples_since_exit[i]++;
+        }
+
+        if (policy->samples_since_exit[i] > POWER_SAVE_FLAP_WINDOW_SAMPLES)
+        {
+            policy->exit_backoff[i] = 1u;
+        }
+    }
+
+    if (rate_pps >= POWER_SAVE_PERFORMANCE_ENTER_PPS)
+    {
+        target = POWER_SAVE_LEVEL_PERFORMANCE;
+        policy->samples_below_exit = 0u;
+    }
+    else if ((POWER_SAVE_LEVEL_LOW_POWER == level) && (rate_pps >= POWER_SAVE_BALANCED_ENTER_PPS))
+    {
+        target = POWER_SAVE_LEVEL_BALANCED;
+    }
+    else if ((POWER_SAVE_LEVEL_LOW_POWER != level) && (rate_pps < level_exits[level].exit_pps))
+    {
+        policy->samples_below_exit++;
+        if (policy->samples_below_exit >= (level_exits[level].exit_samples * policy->exit_backoff[level]))
+        {
+            target = (power_save_level_t)(level - 1);
+        }
+    }
+    else
+    {
+        policy->samples_below_exit = 0u;
+    }
+
+    if (target > level)
+    {
+        /* Levels entered again shortly after being left are held longer. */
+        for (i = (uint32_t)level + 1u; i <= (uint32_t)target; i++)
+        {
+            if ((policy->samples_since_exit[i] <= POWER_SAVE_FLAP_WINDOW_SAMPLES) &&
+                (policy->exit_backoff[i] < POWER_SAVE_MAX_EXIT_BACKOFF))
+            {
+                policy->exit_backoff[i] *= 2u;
+            }
+        }
+    }
+    else if (target < level)
+    {
+        policy->samples_since_exit[level] = 0u;
+    }
+
+    if (target != level)
+    {
+        policy->samples_below_exit = 0u;
+        policy->level = target;
+    }
+
+    return target;
+}
+
+
+/* [] END OF FILE */
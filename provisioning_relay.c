@@ -0,0 +1,698 @@
+/*******************************************************************************
+* File Name: provisioning_relay.c
+*
+* Description: This file contains the provisioning relay. A device that is
+* connected to the network runs a WPA2 soft-AP next to its STA interface and
+* serves its network credential over TCP to the devices of the same fleet that
+* join the soft-AP. The credential is encrypted with AES-CCM under a key
+* derived from the fleet key and from a nonce chosen by each side, so a reply
+* is accepted only from a relay that knows the fleet key and only for the
+* request that it answers.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <string.h>
+
+#include "cyhal.h"
+#include "cybsp.h"
+
+/* FreeRTOS includes */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "wps_enrollee_task.h"
+#include "conn_journal.h"
+#include "provisioning_relay.h"
+
+#if (PROVISIONING_RELAY_ENABLE)
+#include "cy_secure_sockets.h"
+#include "ip_addr.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Time in milliseconds between two checks for the exit of the server task. */
+#define RELAY_STOP_POLL_MSEC                (100u)
+
+/* The fleet key is used as a WPA2 passphrase. */
+_Static_assert(((sizeof(PROVISIONING_RELAY_FLEET_KEY) - 1u) >= 8u) &&
+               ((sizeof(PROVISIONING_RELAY_FLEET_KEY) - 1u) <= 63u),
+               "PROVISIONING_RELAY_FLEET_KEY must be 8 to 63 characters.");
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static TaskHandle_t relay_task_handle = NULL;
+static volatile bool is_stop_requested = false;
+static bool is_socket_library_initialized = false;
+
+/* Channel the relay soft-AP was started on. */
+static uint8_t relay_channel = 0;
+
+/* Credential served by the relay. */
+static provisioning_relay_credential_t served_credential;
+static uint32_t served_count = 0;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static void relay_server_task(void *arg);
+static void serve_client(cy_socket_t client, const cy_socket_sockaddr_t *peer);
+static cy_rslt_t socket_library_init(void);
+static cy_rslt_t send_all(cy_socket_t socket, const void *buffer, uint32_t length);
+static cy_rslt_t receive_all(cy_socket_t socket, void *buffer, uint32_t length);
+static cy_rslt_t set_socket_timeouts(cy_socket_t socket);
+static cy_rslt_t fill_random(uint8_t *buffer, uint32_t length);
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: provisioning_relay_start
+ *******************************************************************************
+ * Summary: Starts the relay soft-AP on the channel of the connected AP, as
+ * required by concurrent AP+STA operation, and starts the relay server. If the
+ * relay is already running on that channel, only the served credential is
+ * updated. If the AP has moved to another channel, for example after a
+ * reconnection to another AP of the network, the relay is restarted on the new
+ * channel.
+ *
+ * Parameters:
+ *  const cy_wcm_connect_params_t *credential: Credential of the network the
+ *  STA interface is connected to.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the relay is running.
+ *
+ ******************************************************************************/
+cy_rslt_t provisioning_relay_start(const cy_wcm_connect_params_t *credential)
+{
+    cy_rslt_t result;
+    cy_wcm_ap_config_t ap_config;
+    cy_wcm_associated_ap_info_t ap_info;
+
+    taskENTER_CRITICAL();
+    memset(&served_credential, 0, sizeof(served_credential));
+    served_credential.security = (uint32_t)credential->ap_credentials.security;
+    served_credential.band = (uint32_t)credential->band;
+    memcpy(served_credential.bssid, credential->BSSID, sizeof(served_credential.bssid));
+    memcpy(served_credential.ssid, credential->ap_credentials.SSID, sizeof(served_credential.ssid));
+    memcpy(served_credential.passphrase, credential->ap_credentials.password, sizeof(served_credential.passphrase));
+    taskEXIT_CRITICAL();
+
+    result = cy_wcm_get_associated_ap_info(&ap_info);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    if (NULL != relay_task_handle)
+    {
+        if (ap_info.channel == relay_channel)
+        {
+            return CY_RSLT_SUCCESS;
+        }
+
+        APP_INFO(("AP moved from channel %d to %d. Restarting the provisioning relay.\n",
+                  relay_channel, ap_info.channel));
+        provisioning_relay_stop();
+    }
+
+    memset(&ap_config, 0, sizeof(ap_config));
+    memcpy(ap_config.ap_credentials.SSID, PROVISIONING_RELAY_SSID, sizeof(PROVISIONING_RELAY_SSID));
+    memcpy(ap_config.ap_credentials.password, PROVISIONING_RELAY_FLEET_KEY, sizeof(PROVISIONING_RELAY_FLEET_KEY));
+    ap_config.ap_credentials.security = CY_WCM_SECURITY_WPA2_AES_PSK;
+    ap_config.channel = ap_info.channel;
+    ap_config.band = (ap_info.channel > 14u) ? CY_WCM_WIFI_BAND_5GHZ : CY_WCM_WIFI_BAND_2_4GHZ;
+    cy_wcm_set_ap_ip_setting(&ap_config.ip_settings, PROVISIONING_RELAY_IP_ADDRESS, PROVISIONING_RELAY_NETMASK,
+                             PROVISIONING_RELAY_IP_ADDRESS, CY_WCM_IP_VER_V4);
+
+    result = socket_library_init();
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    result = cy_wcm_start_ap(&ap_config);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    is_stop_requested = false;
+    if (pdPASS != xTaskCreate(relay_server_task, "Provisioning relay", PROVISIONING_RELAY_TASK_STACK_SIZE,
+                              NULL, PROVISIONING_RELAY_TASK_PRIORITY, &relay_task_handle))
+    {
+        relay_task_handle = NULL;
+        cy_wcm_stop_ap();
+        return PROVISIONING_RELAY_RSLT_NO_MEMORY;
+    }
+
+    relay_channel = ap_info.channel;
+    APP_INFO(("Provisioning relay '%s' started on channel %d.\n", PROVISIONING_RELAY_SSID, ap_info.channel));
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/*******************************************************************************
+ * Function Name: provisioning_relay_stop
+ *******************************************************************************
+ * Summary: Stops the relay server and the relay soft-AP. The function returns
+ * after the server task has exited, which takes up to
+ * PROVISIONING_RELAY_TIMEOUT_MSEC.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void provisioning_relay_stop(void)
+{
+    if (NULL == relay_task_handle)
+    {
+        return;
+    }
+
+    is_stop_requested = true;
+    while (NULL != relay_task_handle)
+    {
+        vTaskDelay(pdMS_TO_TICKS(RELAY_STOP_POLL_MSEC));
+    }
+
+    cy_wcm_stop_ap();
+    APP_INFO(("Provisioning relay stopped.\n"));
+}
+
+
+/*******************************************************************************
+ * Function Name: provisioning_relay_request
+ *******************************************************************************
+ * Summary: Joins the soft-AP of a relay found by a scan, requests the network
+ * credential, and leaves the soft-AP. The BSSID and band of the credential are
+ * those of the AP the relay is connected to.
+ *
+ * Parameters:
+ *  const cy_wcm_mac_t *relay_bssid: BSSID of the relay soft-AP.
+ *  cy_wcm_wifi_band_t relay_band: Band of the relay soft-AP.
+ *  cy_wcm_connect_params_t *credential: Filled with the received credential.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if a credential was received. The result of
+ *  cy_wcm_connect_ap() if the relay could not be joined.
+ *
+ ******************************************************************************/
+cy_rslt_t provisioning_relay_request(const cy_wcm_mac_t *relay_bssid, cy_wcm_wifi_band_t relay_band,
+                                     cy_wcm_connect_params_t *credential)
+{
+    cy_rslt_t result;
+    cy_wcm_connect_params_t relay_params;
+    cy_wcm_ip_address_t ip_address;
+    cy_wcm_ip_address_t relay_address;
+    cy_socket_t socket = NULL;
+    cy_socket_sockaddr_t server_address;
+    provisioning_relay_header_t request;
+    provisioning_relay_response_t response;
+    provisioning_relay_credential_t received;
+    uint8_t nonce[PROVISIONING_RELAY_NONCE_SIZE];
+
+    result = socket_library_init();
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    memset(&relay_params, 0, sizeof(relay_params));
+    memcpy(relay_params.ap_credentials.SSID, PROVISIONING_RELAY_SSID, sizeof(PROVISIONING_RELAY_SSID));
+    memcpy(relay_params.ap_credentials.password, PROVISIONING_RELAY_FLEET_KEY, sizeof(PROVISIONING_RELAY_FLEET_KEY));
+    relay_params.ap_credentials.security = CY_WCM_SECURITY_WPA2_AES_PSK;
+    memcpy(relay_params.BSSID, *relay_bssid, sizeof(relay_params.BSSID));
+    relay_params.band = relay_band;
+
+    result = cy_wcm_connect_ap(&relay_params, &ip_address);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    /* The relay is the gateway of its soft-AP network. */
+    result = cy_wcm_get_gateway_ip_address(CY_WCM_INTERFACE_TYPE_STA, &relay_address);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cy_socket_create(CY_SOCKET_DOMAIN_AF_INET, CY_SOCKET_TYPE_STREAM, CY_SOCKET_IPPROTO_TCP, &socket);
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = set_socket_timeouts(socket);
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        memset(&server_address, 0, sizeof(server_address));
+        server_address.port = PROVISIONING_RELAY_PORT;
+        server_address.ip_address.version = CY_SOCKET_IP_VER_V4;
+        server_address.ip_address.ip.v4 = relay_address.ip.v4;
+        result = cy_socket_connect(socket, &server_address, sizeof(server_address));
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = fill_random(nonce, sizeof(nonce));
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        provisioning_relay_init_header(&request, PROVISIONING_RELAY_MESSAGE_REQUEST, nonce);
+        result = send_all(socket, &request, sizeof(request));
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = receive_all(socket, &response, sizeof(response));
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = provisioning_relay_open_response(&request, &response, &received);
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        memset(credential, 0, sizeof(cy_wcm_connect_params_t));
+        credential->ap_credentials.security = (cy_wcm_security_t)received.security;
+        credential->band = (cy_wcm_wifi_band_t)received.band;
+        memcpy(credential->BSSID, received.bssid, sizeof(credential->BSSID));
+        memcpy(credential->ap_credentials.SSID, received.ssid, sizeof(received.ssid));
+        memcpy(credential->ap_credentials.password, received.passphrase, sizeof(received.passphrase));
+        credential->ap_credentials.SSID[CY_WCM_MAX_SSID_LEN] = '\0';
+        credential->ap_credentials.password[CY_WCM_MAX_PASSPHRASE_LEN] = '\0';
+        memset(&received, 0, sizeof(received));
+    }
+
+    if (NULL != socket)
+    {
+        cy_socket_disconnect(socket, 0);
+        cy_socket_delete(socket);
+    }
+
+    cy_wcm_disconnect_ap();
+
+    return result;
+}
+
+
+/*******************************************************************************
+ * Function Name: provisioning_relay_get_served_count
+ *******************************************************************************
+ * Summary: Returns the number of devices the relay has served a credential to.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t: Number of served devices since startup.
+ *
+ ******************************************************************************/
+uint32_t provisioning_relay_get_served_count(void)
+{
+    return served_count;
+}
+
+
+/*******************************************************************************
+ * Function Name: provisioning_relay_is_relay_network
+ *******************************************************************************
+ * Summary: Checks whether an IPv4 address is in the subnet of the relay
+ * soft-AP. The STA interface has such an address only while it is joined to a
+ * relay to request the credential, so the subscribers of the connection events
+ * use this check to ignore that join.
+ *
+ * Parameters:
+ *  uint32_t ipv4_address: Address in network byte order.
+ *
+ * Return:
+ *  bool: true if the address is in the relay subnet.
+ *
+ ******************************************************************************/
+bool provisioning_relay_is_relay_network(uint32_t ipv4_address)
+{
+    uint32_t netmask = ipaddr_addr(PROVISIONING_RELAY_NETMASK);
+
+    return ((ipv4_address & netmask) == (ipaddr_addr(PROVISIONING_RELAY_IP_ADDRESS) & netmask));
+}
+
+
+/*******************************************************************************
+ * Function Name: relay_server_task
+ *******************************************************************************
+ * Summary: Accepts the connections on the relay soft-AP one at a time and
+ * serves each of them until a stop is requested.
+ *
+ * Parameters:
+ *  void *arg: Task parameter defined during task creation (unused).
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void relay_server_task(void *arg)
+{
+    cy_rslt_t result;
+    cy_socket_t server = NULL;
+    cy_socket_t client;
+    cy_socket_sockaddr_t address;
+    uint32_t address_length;
+    cy_wcm_ip_address_t ap_address;
+
+    result = cy_wcm_get_ip_addr(CY_WCM_INTERFACE_TYPE_AP, &ap_address);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cy_socket_create(CY_SOCKET_DOMAIN_AF_INET, CY_SOCKET_TYPE_STREAM, CY_SOCKET_IPPROTO_TCP, &server);
+    }
+
+    /* The receive timeout also bounds the wait for a connection, so that a
+     * stop request is seen within PROVISIONING_RELAY_TIMEOUT_MSEC.
+     */
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = set_socket_timeouts(server);
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        memset(&address, 0, sizeof(address));
+        address.port = PROVISIONING_RELAY_PORT;
+        address.ip_address.version = CY_SOCKET_IP_VER_V4;
+        address.ip_address.ip.v4 = ap_address.ip.v4;
+        result = cy_socket_bind(server, &address, sizeof(address));
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cy_socket_listen(server, 1);
+    }
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        ERR_INFO(("Failed to start the provisioning relay server.\n"));
+    }
+
+    while ((CY_RSLT_SUCCESS == result) && !is_stop_requested)
+    {
+        address_length = sizeof(address);
+        if (CY_RSLT_SUCCESS == cy_socket_accept(server, &address, &address_length, &client))
+        {
+            serve_client(client, &address);
+            cy_socket_disconnect(client, 0);
+            cy_socket_delete(client);
+        }
+    }
+
+    if (NULL != server)
+    {
+        cy_socket_delete(server);
+    }
+
+    relay_task_handle = NULL;
+    vTaskDelete(NULL);
+}
+
+
+/*******************************************************************************
+ * Function Name: serve_client
+ *******************************************************************************
+ * Summary: Receives the request of a new device and replies with the network
+ * credential encrypted under the key of this exchange.
+ *
+ * Parameters:
+ *  cy_socket_t client: Connected socket of the new device.
+ *  const cy_socket_sockaddr_t *peer: Address of the new device.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void serve_client(cy_socket_t client, const cy_socket_sockaddr_t *peer)
+{
+    provisioning_relay_header_t request;
+    provisioning_relay_response_t response;
+    provisioning_relay_credential_t credential;
+    uint8_t nonce[PROVISIONING_RELAY_NONCE_SIZE];
+    cy_rslt_t result;
+
+    if ((CY_RSLT_SUCCESS != receive_all(client, &request, sizeof(request))) ||
+        !provisioning_relay_is_header_valid(&request, PROVISIONING_RELAY_MESSAGE_REQUEST) ||
+        (CY_RSLT_SUCCESS != fill_random(nonce, sizeof(nonce))))
+    {
+        return;
+    }
+
+    taskENTER_CRITICAL();
+    memcpy(&credential, &served_credential, sizeof(credential));
+    taskEXIT_CRITICAL();
+
+    result = provisioning_relay_seal_response(&request, nonce, &credential, &response);
+    memset(&credential, 0, sizeof(credential));
+
+    if ((CY_RSLT_SUCCESS == result) && (CY_RSLT_SUCCESS == send_all(client, &response, sizeof(response))))
+    {
+        served_count++;
+        APP_INFO(("Provisioning relay served device %lu.\n", (unsigned long)served_count));
+        conn_journal_append(CONN_JOURNAL_EVENT_RELAY_SERVED, 0, peer->ip_address.ip.v4);
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: fill_random
+ *******************************************************************************
+ * Summary: Fills the buffer with bytes from the true random number generator.
+ *
+ * Parameters:
+ *  uint8_t *buffer: Buffer to fill.
+ *  uint32_t length: Number of bytes.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the generator was available.
+ *
+ ******************************************************************************/
+static cy_rslt_t fill_random(uint8_t *buffer, uint32_t length)
+{
+    cyhal_trng_t trng;
+    uint32_t random;
+    cy_rslt_t result = cyhal_trng_init(&trng);
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    for (uint32_t index = 0; index < length; index += sizeof(random))
+    {
+        random = cyhal_trng_generate(&trng);
+        memcpy(&buffer[index], &random, ((length - index) < sizeof(random)) ? (length - index) : sizeof(random));
+    }
+
+    cyhal_trng_free(&trng);
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/*******************************************************************************
+ * Function Name: socket_library_init
+ *******************************************************************************
+ * Summary: Initializes the secure sockets library on first use.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  cy_rslt_t: Result of cy_socket_init().
+ *
+ ******************************************************************************/
+static cy_rslt_t socket_library_init(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if (!is_socket_library_initialized)
+    {
+        result = cy_socket_init();
+        is_socket_library_initialized = (CY_RSLT_SUCCESS == result);
+    }
+
+    return result;
+}
+
+
+/*******************************************************************************
+ * Function Name: set_socket_timeouts
+ *******************************************************************************
+ * Summary: Sets the receive and send timeouts of the socket to
+ * PROVISIONING_RELAY_TIMEOUT_MSEC.
+ *
+ * Parameters:
+ *  cy_socket_t socket: Socket to configure.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if both timeouts were set.
+ *
+ ******************************************************************************/
+static cy_rslt_t set_socket_timeouts(cy_socket_t socket)
+{
+    uint32_t timeout = PROVISIONING_RELAY_TIMEOUT_MSEC;
+    cy_rslt_t result;
+
+    result = cy_socket_setsockopt(socket, CY_SOCKET_SOL_SOCKET, CY_SOCKET_SO_RCVTIMEO, &timeout, sizeof(timeout));
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cy_socket_setsockopt(socket, CY_SOCKET_SOL_SOCKET, CY_SOCKET_SO_SNDTIMEO, &timeout, sizeof(timeout));
+    }
+
+    return result;
+}
+
+
+/*******************************************************************************
+ * Function Name: send_all
+ *******************************************************************************
+ * Summary: Sends the whole buffer.
+ *
+ * Parameters:
+ *  cy_socket_t socket: Connected socket.
+ *  const void *buffer: Data to send.
+ *  uint32_t length: Number of bytes to send.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if all the bytes were sent.
+ *
+ ******************************************************************************/
+static cy_rslt_t send_all(cy_socket_t socket, const void *buffer, uint32_t length)
+{
+    const uint8_t *data = (const uint8_t *)buffer;
+    uint32_t sent = 0;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    while ((CY_RSLT_SUCCESS == result) && (length > 0u))
+    {
+        result = cy_socket_send(socket, data, length, CY_SOCKET_FLAGS_NONE, &sent);
+        data += sent;
+        length -= sent;
+    }
+
+    return result;
+}
+
+
+/*******************************************************************************
+ * Function Name: receive_all
+ *******************************************************************************
+ * Summary: Receives exactly the given number of bytes.
+ *
+ * Parameters:
+ *  cy_socket_t socket: Connected socket.
+ *  void *buffer: Buffer for the received data.
+ *  uint32_t length: Number of bytes to receive.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if all the bytes were received before the
+ *  timeout.
+ *
+ ******************************************************************************/
+static cy_rslt_t receive_all(cy_socket_t socket, void *buffer, uint32_t length)
+{
+    uint8_t *data = (uint8_t *)buffer;
+    uint32_t received = 0;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    while ((CY_RSLT_SUCCESS == result) && (length > 0u))
+    {
+        result = cy_socket_recv(socket, data, length, CY_SOCKET_FLAGS_NONE, &received);
+        if ((CY_RSLT_SUCCESS == result) && (0u == received))
+        {
+            result = PROVISIONING_RELAY_RSLT_PROTOCOL;
+        }
+        data += received;
+        length -= received;
+    }
+
+    return result;
+}
+
+#else
+
+cy_rslt_t provisioning_relay_start(const cy_wcm_connect_params_t *credential)
+{
+    return PROVISIONING_RELAY_RSLT_NOT_ENABLED;
+}
+
+void provisioning_relay_stop(void)
+{
+}
+
+cy_rslt_t provisioning_relay_request(const cy_wcm_mac_t *relay_bssid, cy_wcm_wifi_band_t relay_band,
+                                     cy_wcm_connect_params_t *credential)
+{
+    return PROVISIONING_RELAY_RSLT_NOT_ENABLED;
+}
+
+uint32_t provisioning_relay_get_served_count(void)
+{
+    return 0;
+}
+
+bool provisioning_relay_is_relay_network(uint32_t ipv4_address)
+{
+    return false;
+}
+
+#endif /* PROVISIONING_RELAY_ENABLE */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,178 @@
+/*******************************************************************************
+* File Name: provisioning_relay.h
+*
+* Description: This file includes the macros, structures, and function
+* prototypes of the provisioning relay used in provisioning_relay.c
+*
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ *  Include guard
+ ******************************************************************************/
+#ifndef SOURCE_PROVISIONING_RELAY_H_
+#define SOURCE_PROVISIONING_RELAY_H_
+
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+/* Wi-Fi Connection Manager includes */
+#include "cy_wcm.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Set this macro to 1, here or in the DEFINES of the Makefile, to enable the
+ * provisioning relay. When enabled, a provisioned device runs a soft-AP
+ * concurrently with the STA interface and hands its network credential to the
+ * devices that join it.
+ */
+#ifndef PROVISIONING_RELAY_ENABLE
+#define PROVISIONING_RELAY_ENABLE           (0)
+#endif
+
+/* SSID of the relay soft-AP. */
+#define PROVISIONING_RELAY_SSID             "WPS_RELAY"
+
+/* Key shared by all the devices of the fleet. It is the WPA2 passphrase of the
+ * relay soft-AP and the key from which the credential encryption key of each
+ * exchange is derived. It must be 8 to 63 characters. No default is provided:
+ * define it for each fleet in the DEFINES of the Makefile, for example
+ * DEFINES+=PROVISIONING_RELAY_FLEET_KEY=\"<key>\".
+ */
+#if (PROVISIONING_RELAY_ENABLE) && !defined(PROVISIONING_RELAY_FLEET_KEY)
+#error "PROVISIONING_RELAY_FLEET_KEY must be defined for the fleet when PROVISIONING_RELAY_ENABLE is set."
+#endif
+
+/* IP settings of the relay soft-AP and the TCP port of the relay server. */
+#define PROVISIONING_RELAY_IP_ADDRESS       "192.168.10.1"
+#define PROVISIONING_RELAY_NETMASK          "255.255.255.0"
+#define PROVISIONING_RELAY_PORT             (50007u)
+
+/* Receive and send timeout in milliseconds of the relay exchange. The server
+ * also checks for a stop request at this interval.
+ */
+#define PROVISIONING_RELAY_TIMEOUT_MSEC     (5000u)
+
+#define PROVISIONING_RELAY_TASK_STACK_SIZE  (4096u)
+#define PROVISIONING_RELAY_TASK_PRIORITY    (2u)
+
+/* Size in bytes of the nonces exchanged by the relay and the new device. */
+#define PROVISIONING_RELAY_NONCE_SIZE       (16u)
+
+/* Header fields of the relay messages. */
+#define PROVISIONING_RELAY_MESSAGE_MAGIC    (0x57505231uL)
+#define PROVISIONING_RELAY_MESSAGE_REQUEST  (1u)
+#define PROVISIONING_RELAY_MESSAGE_RESPONSE (2u)
+
+/* AES-128 key and CCM tag sizes in bytes. */
+#define PROVISIONING_RELAY_KEY_SIZE         (16u)
+#define PROVISIONING_RELAY_TAG_SIZE         (16u)
+
+/* Provisioning relay result codes. */
+#define PROVISIONING_RELAY_RSLT_MODULE      (CY_RSLT_MODULE_MIDDLEWARE_BASE + 0xFAu)
+#define PROVISIONING_RELAY_RSLT_NOT_ENABLED CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, PROVISIONING_RELAY_RSLT_MODULE, 1u)
+#define PROVISIONING_RELAY_RSLT_NO_MEMORY   CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, PROVISIONING_RELAY_RSLT_MODULE, 2u)
+#define PROVISIONING_RELAY_RSLT_PROTOCOL    CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, PROVISIONING_RELAY_RSLT_MODULE, 3u)
+#define PROVISIONING_RELAY_RSLT_AUTH_FAILED CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, PROVISIONING_RELAY_RSLT_MODULE, 4u)
+#define PROVISIONING_RELAY_RSLT_CRYPTO      CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, PROVISIONING_RELAY_RSLT_MODULE, 5u)
+#define PROVISIONING_RELAY_RSLT_NOT_FOUND   CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, PROVISIONING_RELAY_RSLT_MODULE, 6u)
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Header of the request and of the response. The nonce is chosen by the
+ * sender of the message.
+ */
+typedef struct
+{
+    uint32_t magic;
+    uint8_t  type;
+    uint8_t  reserved[3];
+    uint8_t  nonce[PROVISIONING_RELAY_NONCE_SIZE];
+} provisioning_relay_header_t;
+
+/* Network credential as encrypted in the response. */
+typedef struct
+{
+    uint32_t            security;
+    uint32_t            band;
+    cy_wcm_mac_t        bssid;
+    cy_wcm_ssid_t       ssid;
+    cy_wcm_passphrase_t passphrase;
+} provisioning_relay_credential_t;
+
+typedef struct
+{
+    provisioning_relay_header_t header;
+    uint8_t                     ciphertext[sizeof(provisioning_relay_credential_t)];
+    uint8_t                     tag[PROVISIONING_RELAY_TAG_SIZE];
+} provisioning_relay_response_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_rslt_t provisioning_relay_start(const cy_wcm_connect_params_t *credential);
+void provisioning_relay_stop(void);
+cy_rslt_t provisioning_relay_request(const cy_wcm_mac_t *relay_bssid, cy_wcm_wifi_band_t relay_band,
+                                     cy_wcm_connect_params_t *credential);
+uint32_t provisioning_relay_get_served_count(void);
+bool provisioning_relay_is_relay_network(uint32_t ipv4_address);
+
+/* Message framing and encryption, in provisioning_relay_protocol.c. It uses no
+ * RTOS or network services so that it can be tested on the host.
+ */
+void provisioning_relay_init_header(provisioning_relay_header_t *header, uint8_t type, const uint8_t *nonce);
+bool provisioning_relay_is_header_valid(const provisioning_relay_header_t *header, uint8_t type);
+cy_rslt_t provisioning_relay_derive_key(const uint8_t *request_nonce, const uint8_t *response_nonce, uint8_t *key);
+cy_rslt_t provisioning_relay_seal_response(const provisioning_relay_header_t *request, const uint8_t *response_nonce,
+                                           const provisioning_relay_credential_t *credential,
+                                           provisioning_relay_response_t *response);
+cy_rslt_t provisioning_relay_open_response(const provisioning_relay_header_t *request,
+                                           const provisioning_relay_response_t *response,
+                                           provisioning_relay_credential_t *credential);
+
+#endif /*SOURCE_PROVISIONING_RELAY_H_*/
+
+
+/* [] END OF FILE */
@@ -0,0 +1,303 @@
+/*******************************************************************************
+* File Name: provisioning_relay_protocol.c
+*
+* Description: This file contains the framing and the encryption of the
+* provisioning relay messages. It uses no RTOS or network services so that it
+* can be tested on the host.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <string.h>
+
+#include "provisioning_relay.h"
+
+#if (PROVISIONING_RELAY_ENABLE)
+#include "mbedtls/md.h"
+#include "mbedtls/ccm.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* CCM nonce size in bytes; the first bytes of the response nonce are used. */
+#define RELAY_CCM_NONCE_SIZE                (13u)
+#define RELAY_HMAC_SIZE                     (32u)
+
+/* Label that binds the derived key to this protocol. */
+#define RELAY_KEY_LABEL                     "wps-relay-v1"
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static void build_aad(const provisioning_relay_header_t *request, const provisioning_relay_header_t *response,
+                      uint8_t *aad);
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: provisioning_relay_init_header
+ *******************************************************************************
+ * Summary: Fills the header of a request or a response.
+ *
+ * Parameters:
+ *  provisioning_relay_header_t *header: Header to be filled.
+ *  uint8_t type: PROVISIONING_RELAY_MESSAGE_REQUEST or
+ *  PROVISIONING_RELAY_MESSAGE_RESPONSE.
+ *  const uint8_t *nonce: PROVISIONING_RELAY_NONCE_SIZE random bytes chosen by
+ *  the sender.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void provisioning_relay_init_header(provisioning_relay_header_t *header, uint8_t type, const uint8_t *nonce)
+{
+    memset(header, 0, sizeof(provisioning_relay_header_t));
+    header->magic = PROVISIONING_RELAY_MESSAGE_MAGIC;
+    header->type = type;
+    memcpy(header->nonce, nonce, PROVISIONING_RELAY_NONCE_SIZE);
+}
+
+
+/*******************************************************************************
+ * Function Name: provisioning_relay_is_header_valid
+ *******************************************************************************
+ * Summary: Checks the magic and the type of a received header.
+ *
+ * Parameters:
+ *  const provisioning_relay_header_t *header: Received header.
+ *  uint8_t type: Expected message type.
+ *
+ * Return:
+ *  bool: true if the header is of the expected type.
+ *
+ ******************************************************************************/
+bool provisioning_relay_is_header_valid(const provisioning_relay_header_t *header, uint8_t type)
+{
+    return (PROVISIONING_RELAY_MESSAGE_MAGIC == header->magic) && (type == header->type);
+}
+
+
+/*******************************************************************************
+ * Function Name: provisioning_relay_derive_key
+ *******************************************************************************
+ * Summary: Derives the AES key of one exchange as the first
+ * PROVISIONING_RELAY_KEY_SIZE bytes of
+ * HMAC-SHA256(fleet key, label | request nonce | response nonce), where the
+ * label includes its terminating NUL.
+ *
+ * Parameters:
+ *  const uint8_t *request_nonce: Nonce chosen by the new device.
+ *  const uint8_t *response_nonce: Nonce chosen by the relay.
+ *  uint8_t *key: Filled with PROVISIONING_RELAY_KEY_SIZE bytes of key.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the key was derived.
+ *
+ ******************************************************************************/
+cy_rslt_t provisioning_relay_derive_key(const uint8_t *request_nonce, const uint8_t *response_nonce, uint8_t *key)
+{
+    uint8_t input[sizeof(RELAY_KEY_LABEL) + (2u * PROVISIONING_RELAY_NONCE_SIZE)];
+    uint8_t digest[RELAY_HMAC_SIZE];
+    int crypto_result;
+
+    memcpy(input, RELAY_KEY_LABEL, sizeof(RELAY_KEY_LABEL));
+    memcpy(&input[sizeof(RELAY_KEY_LABEL)], request_nonce, PROVISIONING_RELAY_NONCE_SIZE);
+    memcpy(&input[sizeof(RELAY_KEY_LABEL) + PROVISIONING_RELAY_NONCE_SIZE], response_nonce,
+           PROVISIONING_RELAY_NONCE_SIZE);
+
+    crypto_result = mbedtls_md_hmac(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256),
+                                    (const uint8_t *)PROVISIONING_RELAY_FLEET_KEY,
+                                    sizeof(PROVISIONING_RELAY_FLEET_KEY) - 1u,
+                                    input, sizeof(input), digest);
+
+    memcpy(key, digest, PROVISIONING_RELAY_KEY_SIZE);
+    memset(digest, 0, sizeof(digest));
+
+    return (0 == crypto_result) ? CY_RSLT_SUCCESS : PROVISIONING_RELAY_RSLT_CRYPTO;
+}
+
+
+/*******************************************************************************
+ * Function Name: provisioning_relay_seal_response
+ *******************************************************************************
+ * Summary: Builds the response to a request: the header with the nonce of the
+ * relay, and the credential encrypted with AES-CCM under the key of the
+ * exchange. The request and the response header are authenticated with the
+ * credential, so the response is only accepted for the request it answers.
+ *
+ * Parameters:
+ *  const provisioning_relay_header_t *request: Validated request.
+ *  const uint8_t *response_nonce: PROVISIONING_RELAY_NONCE_SIZE random bytes
+ *  chosen by the relay.
+ *  const provisioning_relay_credential_t *credential: Credential to be served.
+ *  provisioning_relay_response_t *response: Filled with the response.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the response was built.
+ *
+ ******************************************************************************/
+cy_rslt_t provisioning_relay_seal_response(const provisioning_relay_header_t *request, const uint8_t *response_nonce,
+                                           const provisioning_relay_credential_t *credential,
+                                           provisioning_relay_response_t *response)
+{
+    uint8_t key[PROVISIONING_RELAY_KEY_SIZE];
+    uint8_t aad[2u * sizeof(provisioning_relay_header_t)];
+    mbedtls_ccm_context ccm;
+    cy_rslt_t result;
+    int crypto_result;
+
+    memset(response, 0, sizeof(provisioning_relay_response_t));
+    provisioning_relay_init_header(&response->header, PROVISIONING_RELAY_MESSAGE_RESPONSE, response_nonce);
+
+    result = provisioning_relay_derive_key(request->nonce, response->header.nonce, key);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    build_aad(request, &response->header, aad);
+
+    mbedtls_ccm_init(&ccm);
+    crypto_result = mbedtls_ccm_setkey(&ccm, MBEDTLS_CIPHER_ID_AES, key, PROVISIONING_RELAY_KEY_SIZE * 8u);
+    if (0 == crypto_result)
+    {
+        crypto_result = mbedtls_ccm_encrypt_and_tag(&ccm, sizeof(provisioning_relay_credential_t),
+                                                    response->header.nonce, RELAY_CCM_NONCE_SIZE,
+                                                    aad, sizeof(aad), (const uint8_t *)credential,
+                                                    response->ciphertext, response->tag,
+                                                    PROVISIONING_RELAY_TAG_SIZE);
+    }
+    mbedtls_ccm_free(&ccm);
+    memset(key, 0, sizeof(key));
+
+    return (0 == crypto_result) ? CY_RSLT_SUCCESS : PROVISIONING_RELAY_RSLT_CRYPTO;
+}
+
+
+/*******************************************************************************
+ * Function Name: provisioning_relay_open_response
+ *******************************************************************************
+ * Summary: Checks the header of a response, and authenticates and decrypts
+ * the credential against the request that was sent.
+ *
+ * Parameters:
+ *  const provisioning_relay_header_t *request: Request that was sent.
+ *  const provisioning_relay_response_t *response: Received response.
+ *  provisioning_relay_credential_t *credential: Filled with the credential.
+ *  It is cleared if the response is rejected.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the credential was decrypted,
+ *  PROVISIONING_RELAY_RSLT_PROTOCOL if the response header is not valid, or
+ *  PROVISIONING_RELAY_RSLT_AUTH_FAILED if the response was not sealed for
+ *  this request with the fleet key.
+ *
+ ******************************************************************************/
+cy_rslt_t provisioning_relay_open_response(const provisioning_relay_header_t *request,
+                                           const provisioning_relay_response_t *response,
+                                           provisioning_relay_credential_t *credential)
+{
+    uint8_t key[PROVISIONING_RELAY_KEY_SIZE];
+    uint8_t aad[2u * sizeof(provisioning_relay_header_t)];
+    mbedtls_ccm_context ccm;
+    cy_rslt_t result;
+
+    memset(credential, 0, sizeof(provisioning_relay_credential_t));
+
+    if (!provisioning_relay_is_header_valid(&response->header, PROVISIONING_RELAY_MESSAGE_RESPONSE))
+    {
+        return PROVISIONING_RELAY_RSLT_PROTOCOL;
+    }
+
+    result = provisioning_relay_derive_key(request->nonce, response->header.nonce, key);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    build_aad(request, &response->header, aad);
+
+    mbedtls_ccm_init(&ccm);
+    if ((0 != mbedtls_ccm_setkey(&ccm, MBEDTLS_CIPHER_ID_AES, key, PROVISIONING_RELAY_KEY_SIZE * 8u)) ||
+        (0 != mbedtls_ccm_auth_decrypt(&ccm, sizeof(provisioning_relay_credential_t), response->header.nonce,
+                                       RELAY_CCM_NONCE_SIZE, aad, sizeof(aad), response->ciphertext,
+                                       (uint8_t *)credential, response->tag, PROVISIONING_RELAY_TAG_SIZE)))
+    {
+        memset(credential, 0, sizeof(provisioning_relay_credential_t));
+        result = PROVISIONING_RELAY_RSLT_AUTH_FAILED;
+    }
+    mbedtls_ccm_free(&ccm);
+    memset(key, 0, sizeof(key));
+
+    return result;
+}
+
+
+/*******************************************************************************
+ * Function Name: build_aad
+ *******************************************************************************
+ * Summary: Concatenates the request and the response header, which are
+ * authenticated along with the credential so that a response recorded for an
+ * earlier request is rejected.
+ *
+ * Parameters:
+ *  const provisioning_relay_header_t *request: Request of the exchange.
+ *  const provisioning_relay_header_t *response: Response header.
+ *  uint8_t *aad: Filled with 2 * sizeof(provisioning_relay_header_t) bytes.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void build_aad(const provisioning_relay_header_t *request, const provisioning_relay_header_t *response,
+                      uint8_t *aad)
+{
+    memcpy(aad, request, sizeof(provisioning_relay_header_t));
+    memcpy(&aad[sizeof(provisioning_relay_header_t)], response, sizeof(provisioning_relay_header_t));
+}
+
+#endif /* PROVISIONING_RELAY_ENABLE */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,714 @@
+/*******************************************************************************
+* File Name: bench_pool_allocator.c
+*
+* Description: Host benchmark of the pool allocator (pool_allocator.c) against
+* heap_3, which wraps the C library malloc() and free() in a suspension of the
+* scheduler. Both allocators replay the same pseudo-random sequence of
+* allocations and frees, with the sizes and the number of live blocks of a
+* WPS and connection cycle, and the time of each call is measured.
+*
+* A second, phased workload repeats WPS and connection cycles: bursts of
+* short-lived blocks around each WPS message and handshake step, buffers held
+* for the length of a phase, and objects that live for a few cycles. It is
+* replayed against the pool and against a first-fit heap in a fixed arena,
+* which stands in for the C library heap of the target (the host C library
+* grows its heap on demand, so its fragmentation cannot be measured). For the
+* first-fit heap, the largest free block is compared with the total free
+* memory; for the pool, the requested bytes are compared with the bytes of
+* the blocks that hold them.
+*
+* The absolute times depend on the host C library and are not those of the
+* target. On the host, the pool is slower on average than heap_3 and has the
+* shorter tail; what it buys is the absence of external fragmentation, paid
+* for with the internal fragmentation of its size classes.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cy_utils.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "pool_allocator.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define BENCH_OPERATIONS                    (2000000u)
+#define BENCH_LIVE_SLOTS                    (96u)
+#define BENCH_SEED                          (0x5EEDu)
+
+/* Call times are counted in buckets of this width up to the last bucket,
+ * which holds all the longer calls.
+ */
+#define BENCH_BUCKET_NSEC                   (10u)
+#define BENCH_BUCKET_COUNT                  (1000u)
+
+/* Phased workload: number of cycles, of which every other one starts with
+ * WPS, and number of cycles that the objects kept after a cycle live.
+ */
+#define BENCH_CYCLES                        (20000u)
+#define BENCH_OBJECT_LIFETIME_CYCLES        (4u)
+#define BENCH_OBJECTS_PER_CYCLE             (3u)
+#define BENCH_OBJECT_SLOTS                  (BENCH_OBJECT_LIFETIME_CYCLES * BENCH_OBJECTS_PER_CYCLE)
+
+#define BENCH_WPS_MESSAGES                  (8u)
+#define BENCH_BURST_BLOCKS                  (24u)
+#define BENCH_SCAN_RESULTS                  (12u)
+#define BENCH_HANDSHAKE_STEPS               (4u)
+#define BENCH_DHCP_BUFFERS                  (2u)
+#define BENCH_DHCP_BUFFER_SIZE              (1536u)
+#define BENCH_CONNECT_BLOCKS                (BENCH_SCAN_RESULTS + BENCH_HANDSHAKE_STEPS + BENCH_DHCP_BUFFERS)
+
+/* Arena of the first-fit heap: room for the pool arena and for the requests
+ * that the pool passes on to the C library heap.
+ */
+#define BENCH_FIT_HEAP_SIZE                 (32u * 1024u)
+#define BENCH_FIT_ALIGNMENT                 (16u)
+#define BENCH_FIT_MIN_SPLIT                 (32u)
+
+#define BENCH_PICK(seed, table)             ((table)[next_random(seed) % (sizeof(table) / sizeof((table)[0]))])
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef struct
+{
+    const char *name;
+    void *(*allocate)(size_t size);
+    void (*release)(void *pv);
+    void (*sample)(uint32_t *used, uint32_t *total);   /* Fragmentation, or NULL */
+} bench_allocator_t;
+
+typedef struct
+{
+    uint64_t total_nsec;
+    uint64_t max_nsec;
+    uint32_t calls;
+    uint32_t failures;
+    uint32_t histogram[BENCH_BUCKET_COUNT];
+} bench_result_t;
+
+/* Ratio sampled once per cycle, in per mille. */
+typedef struct
+{
+    uint32_t samples;
+    uint32_t worst_per_mille;
+    uint64_t total_per_mille;
+} bench_ratio_t;
+
+typedef struct
+{
+    bench_ratio_t peak;             /* With the blocks of the cycle in use */
+    bench_ratio_t idle;             /* Between cycles */
+} bench_fragmentation_t;
+
+/* Block of the first-fit heap. The header stays in front of the allocated
+ * memory; the link is used while the block is free.
+ */
+typedef struct bench_fit_block
+{
+    size_t                 size;    /* Including the header */
+    struct bench_fit_block *next;
+} bench_fit_block_t;
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/* Request sizes weighted as seen in the allocation trace of a WPS and
+ * connection cycle: mostly control blocks and small buffers, few large ones.
+ */
+static const uint16_t bench_sizes[] =
+{
+    16, 24, 24, 32, 32, 40, 48, 56, 64, 64, 80, 96, 120, 128, 160, 200,
+    256, 300, 384, 512, 640, 1024, 1500, 2048
+};
+
+/* Sizes of the phased workload: bignum limbs and contexts of the DH exchange
+ * and the handshake, WPS and EAP messages, scan results, EAPOL-Key frames,
+ * and the objects kept after the cycle, such as the credential and sockets.
+ */
+static const uint16_t burst_sizes[] = { 16, 24, 32, 48, 64, 64, 96, 128, 200 };
+static const uint16_t message_sizes[] = { 300, 384, 420, 480, 512, 600, 640 };
+static const uint16_t scan_sizes[] = { 80, 96, 120, 160 };
+static const uint16_t handshake_sizes[] = { 128, 160, 200, 256 };
+static const uint16_t object_sizes[] = { 96, 200, 320 };
+
+static bench_result_t results[2];
+static bench_result_t phased_results[2];
+static bench_fragmentation_t fragmentation[2];
+
+static CY_ALIGN(BENCH_FIT_ALIGNMENT) uint8_t fit_heap[BENCH_FIT_HEAP_SIZE];
+static bench_fit_block_t *fit_free_list = NULL;
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+void vApplicationMallocFailedHook(void)
+{
+}
+
+
+/* heap_3.c of the FreeRTOS kernel, which the pool allocator replaced. */
+static void *heap3_malloc(size_t wanted_size)
+{
+    void *block;
+
+    vTaskSuspendAll();
+    block = malloc(wanted_size);
+    (void)xTaskResumeAll();
+
+    return block;
+}
+
+
+static void heap3_free(void *pv)
+{
+    if (NULL != pv)
+    {
+        vTaskSuspendAll();
+        free(pv);
+        (void)xTaskResumeAll();
+    }
+}
+
+
+/* First-fit heap with an address-ordered free list whose neighbouring blocks
+ * are merged on free, as the C library heap of the target and heap_4 do, in
+ * an arena that does not grow.
+ */
+static void fit_init(void)
+{
+    fit_free_list = (bench_fit_block_t *)fit_heap;
+    fit_free_list->size = BENCH_FIT_HEAP_SIZE;
+    fit_free_list->next = NULL;
+}
+
+
+static void *fit_malloc(size_t wanted_size)
+{
+    size_t size = (wanted_size + sizeof(bench_fit_block_t) + (BENCH_FIT_ALIGNMENT - 1u)) &
+                  ~(size_t)(BENCH_FIT_ALIGNMENT - 1u);
+    bench_fit_block_t **link = &fit_free_list;
+    bench_fit_block_t *block = NULL;
+    bench_fit_block_t *rest;
+
+    vTaskSuspendAll();
+    while ((NULL != *link) && ((*link)->size < size))
+    {
+        link = &(*link)->next;
+    }
+
+    if (NULL != *link)
+    {
+        block = *link;
+        if ((block->size - size) >= BENCH_FIT_MIN_SPLIT)
+        {
+            rest = (bench_fit_block_t *)((uint8_t *)block + size);
+            rest->size = block->size - size;
+            rest->next = block->next;
+            block->size = size;
+            *link = rest;
+        }
+        else
+        {
+            *link = block->next;
+        }
+    }
+    (void)xTaskResumeAll();
+
+    return (NULL != block) ? (void *)(block + 1) : NULL;
+}
+
+
+static void fit_free(void *pv)
+{
+    bench_fit_block_t *block = (bench_fit_block_t *)pv - 1;
+    bench_fit_block_t *previous = NULL;
+    bench_fit_block_t *next;
+
+    if (NULL == pv)
+    {
+        return;
+    }
+
+    vTaskSuspendAll();
+    next = fit_free_list;
+    while ((NULL != next) && (next < block))
+    {
+        previous = next;
+        next = next->next;
+    }
+
+    block->next = next;
+    if ((NULL != next) && (((uint8_t *)block + block->size) == (uint8_t *)next))
+    {
+        block->size += next->size;
+        block->next = next->next;
+    }
+
+    if (NULL == previous)
+    {
+        fit_free_list = block;
+    }
+    else if (((uint8_t *)previous + previous->size) == (uint8_t *)block)
+    {
+        previous->size += block->size;
+        previous->next = block->next;
+    }
+    else
+    {
+        previous->next = block;
+    }
+    (void)xTaskResumeAll();
+}
+
+
+/* External fragmentation: the largest free block against the free memory. */
+static void sample_fit_heap(uint32_t *used, uint32_t *total)
+{
+    *used = 0;
+    *total = 0;
+
+    for (bench_fit_block_t *block = fit_free_list; NULL != block; block = block->next)
+    {
+        *total += (uint32_t)block->size;
+        if (block->size > *used)
+        {
+            *used = (uint32_t)block->size;
+        }
+    }
+}
+
+
+/* Internal fragmentation: the requested bytes against the bytes of the
+ * blocks that hold them.
+ */
+static void sample_pool(uint32_t *used, uint32_t *total)
+{
+    pool_allocator_class_stats_t stats;
+
+    *used = 0;
+    *total = 0;
+
+    for (uint32_t index = 0; index < POOL_ALLOCATOR_CLASS_COUNT; index++)
+    {
+        pool_allocator_get_class_stats(index, &stats);
+        *used += stats.requested_bytes_in_use;
+        *total += stats.blocks_in_use * stats.block_size;
+    }
+}
+
+
+static uint64_t now_nsec(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+
+static uint32_t next_random(uint32_t *seed)
+{
+    *seed = (*seed * 1103515245u) + 12345u;
+
+    return *seed >> 8;
+}
+
+
+static void record_call(bench_result_t *result, uint64_t nsec)
+{
+    uint64_t bucket = nsec / BENCH_BUCKET_NSEC;
+
+    result->total_nsec += nsec;
+    result->calls++;
+    if (nsec > result->max_nsec)
+    {
+        result->max_nsec = nsec;
+    }
+    result->histogram[(bucket < BENCH_BUCKET_COUNT) ? bucket : (BENCH_BUCKET_COUNT - 1u)]++;
+}
+
+
+static void record_ratio(bench_ratio_t *ratio, const bench_allocator_t *allocator)
+{
+    uint32_t used;
+    uint32_t total;
+    uint32_t per_mille;
+
+    allocator->sample(&used, &total);
+    if (0u == total)
+    {
+        return;
+    }
+
+    per_mille = (uint32_t)(((uint64_t)used * 1000u) / total);
+    if ((0u == ratio->samples) || (per_mille < ratio->worst_per_mille))
+    {
+        ratio->worst_per_mille = per_mille;
+    }
+    ratio->total_per_mille += per_mille;
+    ratio->samples++;
+}
+
+
+/* Returns the call time below which the given per mille of the calls fall. */
+static uint64_t percentile_nsec(const bench_result_t *result, uint32_t per_mille)
+{
+    uint64_t target = ((uint64_t)result->calls * per_mille) / 1000u;
+    uint64_t count = 0;
+
+    for (uint32_t bucket = 0; bucket < BENCH_BUCKET_COUNT; bucket++)
+    {
+        count += result->histogram[bucket];
+        if (count >= target)
+        {
+            return (uint64_t)(bucket + 1u) * BENCH_BUCKET_NSEC;
+        }
+    }
+
+    return result->max_nsec;
+}
+
+
+/* Each step picks a slot at random and frees its block, or allocates one of
+ * a random size if the slot is empty.
+ */
+static void run_benchmark(const bench_allocator_t *allocator, bench_result_t *result)
+{
+    void *slots[BENCH_LIVE_SLOTS] = { NULL };
+    uint32_t seed = BENCH_SEED;
+    uint64_t start;
+    uint64_t nsec;
+
+    memset(result, 0, sizeof(*result));
+
+    for (uint32_t operation = 0; operation < BENCH_OPERATIONS; operation++)
+    {
+        uint32_t slot;
+        size_t size;
+
+        seed = (seed * 1103515245u) + 12345u;
+        slot = (seed >> 8) % BENCH_LIVE_SLOTS;
+        size = bench_sizes[(seed >> 20) % (sizeof(bench_sizes) / sizeof(bench_sizes[0]))];
+
+        if (NULL != slots[slot])
+        {
+            start = now_nsec();
+            allocator->release(slots[slot]);
+            nsec = now_nsec() - start;
+            slots[slot] = NULL;
+        }
+        else
+        {
+            start = now_nsec();
+            slots[slot] = allocator->allocate(size);
+            nsec = now_nsec() - start;
+
+            if (NULL == slots[slot])
+            {
+                result->failures++;
+            }
+            else
+            {
+                /* Touch the block as its user would. */
+                memset(slots[slot], 0x5A, size);
+            }
+        }
+
+        record_call(result, nsec);
+    }
+
+    for (uint32_t slot = 0; slot < BENCH_LIVE_SLOTS; slot++)
+    {
+        allocator->release(slots[slot]);
+    }
+}
+
+
+static void *timed_allocate(const bench_allocator_t *allocator, bench_result_t *result, size_t size)
+{
+    uint64_t start = now_nsec();
+    void *block = allocator->allocate(size);
+
+    record_call(result, now_nsec() - start);
+
+    if (NULL == block)
+    {
+        result->failures++;
+    }
+    else
+    {
+        memset(block, 0x5A, size);
+    }
+
+    return block;
+}
+
+
+static void timed_release(const bench_allocator_t *allocator, bench_result_t *result, void *block)
+{
+    uint64_t start;
+
+    if (NULL != block)
+    {
+        start = now_nsec();
+        allocator->release(block);
+        record_call(result, now_nsec() - start);
+    }
+}
+
+
+/* Frees the blocks in a random order and clears their pointers. */
+static void release_shuffled(const bench_allocator_t *allocator, bench_result_t *result,
+                             void **blocks, uint32_t count, uint32_t *seed)
+{
+    void *block;
+    uint32_t other;
+
+    for (uint32_t index = count; index > 1u; index--)
+    {
+        other = next_random(seed) % index;
+        block = blocks[index - 1u];
+        blocks[index - 1u] = blocks[other];
+        blocks[other] = block;
+    }
+
+    for (uint32_t index = 0; index < count; index++)
+    {
+        timed_release(allocator, result, blocks[index]);
+        blocks[index] = NULL;
+    }
+}
+
+
+/* Short-lived blocks of one computation, such as a DH exponentiation. */
+static void run_burst(const bench_allocator_t *allocator, bench_result_t *result, uint32_t *seed)
+{
+    void *blocks[BENCH_BURST_BLOCKS];
+
+    for (uint32_t index = 0; index < BENCH_BURST_BLOCKS; index++)
+    {
+        blocks[index] = timed_allocate(allocator, result, BENCH_PICK(seed, burst_sizes));
+    }
+
+    release_shuffled(allocator, result, blocks, BENCH_BURST_BLOCKS, seed);
+}
+
+
+/* Every cycle frees the objects kept by the cycle BENCH_OBJECT_LIFETIME_CYCLES
+ * before it. Every other cycle runs WPS, which holds a message buffer for
+ * each exchange and runs a burst for it, and keeps the credential. Every
+ * cycle then connects: the scan results, an EAPOL-Key frame and a burst for
+ * each handshake step, and the DHCP buffers are held until the connection is
+ * up, and the sockets are kept.
+ */
+static void run_phased_benchmark(const bench_allocator_t *allocator, bench_result_t *result,
+                                 bench_fragmentation_t *ratios)
+{
+    void *objects[BENCH_OBJECT_SLOTS] = { NULL };
+    void *messages[BENCH_WPS_MESSAGES];
+    void *connect_blocks[BENCH_CONNECT_BLOCKS];
+    uint32_t seed = BENCH_SEED;
+    uint32_t object;
+    uint32_t block;
+
+    memset(result, 0, sizeof(*result));
+    memset(ratios, 0, sizeof(*ratios));
+
+    for (uint32_t cycle = 0; cycle < BENCH_CYCLES; cycle++)
+    {
+        object = (cycle % BENCH_OBJECT_LIFETIME_CYCLES) * BENCH_OBJECTS_PER_CYCLE;
+        for (uint32_t index = 0; index < BENCH_OBJECTS_PER_CYCLE; index++)
+        {
+            timed_release(allocator, result, objects[object + index]);
+            objects[object + index] = NULL;
+        }
+
+        if (0u == (cycle % 2u))
+        {
+            for (uint32_t index = 0; index < BENCH_WPS_MESSAGES; index++)
+            {
+                messages[index] = timed_allocate(allocator, result, BENCH_PICK(&seed, message_sizes));
+                run_burst(allocator, result, &seed);
+            }
+
+            objects[object] = timed_allocate(allocator, result, BENCH_PICK(&seed, object_sizes));
+            record_ratio(&ratios->peak, allocator);
+
+            for (uint32_t index = 0; index < BENCH_WPS_MESSAGES; index++)
+            {
+                timed_release(allocator, result, messages[index]);
+            }
+        }
+
+        block = 0;
+        for (uint32_t index = 0; index < BENCH_SCAN_RESULTS; index++)
+        {
+            connect_blocks[block++] = timed_allocate(allocator, result, BENCH_PICK(&seed, scan_sizes));
+        }
+
+        for (uint32_t index = 0; index < BENCH_HANDSHAKE_STEPS; index++)
+        {
+            connect_blocks[block++] = timed_allocate(allocator, result, BENCH_PICK(&seed, handshake_sizes));
+            run_burst(allocator, result, &seed);
+        }
+
+        for (uint32_t index = 0; index < BENCH_DHCP_BUFFERS; index++)
+        {
+            connect_blocks[block++] = timed_allocate(allocator, result, BENCH_DHCP_BUFFER_SIZE);
+        }
+
+        for (uint32_t index = 1u; index < BENCH_OBJECTS_PER_CYCLE; index++)
+        {
+            objects[object + index] = timed_allocate(allocator, result, BENCH_PICK(&seed, object_sizes));
+        }
+        record_ratio(&ratios->peak, allocator);
+
+        release_shuffled(allocator, result, connect_blocks, BENCH_CONNECT_BLOCKS, &seed);
+        record_ratio(&ratios->idle, allocator);
+    }
+
+    for (uint32_t index = 0; index < BENCH_OBJECT_SLOTS; index++)
+    {
+        timed_release(allocator, result, objects[index]);
+    }
+}
+
+
+static void print_times(const char *name, const bench_result_t *result)
+{
+    printf("  %-10s %10lu %10lu %10lu %10lu %10lu\n", name,
+           (unsigned long)(result->total_nsec / result->calls),
+           (unsigned long)percentile_nsec(result, 500u),
+           (unsigned long)percentile_nsec(result, 990u),
+           (unsigned long)percentile_nsec(result, 999u),
+           (unsigned long)result->max_nsec);
+}
+
+
+static void print_ratio(const bench_ratio_t *ratio)
+{
+    uint32_t mean = (uint32_t)(ratio->total_per_mille / ((0u != ratio->samples) ? ratio->samples : 1u));
+
+    printf(" %8lu.%lu%% %8lu.%lu%%", (unsigned long)(ratio->worst_per_mille / 10u),
+           (unsigned long)(ratio->worst_per_mille % 10u), (unsigned long)(mean / 10u), (unsigned long)(mean % 10u));
+}
+
+
+int main(void)
+{
+    static const bench_allocator_t allocators[2] =
+    {
+        { "heap_3", heap3_malloc, heap3_free, NULL },
+        { "pool",   pvPortMalloc, vPortFree,  NULL }
+    };
+    static const bench_allocator_t phased_allocators[2] =
+    {
+        { "first-fit", fit_malloc,   fit_free,  sample_fit_heap },
+        { "pool",      pvPortMalloc, vPortFree, sample_pool }
+    };
+    pool_allocator_heap_stats_t heap_before;
+    pool_allocator_heap_stats_t heap_after;
+    uint32_t failures = 0;
+    uint64_t timer_overhead;
+    uint64_t start = now_nsec();
+
+    for (uint32_t index = 0; index < 1000u; index++)
+    {
+        (void)now_nsec();
+    }
+    timer_overhead = (now_nsec() - start) / 1000u;
+
+    printf("Pool allocator against heap_3: %lu calls, %lu live slots, timer overhead %lu ns\n",
+           (unsigned long)BENCH_OPERATIONS, (unsigned long)BENCH_LIVE_SLOTS, (unsigned long)timer_overhead);
+    printf("  %-10s %10s %10s %10s %10s %10s\n", "Heap", "mean ns", "p50 ns", "p99 ns", "p99.9 ns", "max ns");
+
+    for (uint32_t index = 0; index < 2u; index++)
+    {
+        run_benchmark(&allocators[index], &results[index]);
+        print_times(allocators[index].name, &results[index]);
+        failures += results[index].failures;
+    }
+
+    fit_init();
+    pool_allocator_get_heap_stats(&heap_before);
+
+    for (uint32_t index = 0; index < 2u; index++)
+    {
+        run_phased_benchmark(&phased_allocators[index], &phased_results[index], &fragmentation[index]);
+        failures += phased_results[index].failures;
+    }
+
+    pool_allocator_get_heap_stats(&heap_after);
+
+    printf("\nPool allocator against a %lu-byte first-fit heap: %lu WPS and connection cycles, %lu calls\n",
+           (unsigned long)BENCH_FIT_HEAP_SIZE, (unsigned long)BENCH_CYCLES, (unsigned long)phased_results[1].calls);
+    printf("  %-10s %10s %10s %10s %10s %10s\n", "Heap", "mean ns", "p50 ns", "p99 ns", "p99.9 ns", "max ns");
+    for (uint32_t index = 0; index < 2u; index++)
+    {
+        print_times(phased_allocators[index].name, &phased_results[index]);
+    }
+
+    printf("  %-10s %-34s %11s %11s %11s %11s\n", "Heap", "Fragmentation ratio", "peak worst", "peak mean",
+           "idle worst", "idle mean");
+    printf("  %-10s %-34s", "first-fit", "largest free block / free memory");
+    print_ratio(&fragmentation[0].peak);
+    print_ratio(&fragmentation[0].idle);
+    printf("\n  %-10s %-34s", "pool", "requested bytes / block bytes");
+    print_ratio(&fragmentation[1].peak);
+    print_ratio(&fragmentation[1].idle);
+    printf("\n  pool requests passed to the C library heap: %lu larger than the largest class, %lu with the classes full\n",
+           (unsigned long)(heap_after.large_allocations - heap_before.large_allocations),
+           (unsigned long)(heap_after.overflow_allocations - heap_before.overflow_allocations));
+
+    return (0u == failures) ? 0 : 1;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,297 @@
+/*******************************************************************************
+* File Name: freertos_host.c
+*
+* Description: This file implements the host stand-ins of the FreeRTOS
+* services declared in the headers of tests/stubs over POSIX threads. Only the
+* behaviour the modules under test rely on is provided: the tick count,
+* critical sections, scheduler suspension, mutexes, and event groups.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "event_groups.h"
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+struct host_semaphore
+{
+    pthread_mutex_t mutex;
+};
+
+struct host_event_group
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t  changed;
+    EventBits_t     bits;
+};
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static pthread_mutex_t critical_mutex;
+static pthread_once_t critical_once = PTHREAD_ONCE_INIT;
+static TickType_t (*volatile tick_source)(void) = NULL;
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/* Returns the absolute CLOCK_REALTIME time the given number of ticks ahead. */
+static struct timespec deadline_after(TickType_t ticks)
+{
+    struct timespec deadline;
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += (time_t)(ticks / 1000u);
+    deadline.tv_nsec += (long)(ticks % 1000u) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    return deadline;
+}
+
+
+static void critical_init(void)
+{
+    pthread_mutexattr_t attr;
+
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&critical_mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+
+
+void host_enter_critical(void)
+{
+    pthread_once(&critical_once, critical_init);
+    pthread_mutex_lock(&critical_mutex);
+}
+
+
+void host_exit_critical(void)
+{
+    pthread_mutex_unlock(&critical_mutex);
+}
+
+
+void host_set_tick_source(TickType_t (*source)(void))
+{
+    tick_source = source;
+}
+
+
+TickType_t xTaskGetTickCount(void)
+{
+    struct timespec now;
+
+    if (NULL != tick_source)
+    {
+        return tick_source();
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (TickType_t)((uint64_t)now.tv_sec * 1000u + (uint64_t)now.tv_nsec / 1000000u);
+}
+
+
+void vTaskDelay(TickType_t ticks)
+{
+    struct timespec delay = { .tv_sec = (time_t)(ticks / 1000u), .tv_nsec = (long)(ticks % 1000u) * 1000000L };
+
+    nanosleep(&delay, NULL);
+}
+
+
+/* With a single lock for the critical sections and the scheduler, suspending
+ * the scheduler excludes the other threads as it excludes the other tasks.
+ */
+void vTaskSuspendAll(void)
+{
+    host_enter_critical();
+}
+
+
+BaseType_t xTaskResumeAll(void)
+{
+    host_exit_critical();
+
+    return pdFALSE;
+}
+
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    SemaphoreHandle_t semaphore = malloc(sizeof(*semaphore));
+
+    if (NULL != semaphore)
+    {
+        pthread_mutex_init(&semaphore->mutex, NULL);
+    }
+
+    return semaphore;
+}
+
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks)
+{
+    struct timespec deadline;
+
+    if (portMAX_DELAY == ticks)
+    {
+        return (0 == pthread_mutex_lock(&semaphore->mutex)) ? pdTRUE : pdFALSE;
+    }
+
+    deadline = deadline_after(ticks);
+
+    return (0 == pthread_mutex_timedlock(&semaphore->mutex, &deadline)) ? pdTRUE : pdFALSE;
+}
+
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    return (0 == pthread_mutex_unlock(&semaphore->mutex)) ? pdTRUE : pdFALSE;
+}
+
+
+EventGroupHandle_t xEventGroupCreate(void)
+{
+    EventGroupHandle_t group = malloc(sizeof(*group));
+
+    if (NULL != group)
+    {
+        pthread_mutex_init(&group->mutex, NULL);
+        pthread_cond_init(&group->changed, NULL);
+        group->bits = 0;
+    }
+
+    return group;
+}
+
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    EventBits_t result;
+
+    pthread_mutex_lock(&group->mutex);
+    group->bits |= bits;
+    result = group->bits;
+    pthread_cond_broadcast(&group->changed);
+    pthread_mutex_unlock(&group->mutex);
+
+    return result;
+}
+
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    EventBits_t previous;
+
+    pthread_mutex_lock(&group->mutex);
+    previous = group->bits;
+    group->bits &= ~bits;
+    pthread_mutex_unlock(&group->mutex);
+
+    return previous;
+}
+
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group)
+{
+    EventBits_t bits;
+
+    pthread_mutex_lock(&group->mutex);
+    bits = group->bits;
+    pthread_mutex_unlock(&group->mutex);
+
+    return bits;
+}
+
+
+/* Checks whether the awaited bits of an event group are set. */
+static bool are_bits_set(EventBits_t current, EventBits_t bits, BaseType_t wait_for_all)
+{
+    return (pdFALSE != wait_for_all) ? ((current & bits) == bits) : (0u != (current & bits));
+}
+
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clear_on_exit,
+                                BaseType_t wait_for_all, TickType_t ticks)
+{
+    struct timespec deadline = deadline_after(ticks);
+    EventBits_t result;
+    int status = 0;
+
+    pthread_mutex_lock(&group->mutex);
+
+    while (!are_bits_set(group->bits, bits, wait_for_all) && (0u != ticks) && (ETIMEDOUT != status))
+    {
+        status = (portMAX_DELAY == ticks) ? pthread_cond_wait(&group->changed, &group->mutex) :
+                                            pthread_cond_timedwait(&group->changed, &group->mutex, &deadline);
+    }
+
+    result = group->bits;
+    if ((pdFALSE != clear_on_exit) && are_bits_set(result, bits, wait_for_all))
+    {
+        group->bits &= ~bits;
+    }
+
+    pthread_mutex_unlock(&group->mutex);
+
+    return result;
+}
+
+
+/* [] END OF FILE */
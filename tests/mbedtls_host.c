@@ -0,0 +1,217 @@
+/*******************************************************************************
+* File Name: mbedtls_host.c
+*
+* Description: This file implements the host stand-ins of the mbedTLS HMAC and
+* CCM functions declared in tests/stubs/mbedtls over OpenSSL, so that the
+* provisioning relay protocol runs on the host with real cryptography.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <string.h>
+
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+#include "mbedtls/md.h"
+#include "mbedtls/ccm.h"
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+struct mbedtls_md_info_t
+{
+    mbedtls_md_type_t type;
+};
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static const mbedtls_md_info_t sha256_info = { MBEDTLS_MD_SHA256 };
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static const EVP_CIPHER *ccm_cipher(const mbedtls_ccm_context *ctx);
+static int ccm_start(EVP_CIPHER_CTX *evp, const mbedtls_ccm_context *ctx, int is_encrypt, size_t length,
+                     const unsigned char *iv, size_t iv_len, const unsigned char *add, size_t add_len,
+                     const unsigned char *tag, size_t tag_len);
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+const mbedtls_md_info_t *mbedtls_md_info_from_type(mbedtls_md_type_t md_type)
+{
+    return (MBEDTLS_MD_SHA256 == md_type) ? &sha256_info : NULL;
+}
+
+
+int mbedtls_md_hmac(const mbedtls_md_info_t *md_info, const unsigned char *key, size_t keylen,
+                    const unsigned char *input, size_t ilen, unsigned char *output)
+{
+    unsigned int length = 0;
+
+    if ((NULL == md_info) ||
+        (NULL == HMAC(EVP_sha256(), key, (int)keylen, input, ilen, output, &length)))
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+
+void mbedtls_ccm_init(mbedtls_ccm_context *ctx)
+{
+    memset(ctx, 0, sizeof(mbedtls_ccm_context));
+}
+
+
+int mbedtls_ccm_setkey(mbedtls_ccm_context *ctx, mbedtls_cipher_id_t cipher,
+                       const unsigned char *key, unsigned int keybits)
+{
+    if ((MBEDTLS_CIPHER_ID_AES != cipher) || ((128u != keybits) && (256u != keybits)))
+    {
+        return MBEDTLS_ERR_CCM_BAD_INPUT;
+    }
+
+    memcpy(ctx->key, key, keybits / 8u);
+    ctx->keybits = keybits;
+
+    return 0;
+}
+
+
+void mbedtls_ccm_free(mbedtls_ccm_context *ctx)
+{
+    memset(ctx, 0, sizeof(mbedtls_ccm_context));
+}
+
+
+int mbedtls_ccm_encrypt_and_tag(mbedtls_ccm_context *ctx, size_t length,
+                                const unsigned char *iv, size_t iv_len,
+                                const unsigned char *add, size_t add_len,
+                                const unsigned char *input, unsigned char *output,
+                                unsigned char *tag, size_t tag_len)
+{
+    EVP_CIPHER_CTX *evp = EVP_CIPHER_CTX_new();
+    int out_length;
+    int result = MBEDTLS_ERR_CCM_BAD_INPUT;
+
+    if ((NULL != evp) &&
+        (0 == ccm_start(evp, ctx, 1, length, iv, iv_len, add, add_len, NULL, tag_len)) &&
+        (1 == EVP_EncryptUpdate(evp, output, &out_length, input, (int)length)) &&
+        (1 == EVP_EncryptFinal_ex(evp, output + out_length, &out_length)) &&
+        (1 == EVP_CIPHER_CTX_ctrl(evp, EVP_CTRL_AEAD_GET_TAG, (int)tag_len, tag)))
+    {
+        result = 0;
+    }
+
+    EVP_CIPHER_CTX_free(evp);
+
+    return result;
+}
+
+
+int mbedtls_ccm_auth_decrypt(mbedtls_ccm_context *ctx, size_t length,
+                             const unsigned char *iv, size_t iv_len,
+                             const unsigned char *add, size_t add_len,
+                             const unsigned char *input, unsigned char *output,
+                             const unsigned char *tag, size_t tag_len)
+{
+    EVP_CIPHER_CTX *evp = EVP_CIPHER_CTX_new();
+    int out_length;
+    int result = MBEDTLS_ERR_CCM_BAD_INPUT;
+
+    if ((NULL != evp) && (0 == ccm_start(evp, ctx, 0, length, iv, iv_len, add, add_len, tag, tag_len)))
+    {
+        /* The tag is verified by the single update of the payload. */
+        result = (1 == EVP_DecryptUpdate(evp, output, &out_length, input, (int)length)) ?
+                 0 : MBEDTLS_ERR_CCM_AUTH_FAILED;
+    }
+
+    if (0 != result)
+    {
+        memset(output, 0, length);
+    }
+
+    EVP_CIPHER_CTX_free(evp);
+
+    return result;
+}
+
+
+static const EVP_CIPHER *ccm_cipher(const mbedtls_ccm_context *ctx)
+{
+    return (256u == ctx->keybits) ? EVP_aes_256_ccm() : EVP_aes_128_ccm();
+}
+
+
+/* Sets the key, the nonce, the tag length (and the tag to verify), the
+ * payload length, and the additional data, which CCM needs before the payload.
+ */
+static int ccm_start(EVP_CIPHER_CTX *evp, const mbedtls_ccm_context *ctx, int is_encrypt, size_t length,
+                     const unsigned char *iv, size_t iv_len, const unsigned char *add, size_t add_len,
+                     const unsigned char *tag, size_t tag_len)
+{
+    int out_length;
+
+    if ((0u == ctx->keybits) ||
+        (1 != EVP_CipherInit_ex(evp, ccm_cipher(ctx), NULL, NULL, NULL, is_encrypt)) ||
+        (1 != EVP_CIPHER_CTX_ctrl(evp, EVP_CTRL_AEAD_SET_IVLEN, (int)iv_len, NULL)) ||
+        (1 != EVP_CIPHER_CTX_ctrl(evp, EVP_CTRL_AEAD_SET_TAG, (int)tag_len, (void *)tag)) ||
+        (1 != EVP_CipherInit_ex(evp, NULL, NULL, ctx->key, iv, is_encrypt)) ||
+        (1 != EVP_CipherUpdate(evp, NULL, &out_length, NULL, (int)length)))
+    {
+        return MBEDTLS_ERR_CCM_BAD_INPUT;
+    }
+
+    if ((add_len > 0u) && (1 != EVP_CipherUpdate(evp, NULL, &out_length, add, (int)add_len)))
+    {
+        return MBEDTLS_ERR_CCM_BAD_INPUT;
+    }
+
+    return 0;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,298 @@
+/*******************************************************************************
+* File Name: ram_flash.c
+*
+* Description: This file contains a RAM-backed stand-in for the serial NOR
+* flash of the connection journal. Like NOR flash, an erase sets the bytes of a
+* sector to 0xFF and a program can only clear bits. A program can be torn to
+* reproduce a reset in the middle of a record, and programs and erases can be
+* made to fail.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <string.h>
+
+#include "ram_flash.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define RAM_FLASH_RSLT_MODULE               (CY_RSLT_MODULE_MIDDLEWARE_BASE + 0x80u)
+#define RAM_FLASH_RSLT_BAD_ADDRESS          CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, RAM_FLASH_RSLT_MODULE, 1u)
+#define RAM_FLASH_RSLT_INJECTED_FAULT       CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, RAM_FLASH_RSLT_MODULE, 2u)
+
+/* No program is torn. */
+#define TEAR_NONE                           (0xFFFFFFFFu)
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static cy_rslt_t ram_read(uint32_t offset, uint32_t length, uint8_t *buffer);
+static cy_rslt_t ram_program(uint32_t offset, uint32_t length, const uint8_t *buffer);
+static cy_rslt_t ram_erase(uint32_t offset, uint32_t length);
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static uint8_t memory[RAM_FLASH_MAX_SIZE];
+static conn_journal_flash_t flash;
+static ram_flash_stats_t stats;
+static uint32_t tear_length = TEAR_NONE;
+static uint32_t failing_programs;
+static uint32_t failing_program_length;
+static bool is_erase_failing;
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: ram_flash_init
+ *******************************************************************************
+ * Summary: Erases the whole stand-in and returns its access functions with the
+ * given geometry.
+ *
+ * Parameters:
+ *  uint32_t sector_size: Size of an erase sector in bytes.
+ *  uint32_t sector_count: Number of sectors.
+ *
+ * Return:
+ *  const conn_journal_flash_t*: Access functions, or NULL if the geometry
+ *  does not fit.
+ *
+ ******************************************************************************/
+const conn_journal_flash_t *ram_flash_init(uint32_t sector_size, uint32_t sector_count)
+{
+    if (((sector_size * sector_count) > RAM_FLASH_MAX_SIZE) || (sector_count > RAM_FLASH_MAX_SECTORS))
+    {
+        return NULL;
+    }
+
+    memset(memory, 0xFF, sizeof(memory));
+    memset(&stats, 0, sizeof(stats));
+    tear_length = TEAR_NONE;
+    failing_programs = 0;
+    is_erase_failing = false;
+
+    flash.read = ram_read;
+    flash.program = ram_program;
+    flash.erase = ram_erase;
+    flash.sector_size = sector_size;
+    flash.sector_count = sector_count;
+
+    return &flash;
+}
+
+
+/*******************************************************************************
+ * Function Name: ram_flash_tear_next_program
+ *******************************************************************************
+ * Summary: Makes the next program store only its first bytes, as if the device
+ * was reset during the program. The program still reports success.
+ *
+ * Parameters:
+ *  uint32_t programmed_length: Number of bytes actually programmed.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void ram_flash_tear_next_program(uint32_t programmed_length)
+{
+    tear_length = programmed_length;
+}
+
+
+/*******************************************************************************
+ * Function Name: ram_flash_fail_next_programs
+ *******************************************************************************
+ * Summary: Makes the next programs store only their first bytes and report a
+ * failure, as a worn or write-protected page would.
+ *
+ * Parameters:
+ *  uint32_t count: Number of programs that fail.
+ *  uint32_t programmed_length: Number of bytes each of them programs.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void ram_flash_fail_next_programs(uint32_t count, uint32_t programmed_length)
+{
+    failing_programs = count;
+    failing_program_length = programmed_length;
+}
+
+
+/*******************************************************************************
+ * Function Name: ram_flash_fail_next_erase
+ *******************************************************************************
+ * Summary: Makes the next erase report a failure without erasing.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void ram_flash_fail_next_erase(void)
+{
+    is_erase_failing = true;
+}
+
+
+/*******************************************************************************
+ * Function Name: ram_flash_flip_bit
+ *******************************************************************************
+ * Summary: Inverts bits of a byte, as a retention error would.
+ *
+ * Parameters:
+ *  uint32_t offset: Offset of the byte in the region.
+ *  uint8_t mask: Bits to be inverted.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void ram_flash_flip_bit(uint32_t offset, uint8_t mask)
+{
+    if (offset < RAM_FLASH_MAX_SIZE)
+    {
+        memory[offset] ^= mask;
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: ram_flash_get_stats
+ *******************************************************************************
+ * Summary: Returns the access counters since ram_flash_init.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  const ram_flash_stats_t*: Access counters.
+ *
+ ******************************************************************************/
+const ram_flash_stats_t *ram_flash_get_stats(void)
+{
+    return &stats;
+}
+
+
+static cy_rslt_t ram_read(uint32_t offset, uint32_t length, uint8_t *buffer)
+{
+    if ((offset + length) > (flash.sector_size * flash.sector_count))
+    {
+        return RAM_FLASH_RSLT_BAD_ADDRESS;
+    }
+
+    stats.reads++;
+    memcpy(buffer, &memory[offset], length);
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+static cy_rslt_t ram_program(uint32_t offset, uint32_t length, const uint8_t *buffer)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if ((offset + length) > (flash.sector_size * flash.sector_count))
+    {
+        return RAM_FLASH_RSLT_BAD_ADDRESS;
+    }
+
+    if (failing_programs > 0u)
+    {
+        failing_programs--;
+        result = RAM_FLASH_RSLT_INJECTED_FAULT;
+        if (failing_program_length < length)
+        {
+            length = failing_program_length;
+        }
+    }
+
+    if (tear_length < length)
+    {
+        length = tear_length;
+    }
+    tear_length = TEAR_NONE;
+
+    stats.programs++;
+    for (uint32_t index = 0; index < length; index++)
+    {
+        memory[offset + index] &= buffer[index];
+    }
+
+    return result;
+}
+
+
+static cy_rslt_t ram_erase(uint32_t offset, uint32_t length)
+{
+    if (((offset % flash.sector_size) != 0u) || ((length % flash.sector_size) != 0u) ||
+        ((offset + length) > (flash.sector_size * flash.sector_count)))
+    {
+        return RAM_FLASH_RSLT_BAD_ADDRESS;
+    }
+
+    if (is_erase_failing)
+    {
+        is_erase_failing = false;
+        return RAM_FLASH_RSLT_INJECTED_FAULT;
+    }
+
+    stats.erases++;
+    for (uint32_t sector = offset / flash.sector_size; sector < ((offset + length) / flash.sector_size); sector++)
+    {
+        stats.sector_erases[sector]++;
+    }
+    memset(&memory[offset], 0xFF, length);
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/* [] END OF FILE */
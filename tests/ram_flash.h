@@ -0,0 +1,89 @@
+/*******************************************************************************
+* File Name: ram_flash.h
+*
+* Description: This file includes the function prototypes of the RAM-backed
+* stand-in for the serial NOR flash used in ram_flash.c
+*
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ *  Include guard
+ ******************************************************************************/
+#ifndef TESTS_RAM_FLASH_H_
+#define TESTS_RAM_FLASH_H_
+
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include "conn_journal.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Largest region the stand-in can hold. */
+#define RAM_FLASH_MAX_SIZE                  (4096u)
+#define RAM_FLASH_MAX_SECTORS               (16u)
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef struct
+{
+    uint32_t reads;
+    uint32_t programs;
+    uint32_t erases;
+    uint32_t sector_erases[RAM_FLASH_MAX_SECTORS];
+} ram_flash_stats_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+const conn_journal_flash_t *ram_flash_init(uint32_t sector_size, uint32_t sector_count);
+void ram_flash_tear_next_program(uint32_t programmed_length);
+void ram_flash_fail_next_programs(uint32_t count, uint32_t programmed_length);
+void ram_flash_fail_next_erase(void);
+void ram_flash_flip_bit(uint32_t offset, uint8_t mask);
+const ram_flash_stats_t *ram_flash_get_stats(void);
+
+#endif /*TESTS_RAM_FLASH_H_*/
+
+
+/* [] END OF FILE */
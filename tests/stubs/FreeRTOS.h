@@ -0,0 +1,89 @@
+/*******************************************************************************
+* File Name: FreeRTOS.h
+*
+* Description: Host stand-in for the FreeRTOS kernel types and port macros,
+* providing only the definitions used by the modules built by the unit tests.
+* The services are implemented over POSIX threads in freertos_host.c. The
+* tick period is one millisecond.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef TESTS_STUBS_FREERTOS_H_
+#define TESTS_STUBS_FREERTOS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint32_t TickType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+
+#define pdFALSE                             ((BaseType_t)0)
+#define pdTRUE                              ((BaseType_t)1)
+#define pdFAIL                              (pdFALSE)
+#define pdPASS                              (pdTRUE)
+
+#define portMAX_DELAY                       ((TickType_t)0xFFFFFFFFu)
+#define portTICK_PERIOD_MS                  ((TickType_t)1u)
+#define pdMS_TO_TICKS(ms)                   ((TickType_t)(ms))
+#define portBYTE_ALIGNMENT                  (8u)
+
+/* Heap settings of FreeRTOSConfig.h. The heap is pool_allocator.c; the tests
+ * that link it define vApplicationMallocFailedHook().
+ */
+#define NO_HEAP_ALLOCATION                  (0)
+#define configHEAP_ALLOCATION_SCHEME        (NO_HEAP_ALLOCATION)
+#define configUSE_MALLOC_FAILED_HOOK        (1)
+
+#define traceMALLOC(address, size)
+#define traceFREE(address, size)
+
+void *pvPortMalloc(size_t wanted_size);
+void vPortFree(void *pv);
+
+/* The critical sections are a single process-wide recursive lock, which gives
+ * the same mutual exclusion as disabling interrupts on a single core.
+ */
+void host_enter_critical(void);
+void host_exit_critical(void);
+
+#define taskENTER_CRITICAL()                host_enter_critical()
+#define taskEXIT_CRITICAL()                 host_exit_critical()
+
+#endif /*TESTS_STUBS_FREERTOS_H_*/
+
+
+/* [] END OF FILE */
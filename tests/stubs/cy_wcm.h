@@ -0,0 +1,110 @@
+/*******************************************************************************
+* File Name: cy_wcm.h
+*
+* Description: Host stand-in for the Wi-Fi Connection Manager, providing only
+* the types used by the modules built by the unit tests.
+*
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef TESTS_STUBS_CY_WCM_H_
+#define TESTS_STUBS_CY_WCM_H_
+
+#include <stdint.h>
+#include "cy_result.h"
+
+#define CY_WCM_MAX_SSID_LEN                 (32u)
+#define CY_WCM_MAC_ADDR_LEN                 (6u)
+#define CY_WCM_MAX_PASSPHRASE_LEN           (64u)
+
+typedef uint8_t cy_wcm_ssid_t[CY_WCM_MAX_SSID_LEN + 1u];
+typedef uint8_t cy_wcm_mac_t[CY_WCM_MAC_ADDR_LEN];
+typedef uint8_t cy_wcm_passphrase_t[CY_WCM_MAX_PASSPHRASE_LEN + 1u];
+
+typedef enum
+{
+    CY_WCM_SECURITY_OPEN = 0,
+    CY_WCM_SECURITY_WPA2_AES_PSK = 0x00400004
+} cy_wcm_security_t;
+
+typedef enum
+{
+    CY_WCM_WIFI_BAND_ANY = 0,
+    CY_WCM_WIFI_BAND_5GHZ,
+    CY_WCM_WIFI_BAND_2_4GHZ
+} cy_wcm_wifi_band_t;
+
+typedef enum
+{
+    CY_WCM_WPS_PBC_MODE = 0,
+    CY_WCM_WPS_PIN_MODE
+} cy_wcm_wps_mode_t;
+
+typedef struct
+{
+    cy_wcm_ssid_t       SSID;
+    cy_wcm_passphrase_t password;
+    cy_wcm_security_t   security;
+} cy_wcm_ap_credentials_t;
+
+typedef struct
+{
+    uint32_t version;
+    union
+    {
+        uint32_t v4;
+        uint32_t v6[4];
+    } ip;
+} cy_wcm_ip_address_t;
+
+typedef struct
+{
+    cy_wcm_ip_address_t ip_address;
+    cy_wcm_ip_address_t gateway;
+    cy_wcm_ip_address_t netmask;
+} cy_wcm_ip_setting_t;
+
+typedef struct
+{
+    cy_wcm_ap_credentials_t ap_credentials;
+    cy_wcm_mac_t            BSSID;
+    cy_wcm_wifi_band_t      band;
+} cy_wcm_connect_params_t;
+
+#endif /*TESTS_STUBS_CY_WCM_H_*/
+
+
+/* [] END OF FILE */
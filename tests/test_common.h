@@ -0,0 +1,102 @@
+/*******************************************************************************
+* File Name: test_common.h
+*
+* Description: This file contains the check macros shared by the host unit
+* tests. A failed check prints its location and marks the test as failed; the
+* test program returns the number of failed checks.
+*
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ *  Include guard
+ ******************************************************************************/
+#ifndef TESTS_TEST_COMMON_H_
+#define TESTS_TEST_COMMON_H_
+
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define TEST_CHECK(condition) \
+    do \
+    { \
+        if (!(condition)) \
+        { \
+            printf("  FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+            test_failures++; \
+        } \
+    } while (0)
+
+#define TEST_CHECK_EQUAL(expected, actual) \
+    do \
+    { \
+        unsigned long expected_value = (unsigned long)(expected); \
+        unsigned long actual_value = (unsigned long)(actual); \
+        if (expected_value != actual_value) \
+        { \
+            printf("  FAILED %s:%d: %s == %s (expected %lu, got %lu)\n", __FILE__, __LINE__, \
+                   #expected, #actual, expected_value, actual_value); \
+            test_failures++; \
+        } \
+    } while (0)
+
+#define TEST_RUN(test) \
+    do \
+    { \
+        uint32_t failures_before = test_failures; \
+        test(); \
+        printf("  %s %s\n", (failures_before == test_failures) ? "PASS" : "FAIL", #test); \
+    } while (0)
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/* Defined once in each test program. */
+extern uint32_t test_failures;
+
+#endif /*TESTS_TEST_COMMON_H_*/
+
+
+/* [] END OF FILE */
@@ -0,0 +1,507 @@
+/*******************************************************************************
+* File Name: test_conn_journal.c
+*
+* Description: Host unit tests of the connection journal (conn_journal.c) on
+* the RAM-backed flash stand-in: mounting, wrapping over the sectors, records
+* corrupted by a torn program or a bit error, and the queue of the writer.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <pthread.h>
+
+#include "conn_journal.h"
+#include "ram_flash.h"
+#include "test_common.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Small geometry so that the journal wraps quickly: 4 records per sector. */
+#define TEST_SECTOR_SIZE                    (4u * CONN_JOURNAL_RECORD_SIZE)
+#define TEST_SECTOR_COUNT                   (3u)
+#define TEST_TOTAL_SLOTS                    ((TEST_SECTOR_SIZE / CONN_JOURNAL_RECORD_SIZE) * TEST_SECTOR_COUNT)
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static uint32_t host_get_time_ms(void);
+static void host_lock(void);
+static void host_unlock(void);
+static void host_enter_critical(void);
+static void host_exit_critical(void);
+static void host_notify_writer(void);
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+uint32_t test_failures = 0;
+
+static pthread_mutex_t flash_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t queue_mutex = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t host_time_ms;
+static uint32_t writer_notifications;
+
+static const conn_journal_port_t host_port =
+{
+    .get_time_ms = host_get_time_ms,
+    .lock = host_lock,
+    .unlock = host_unlock,
+    .enter_critical = host_enter_critical,
+    .exit_critical = host_exit_critical,
+    .notify_writer = host_notify_writer
+};
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+static uint32_t host_get_time_ms(void)
+{
+    return host_time_ms;
+}
+
+
+static void host_lock(void)
+{
+    pthread_mutex_lock(&flash_mutex);
+}
+
+
+static void host_unlock(void)
+{
+    pthread_mutex_unlock(&flash_mutex);
+}
+
+
+static void host_enter_critical(void)
+{
+    pthread_mutex_lock(&queue_mutex);
+}
+
+
+static void host_exit_critical(void)
+{
+    pthread_mutex_unlock(&queue_mutex);
+}
+
+
+static void host_notify_writer(void)
+{
+    writer_notifications++;
+}
+
+
+/* Mounts a fresh journal on an erased stand-in. */
+static const conn_journal_flash_t *mount_erased(void)
+{
+    const conn_journal_flash_t *flash = ram_flash_init(TEST_SECTOR_SIZE, TEST_SECTOR_COUNT);
+
+    host_time_ms = 0;
+    writer_notifications = 0;
+    TEST_CHECK(NULL != flash);
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_init(flash, &host_port));
+
+    return flash;
+}
+
+
+/* Appends and programs the given number of records. The value of each record
+ * is the index given to it by the caller, starting at first_value.
+ */
+static void append_records(uint32_t count, uint32_t first_value)
+{
+    for (uint32_t index = 0; index < count; index++)
+    {
+        host_time_ms += 10u;
+        TEST_CHECK_EQUAL(CY_RSLT_SUCCESS,
+                         conn_journal_append(CONN_JOURNAL_EVENT_CONNECTED, (uint8_t)index, first_value + index));
+        TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_flush());
+    }
+}
+
+
+static void test_mount_rejects_bad_geometry(void)
+{
+    const conn_journal_flash_t *flash = ram_flash_init(TEST_SECTOR_SIZE, 1u);
+
+    TEST_CHECK_EQUAL(CONN_JOURNAL_RSLT_BAD_GEOMETRY, conn_journal_init(flash, &host_port));
+    TEST_CHECK_EQUAL(CONN_JOURNAL_RSLT_BAD_GEOMETRY, conn_journal_init(NULL, &host_port));
+
+    flash = ram_flash_init(TEST_SECTOR_SIZE + 1u, 2u);
+    TEST_CHECK_EQUAL(CONN_JOURNAL_RSLT_BAD_GEOMETRY, conn_journal_init(flash, &host_port));
+}
+
+
+static void test_mount_empty(void)
+{
+    conn_journal_record_t records[4];
+
+    mount_erased();
+
+    TEST_CHECK_EQUAL(0u, conn_journal_read_latest(records, 4u));
+}
+
+
+static void test_append_is_deferred(void)
+{
+    conn_journal_record_t records[4];
+    uint32_t programs;
+
+    mount_erased();
+    programs = ram_flash_get_stats()->programs;
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_append(CONN_JOURNAL_EVENT_BOOT, 0u, 7u));
+
+    /* Nothing is programmed or erased until the writer flushes. */
+    TEST_CHECK_EQUAL(programs, ram_flash_get_stats()->programs);
+    TEST_CHECK_EQUAL(0u, ram_flash_get_stats()->erases);
+    TEST_CHECK_EQUAL(1u, writer_notifications);
+    TEST_CHECK_EQUAL(0u, conn_journal_read_latest(records, 4u));
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_flush());
+    TEST_CHECK_EQUAL(1u, conn_journal_read_latest(records, 4u));
+    TEST_CHECK_EQUAL(CONN_JOURNAL_EVENT_BOOT, records[0].event);
+    TEST_CHECK_EQUAL(7u, records[0].value);
+    TEST_CHECK_EQUAL(1u, records[0].sequence);
+}
+
+
+static void test_remount_keeps_order(void)
+{
+    const conn_journal_flash_t *flash = mount_erased();
+    conn_journal_record_t records[8];
+    uint32_t count;
+
+    append_records(5u, 100u);
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_init(flash, &host_port));
+    count = conn_journal_read_latest(records, 8u);
+    TEST_CHECK_EQUAL(5u, count);
+    for (uint32_t index = 0; index < count; index++)
+    {
+        TEST_CHECK_EQUAL(5u - index, records[index].sequence);
+        TEST_CHECK_EQUAL(104u - index, records[index].value);
+        TEST_CHECK_EQUAL(50u - (10u * index), records[index].timestamp_ms);
+    }
+
+    /* The sequence continues after the remount. */
+    append_records(1u, 200u);
+    TEST_CHECK_EQUAL(1u, conn_journal_read_latest(records, 1u));
+    TEST_CHECK_EQUAL(6u, records[0].sequence);
+}
+
+
+static void test_wrap_drops_oldest_sector(void)
+{
+    const conn_journal_flash_t *flash = mount_erased();
+    conn_journal_record_t records[TEST_TOTAL_SLOTS];
+    const uint32_t appended = (5u * TEST_TOTAL_SLOTS) + 2u;
+    const uint32_t slots_per_sector = TEST_SECTOR_SIZE / CONN_JOURNAL_RECORD_SIZE;
+    uint32_t count;
+
+    append_records(appended, 1u);
+
+    for (uint32_t pass = 0; pass < 2u; pass++)
+    {
+        count = conn_journal_read_latest(records, TEST_TOTAL_SLOTS);
+
+        /* The sector being written was erased when it was entered, so between
+         * one and two full sectors of older records are kept with it.
+         */
+        TEST_CHECK(count > (TEST_TOTAL_SLOTS - slots_per_sector));
+        TEST_CHECK(count <= TEST_TOTAL_SLOTS);
+        for (uint32_t index = 0; index < count; index++)
+        {
+            TEST_CHECK_EQUAL(appended - index, records[index].sequence);
+            TEST_CHECK_EQUAL(appended - index, records[index].value);
+        }
+
+        /* Mounting after the wrap finds the same head. */
+        TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_init(flash, &host_port));
+    }
+
+    /* The erases are spread evenly over the sectors. */
+    for (uint32_t sector = 1; sector < TEST_SECTOR_COUNT; sector++)
+    {
+        uint32_t difference = (ram_flash_get_stats()->sector_erases[0] > ram_flash_get_stats()->sector_erases[sector]) ?
+                              (ram_flash_get_stats()->sector_erases[0] - ram_flash_get_stats()->sector_erases[sector]) :
+                              (ram_flash_get_stats()->sector_erases[sector] - ram_flash_get_stats()->sector_erases[0]);
+        TEST_CHECK(difference <= 1u);
+    }
+
+    append_records(1u, 0u);
+    TEST_CHECK_EQUAL(1u, conn_journal_read_latest(records, 1u));
+    TEST_CHECK_EQUAL(appended + 1u, records[0].sequence);
+}
+
+
+static void test_torn_record_is_skipped(void)
+{
+    const conn_journal_flash_t *flash = mount_erased();
+    conn_journal_record_t records[8];
+
+    append_records(2u, 1u);
+
+    /* Reset in the middle of programming the third record. */
+    ram_flash_tear_next_program(CONN_JOURNAL_RECORD_SIZE / 2u);
+    append_records(1u, 3u);
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_init(flash, &host_port));
+    TEST_CHECK_EQUAL(2u, conn_journal_read_latest(records, 8u));
+    TEST_CHECK_EQUAL(2u, records[0].sequence);
+
+    /* The torn slot is not reused and the sequence continues from the last
+     * valid record.
+     */
+    append_records(1u, 4u);
+    TEST_CHECK_EQUAL(3u, conn_journal_read_latest(records, 8u));
+    TEST_CHECK_EQUAL(3u, records[0].sequence);
+    TEST_CHECK_EQUAL(4u, records[0].value);
+    TEST_CHECK_EQUAL(2u, records[1].sequence);
+    TEST_CHECK_EQUAL(1u, records[2].sequence);
+}
+
+
+static void test_corrupted_record_is_skipped(void)
+{
+    const conn_journal_flash_t *flash = mount_erased();
+    conn_journal_record_t records[8];
+
+    append_records(3u, 1u);
+
+    /* Bit error in the value of the second record. */
+    ram_flash_flip_bit((1u * CONN_JOURNAL_RECORD_SIZE) + 8u, 0x01u);
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_init(flash, &host_port));
+    TEST_CHECK_EQUAL(2u, conn_journal_read_latest(records, 8u));
+    TEST_CHECK_EQUAL(3u, records[0].sequence);
+    TEST_CHECK_EQUAL(1u, records[1].sequence);
+}
+
+
+static void test_corrupted_sector_head(void)
+{
+    const conn_journal_flash_t *flash = mount_erased();
+    const uint32_t slots_per_sector = TEST_SECTOR_SIZE / CONN_JOURNAL_RECORD_SIZE;
+    conn_journal_record_t records[TEST_TOTAL_SLOTS];
+
+    /* Fill the first sector and start the second one. */
+    append_records(slots_per_sector + 2u, 1u);
+
+    /* Bit error in the sequence of the first record of the head sector. */
+    ram_flash_flip_bit(slots_per_sector * CONN_JOURNAL_RECORD_SIZE, 0x01u);
+
+    /* The mount falls back to the first sector; the records of the second
+     * sector are no longer reachable, but the journal stays consistent and
+     * new records are newest.
+     */
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_init(flash, &host_port));
+    append_records(1u, 100u);
+    TEST_CHECK(conn_journal_read_latest(records, TEST_TOTAL_SLOTS) >= 1u);
+    TEST_CHECK_EQUAL(100u, records[0].value);
+}
+
+
+static void test_queue_full_drops_records(void)
+{
+    conn_journal_record_t records[CONN_JOURNAL_PENDING_COUNT + 4u];
+
+    mount_erased();
+
+    for (uint32_t index = 0; index < CONN_JOURNAL_PENDING_COUNT; index++)
+    {
+        TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_append(CONN_JOURNAL_EVENT_DISCONNECTED, 0u, index));
+    }
+    TEST_CHECK_EQUAL(CONN_JOURNAL_RSLT_QUEUE_FULL, conn_journal_append(CONN_JOURNAL_EVENT_DISCONNECTED, 0u, 99u));
+    TEST_CHECK_EQUAL(1u, conn_journal_get_dropped_count());
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_flush());
+    TEST_CHECK_EQUAL(TEST_TOTAL_SLOTS, conn_journal_read_latest(records, CONN_JOURNAL_PENDING_COUNT + 4u));
+
+    /* The records are programmed in the order they were appended. */
+    TEST_CHECK_EQUAL(CONN_JOURNAL_PENDING_COUNT - 1u, records[0].value);
+}
+
+
+/* A reset discards the queued records, so the warm reset path flushes the
+ * record before resetting. The reset is simulated by mounting again.
+ */
+static void test_flushed_record_survives_reset(void)
+{
+    const conn_journal_flash_t *flash = mount_erased();
+    conn_journal_record_t records[4];
+
+    append_records(2u, 1u);
+
+    /* Queued only: lost by the reset. */
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_append(CONN_JOURNAL_EVENT_WARM_RESET, 1u, 0x1234u));
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_init(flash, &host_port));
+    TEST_CHECK_EQUAL(2u, conn_journal_read_latest(records, 4u));
+    TEST_CHECK_EQUAL(CONN_JOURNAL_EVENT_CONNECTED, records[0].event);
+
+    /* Queued and flushed, as fault_recovery_warm_reset does. */
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_append(CONN_JOURNAL_EVENT_WARM_RESET, 2u, 0x5678u));
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_flush());
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_init(flash, &host_port));
+    TEST_CHECK_EQUAL(3u, conn_journal_read_latest(records, 4u));
+    TEST_CHECK_EQUAL(CONN_JOURNAL_EVENT_WARM_RESET, records[0].event);
+    TEST_CHECK_EQUAL(2u, records[0].detail);
+    TEST_CHECK_EQUAL(0x5678u, records[0].value);
+    TEST_CHECK_EQUAL(3u, records[0].sequence);
+}
+
+
+/* Appends one record whose program or erase is expected to fail. */
+static void append_failing_record(uint32_t value)
+{
+    host_time_ms += 10u;
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_append(CONN_JOURNAL_EVENT_CONNECTED, 0u, value));
+    TEST_CHECK(CY_RSLT_SUCCESS != conn_journal_flush());
+}
+
+
+static void test_failed_program_reuses_erased_slot(void)
+{
+    const conn_journal_flash_t *flash = mount_erased();
+    conn_journal_record_t records[8];
+
+    append_records(1u, 1u);
+
+    /* Neither the record nor the bad slot marking is programmed, so the slot
+     * is still erased and takes the next record without leaving a hole.
+     */
+    ram_flash_fail_next_programs(2u, 0u);
+    append_failing_record(2u);
+    append_records(2u, 3u);
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_init(flash, &host_port));
+    TEST_CHECK_EQUAL(3u, conn_journal_read_latest(records, 8u));
+    TEST_CHECK_EQUAL(4u, records[0].value);
+    TEST_CHECK_EQUAL(3u, records[0].sequence);
+    TEST_CHECK_EQUAL(3u, records[1].value);
+    TEST_CHECK_EQUAL(1u, records[2].value);
+
+    /* The mount found the end of the programmed slots. */
+    append_records(1u, 5u);
+    TEST_CHECK_EQUAL(4u, conn_journal_read_latest(records, 8u));
+    TEST_CHECK_EQUAL(4u, records[0].sequence);
+}
+
+
+static void test_failed_program_marks_slot_bad(void)
+{
+    const conn_journal_flash_t *flash = mount_erased();
+    conn_journal_record_t records[8];
+
+    append_records(1u, 1u);
+
+    /* Half of the record is programmed; the slot cannot be reused. */
+    ram_flash_fail_next_programs(1u, CONN_JOURNAL_RECORD_SIZE / 2u);
+    append_failing_record(2u);
+    append_records(2u, 3u);
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_init(flash, &host_port));
+    TEST_CHECK_EQUAL(3u, conn_journal_read_latest(records, 8u));
+    TEST_CHECK_EQUAL(4u, records[0].value);
+    TEST_CHECK_EQUAL(3u, records[0].sequence);
+    TEST_CHECK_EQUAL(3u, records[1].value);
+    TEST_CHECK_EQUAL(1u, records[2].value);
+
+    append_records(1u, 5u);
+    TEST_CHECK_EQUAL(1u, conn_journal_read_latest(records, 1u));
+    TEST_CHECK_EQUAL(5u, records[0].value);
+    TEST_CHECK_EQUAL(4u, records[0].sequence);
+}
+
+
+static void test_failed_erase_is_retried(void)
+{
+    const conn_journal_flash_t *flash = mount_erased();
+    const uint32_t slots_per_sector = TEST_SECTOR_SIZE / CONN_JOURNAL_RECORD_SIZE;
+    conn_journal_record_t records[TEST_TOTAL_SLOTS];
+    uint32_t count;
+
+    /* Fill the region so that the next record erases the oldest sector. */
+    append_records(TEST_TOTAL_SLOTS, 1u);
+
+    ram_flash_fail_next_erase();
+    append_failing_record(100u);
+    TEST_CHECK_EQUAL(1u, ram_flash_get_stats()->sector_erases[0]);
+
+    /* The next record erases the sector again and starts it. */
+    append_records(2u, TEST_TOTAL_SLOTS + 1u);
+    TEST_CHECK_EQUAL(2u, ram_flash_get_stats()->sector_erases[0]);
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, conn_journal_init(flash, &host_port));
+    count = conn_journal_read_latest(records, TEST_TOTAL_SLOTS);
+    TEST_CHECK_EQUAL(2u + (TEST_TOTAL_SLOTS - slots_per_sector), count);
+    for (uint32_t index = 0; index < count; index++)
+    {
+        TEST_CHECK_EQUAL(TEST_TOTAL_SLOTS + 2u - index, records[index].sequence);
+        TEST_CHECK_EQUAL(TEST_TOTAL_SLOTS + 2u - index, records[index].value);
+    }
+}
+
+
+int main(void)
+{
+    printf("Connection journal\n");
+
+    TEST_RUN(test_mount_rejects_bad_geometry);
+    TEST_RUN(test_mount_empty);
+    TEST_RUN(test_append_is_deferred);
+    TEST_RUN(test_remount_keeps_order);
+    TEST_RUN(test_wrap_drops_oldest_sector);
+    TEST_RUN(test_torn_record_is_skipped);
+    TEST_RUN(test_corrupted_record_is_skipped);
+    TEST_RUN(test_corrupted_sector_head);
+    TEST_RUN(test_queue_full_drops_records);
+    TEST_RUN(test_flushed_record_survives_reset);
+    TEST_RUN(test_failed_program_reuses_erased_slot);
+    TEST_RUN(test_failed_program_marks_slot_bad);
+    TEST_RUN(test_failed_erase_is_retried);
+
+    return (0u == test_failures) ? 0 : 1;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,349 @@
+/*******************************************************************************
+* File Name: test_connection_resume.c
+*
+* Description: Unit tests of the lease reuse decision of
+* connection_context_lease.c, and a host simulation of the time from a reset
+* to the connection. A device is reset at pseudo-random intervals on a
+* simulated clock and resumes as resume_connection() in wps_enrollee_task.c
+* does: a directed join with the PMK once the PMK task has derived it, and the
+* retained lease when the real decision allows it, or DHCP otherwise. The
+* durations of the steps are model assumptions, not measurements; the
+* simulation shows how often the lease is reused for the lease times of the
+* network, and checks that a reused address is never used past the lease
+* granted by the server.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "connection_context.h"
+#include "test_common.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Modelled durations in milliseconds. */
+#define SIM_BOOT_MS                         (300u)      /* Reset to the start of the connection */
+#define SIM_FULL_SCAN_MS                    (2500u)     /* Scan of all the channels for the SSID */
+#define SIM_JOIN_MS                         (350u)      /* Probe, association, and 4-way handshake */
+#define SIM_PASSPHRASE_JOIN_MS              (1800u)     /* PMK derivation added by a join with the passphrase */
+#define SIM_DHCP_MS                         (1500u)     /* Discover, offer, request, and acknowledge */
+#define SIM_PMK_TASK_MS                     (2500u)     /* PMK task completion after the connection */
+
+/* Resets happen between these intervals after the connection. */
+#define SIM_MIN_UPTIME_MS                   (60u * 1000u)
+#define SIM_MAX_UPTIME_MS                   (3u * 3600u * 1000u)
+
+#define SIM_END_MS                          (7u * 24u * 3600u * 1000u)
+#define SIM_MAX_RESETS                      (SIM_END_MS / SIM_MIN_UPTIME_MS)
+
+/* The RTC counts whole seconds and the renewal timer starts after the join. */
+#define SIM_MAX_OVERSHOOT_MS                (1000u + SIM_BOOT_MS + SIM_JOIN_MS)
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef struct
+{
+    uint32_t renew_sec;     /* T1 granted by the DHCP server */
+    uint32_t lease_sec;     /* Lease time granted by the DHCP server */
+} sim_network_t;
+
+typedef struct
+{
+    uint32_t resets;
+    uint32_t lease_reuses;
+    uint32_t dhcp_resumes;
+    uint32_t renewals;
+    uint32_t passphrase_joins;
+    uint32_t cold_ms;               /* Power up to connected, without a context */
+    uint32_t median_ms;             /* Reset to connected */
+    uint32_t max_ms;
+    uint32_t max_overshoot_ms;      /* Use of a reused address past T1 */
+    uint32_t expired_uses;          /* Uses of a reused address past the lease */
+} sim_result_t;
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+uint32_t test_failures = 0;
+
+static uint32_t durations[SIM_MAX_RESETS];
+static uint32_t random_state;
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+static uint32_t next_random(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+
+    return random_state;
+}
+
+
+static int compare_durations(const void *first, const void *second)
+{
+    uint32_t a = *(const uint32_t *)first;
+    uint32_t b = *(const uint32_t *)second;
+
+    return (a > b) - (a < b);
+}
+
+
+static void test_reuse_until_renewal_time(void)
+{
+    TEST_CHECK_EQUAL(1800u, connection_context_lease_reuse_sec(1000u, 1000u, 1800u, 3600u));
+    TEST_CHECK_EQUAL(1u, connection_context_lease_reuse_sec(2799u, 1000u, 1800u, 3600u));
+    TEST_CHECK_EQUAL(0u, connection_context_lease_reuse_sec(2800u, 1000u, 1800u, 3600u));
+    TEST_CHECK_EQUAL(0u, connection_context_lease_reuse_sec(5000u, 1000u, 1800u, 3600u));
+}
+
+
+static void test_renewal_time_beyond_lease(void)
+{
+    /* A renewal time past the end of the lease is not trusted. */
+    TEST_CHECK_EQUAL(600u, connection_context_lease_reuse_sec(0u, 0u, 7200u, 600u));
+    TEST_CHECK_EQUAL(0u, connection_context_lease_reuse_sec(600u, 0u, 7200u, 600u));
+}
+
+
+static void test_infinite_lease_capped(void)
+{
+    TEST_CHECK_EQUAL(CONNECTION_CONTEXT_MAX_LEASE_REUSE_SEC,
+                     connection_context_lease_reuse_sec(100u, 100u, UINT32_MAX, UINT32_MAX));
+    TEST_CHECK_EQUAL(1u, connection_context_lease_reuse_sec(CONNECTION_CONTEXT_MAX_LEASE_REUSE_SEC + 99u, 100u,
+                                                            UINT32_MAX, UINT32_MAX));
+    TEST_CHECK_EQUAL(0u, connection_context_lease_reuse_sec(CONNECTION_CONTEXT_MAX_LEASE_REUSE_SEC + 100u, 100u,
+                                                            UINT32_MAX, UINT32_MAX));
+}
+
+
+static void test_rtc_behind_lease_not_reused(void)
+{
+    TEST_CHECK_EQUAL(0u, connection_context_lease_reuse_sec(999u, 1000u, 1800u, 3600u));
+    TEST_CHECK_EQUAL(0u, connection_context_lease_reuse_sec(1000u, 1000u, 0u, 3600u));
+}
+
+
+/* Runs a week of pseudo-random resets on the network. */
+static void run_simulation(const sim_network_t *network, sim_result_t *result)
+{
+    uint32_t obtained_ms;           /* When the server granted the retained lease */
+    uint32_t obtained_sec;          /* The same, as read from the RTC */
+    uint32_t pmk_ready_ms;
+    uint64_t renew_ms = 0;
+    uint32_t connected_ms;
+    uint32_t reset_ms;
+    uint32_t reuse_sec;
+    uint32_t join_ms;
+    bool is_reused = false;
+    bool has_pmk = false;
+
+    memset(result, 0, sizeof(sim_result_t));
+    random_state = 0x2545F491u;
+
+    /* Power up: full scan, join with the passphrase, and DHCP. */
+    connected_ms = SIM_BOOT_MS + SIM_FULL_SCAN_MS + SIM_JOIN_MS + SIM_PASSPHRASE_JOIN_MS + SIM_DHCP_MS;
+    result->cold_ms = connected_ms;
+    obtained_ms = connected_ms;
+    obtained_sec = obtained_ms / 1000u;
+    pmk_ready_ms = connected_ms + SIM_PMK_TASK_MS;
+
+    reset_ms = connected_ms + SIM_MIN_UPTIME_MS + (next_random() % (SIM_MAX_UPTIME_MS - SIM_MIN_UPTIME_MS));
+    while ((reset_ms < SIM_END_MS) && (result->resets < SIM_MAX_RESETS))
+    {
+        has_pmk = has_pmk || (pmk_ready_ms <= reset_ms);
+
+        if (is_reused)
+        {
+            uint64_t use_end_ms = (renew_ms < reset_ms) ? renew_ms : reset_ms;
+            uint64_t renew_due_ms = obtained_ms + ((uint64_t)network->renew_sec * 1000u);
+
+            if (use_end_ms > (obtained_ms + ((uint64_t)network->lease_sec * 1000u)))
+            {
+                result->expired_uses++;
+            }
+            if ((use_end_ms > renew_due_ms) && ((use_end_ms - renew_due_ms) > result->max_overshoot_ms))
+            {
+                result->max_overshoot_ms = (uint32_t)(use_end_ms - renew_due_ms);
+            }
+
+            /* The renewal timer runs DHCP; lwIP renews the lease after it. */
+            if ((renew_ms + SIM_DHCP_MS) <= reset_ms)
+            {
+                obtained_ms = (uint32_t)renew_ms + SIM_DHCP_MS;
+                obtained_sec = obtained_ms / 1000u;
+                is_reused = false;
+                result->renewals++;
+            }
+        }
+
+        /* Resume from the retained context. */
+        join_ms = SIM_JOIN_MS + (has_pmk ? 0u : SIM_PASSPHRASE_JOIN_MS);
+        reuse_sec = connection_context_lease_reuse_sec((reset_ms + SIM_BOOT_MS) / 1000u, obtained_sec,
+                                                       network->renew_sec, network->lease_sec);
+        if (0u != reuse_sec)
+        {
+            connected_ms = reset_ms + SIM_BOOT_MS + join_ms;
+            renew_ms = connected_ms + ((uint64_t)reuse_sec * 1000u);
+            is_reused = true;
+            result->lease_reuses++;
+        }
+        else
+        {
+            connected_ms = reset_ms + SIM_BOOT_MS + join_ms + SIM_DHCP_MS;
+            obtained_ms = connected_ms;
+            obtained_sec = obtained_ms / 1000u;
+            is_reused = false;
+            result->dhcp_resumes++;
+        }
+
+        if (!has_pmk)
+        {
+            pmk_ready_ms = connected_ms + SIM_PMK_TASK_MS;
+            result->passphrase_joins++;
+        }
+
+        durations[result->resets++] = connected_ms - reset_ms;
+        reset_ms = connected_ms + SIM_MIN_UPTIME_MS + (next_random() % (SIM_MAX_UPTIME_MS - SIM_MIN_UPTIME_MS));
+    }
+
+    qsort(durations, result->resets, sizeof(durations[0]), compare_durations);
+    result->median_ms = durations[result->resets / 2u];
+    result->max_ms = durations[result->resets - 1u];
+}
+
+
+static void print_result(const char *name, const sim_network_t *network, const sim_result_t *result)
+{
+    printf("    %-12s T1 %6lu s, lease %6lu s: %4lu resets, %4lu with the lease, %4lu with DHCP, "
+           "%4lu renewals; power up %5lu ms, reset to connected median %5lu ms, max %5lu ms\n",
+           name, (unsigned long)network->renew_sec, (unsigned long)network->lease_sec,
+           (unsigned long)result->resets, (unsigned long)result->lease_reuses,
+           (unsigned long)result->dhcp_resumes, (unsigned long)result->renewals,
+           (unsigned long)result->cold_ms, (unsigned long)result->median_ms, (unsigned long)result->max_ms);
+}
+
+
+static void check_invariants(const sim_result_t *result)
+{
+    TEST_CHECK(result->resets > 0u);
+    TEST_CHECK_EQUAL(result->resets, result->lease_reuses + result->dhcp_resumes);
+    TEST_CHECK_EQUAL(0u, result->expired_uses);
+    TEST_CHECK(result->max_overshoot_ms <= SIM_MAX_OVERSHOOT_MS);
+
+    /* Only the first reset can come before the PMK task completes. */
+    TEST_CHECK(result->passphrase_joins <= 1u);
+    TEST_CHECK(result->max_ms < result->cold_ms);
+}
+
+
+static void test_day_lease(void)
+{
+    sim_network_t network = { 12u * 3600u, 24u * 3600u };
+    sim_result_t result;
+
+    run_simulation(&network, &result);
+    print_result("day lease", &network, &result);
+    check_invariants(&result);
+
+    /* Most resets come before T1 and connect without DHCP. */
+    TEST_CHECK(result.lease_reuses > (2u * result.dhcp_resumes));
+    TEST_CHECK_EQUAL(SIM_BOOT_MS + SIM_JOIN_MS, result.median_ms);
+}
+
+
+static void test_hour_lease(void)
+{
+    sim_network_t network = { 1800u, 3600u };
+    sim_result_t result;
+
+    run_simulation(&network, &result);
+    print_result("hour lease", &network, &result);
+    check_invariants(&result);
+
+    /* The uptime is mostly longer than T1, so most resumes run DHCP. */
+    TEST_CHECK(result.dhcp_resumes > result.lease_reuses);
+    TEST_CHECK(result.lease_reuses > 0u);
+    TEST_CHECK_EQUAL(SIM_BOOT_MS + SIM_JOIN_MS + SIM_DHCP_MS, result.median_ms);
+}
+
+
+static void test_infinite_lease(void)
+{
+    sim_network_t network = { UINT32_MAX, UINT32_MAX };
+    sim_result_t result;
+
+    run_simulation(&network, &result);
+    print_result("infinite", &network, &result);
+    check_invariants(&result);
+
+    /* The server is still contacted once per CONNECTION_CONTEXT_MAX_LEASE_REUSE_SEC. */
+    TEST_CHECK((result.dhcp_resumes + result.renewals) >=
+               (((SIM_END_MS / 1000u) / CONNECTION_CONTEXT_MAX_LEASE_REUSE_SEC) - 1u));
+    TEST_CHECK(result.lease_reuses > (10u * result.dhcp_resumes));
+}
+
+
+int main(void)
+{
+    printf("Connection resume\n");
+
+    TEST_RUN(test_reuse_until_renewal_time);
+    TEST_RUN(test_renewal_time_beyond_lease);
+    TEST_RUN(test_infinite_lease_capped);
+    TEST_RUN(test_rtc_behind_lease_not_reused);
+    TEST_RUN(test_day_lease);
+    TEST_RUN(test_hour_lease);
+    TEST_RUN(test_infinite_lease);
+
+    return (0u == test_failures) ? 0 : 1;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,312 @@
+/*******************************************************************************
+* File Name: test_connection_state.c
+*
+* Description: Host unit tests of the connection state (connection_state.c)
+* over the POSIX thread stand-ins of FreeRTOS: consistency of the snapshots
+* taken while the state changes, ordering of the event group with concurrent
+* writers, and the wait for a state.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+
+#include "connection_state.h"
+#include "event_groups.h"
+#include "task.h"
+#include "test_common.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define TEST_WRITER_CHANGES                 (20000u)
+#define TEST_READER_COUNT                   (3u)
+#define TEST_RACING_WRITER_COUNT            (4u)
+#define TEST_RACING_WRITER_CHANGES          (50000u)
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef struct
+{
+    uint32_t snapshots;
+    uint32_t torn_snapshots;
+    uint32_t generation_regressions;
+} reader_result_t;
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+uint32_t test_failures = 0;
+
+static volatile bool is_writer_done;
+static TickType_t tick_count;
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/* Tick source that advances by one on every call and gives up the CPU in the
+ * middle of the state update, so that the readers run while it is in progress.
+ * The timestamp of generation g is then g + 1.
+ */
+static TickType_t counting_tick_source(void)
+{
+    TickType_t tick = __atomic_add_fetch(&tick_count, 1u, __ATOMIC_SEQ_CST);
+
+    sched_yield();
+
+    return tick;
+}
+
+
+/* Cycles through the states in order, so the state of generation g is g modulo
+ * CONNECTION_STATE_COUNT.
+ */
+static void *cycling_writer(void *arg)
+{
+    for (uint32_t change = 1u; change <= TEST_WRITER_CHANGES; change++)
+    {
+        connection_state_set((connection_state_t)(change % CONNECTION_STATE_COUNT));
+    }
+
+    is_writer_done = true;
+
+    return NULL;
+}
+
+
+/* Takes snapshots until the writer is done and checks that the state,
+ * generation, and timestamp of each one were written together, and that the
+ * generation does not go back.
+ */
+static void *snapshot_reader(void *arg)
+{
+    reader_result_t *result = arg;
+    connection_state_snapshot_t snapshot;
+    connection_state_snapshot_t previous;
+
+    connection_state_get_snapshot(&previous);
+
+    while (!is_writer_done)
+    {
+        connection_state_get_snapshot(&snapshot);
+        result->snapshots++;
+
+        if (((uint32_t)snapshot.state != (snapshot.generation % CONNECTION_STATE_COUNT)) ||
+            (snapshot.timestamp != (snapshot.generation + 1u)))
+        {
+            result->torn_snapshots++;
+        }
+        if (snapshot.generation < previous.generation)
+        {
+            result->generation_regressions++;
+        }
+
+        previous = snapshot;
+
+        /* Lets the writer make progress on a single CPU. */
+        sched_yield();
+    }
+
+    return NULL;
+}
+
+
+/* Sets pseudo-random states from several threads at once. */
+static void *racing_writer(void *arg)
+{
+    uint32_t seed = (uint32_t)(uintptr_t)arg;
+
+    for (uint32_t change = 0; change < TEST_RACING_WRITER_CHANGES; change++)
+    {
+        seed = (seed * 1103515245u) + 12345u;
+        connection_state_set((connection_state_t)((seed >> 16) % CONNECTION_STATE_COUNT));
+    }
+
+    return NULL;
+}
+
+
+static void *connect_after_delay(void *arg)
+{
+    vTaskDelay(pdMS_TO_TICKS(50u));
+    connection_state_set(CONNECTION_STATE_CONNECTED);
+
+    return NULL;
+}
+
+
+/* Checks that the event group holds exactly the bit of the current state. */
+static void check_event_bits_match_state(void)
+{
+    connection_state_t state = connection_state_get();
+
+    for (uint32_t other = 0; other < CONNECTION_STATE_COUNT; other++)
+    {
+        cy_rslt_t expected = (other == (uint32_t)state) ? CY_RSLT_SUCCESS : CONNECTION_STATE_RSLT_TIMEOUT;
+
+        TEST_CHECK_EQUAL(expected, connection_state_wait_for_state((connection_state_t)other, 0u));
+    }
+}
+
+
+static void test_initial_state(void)
+{
+    connection_state_snapshot_t snapshot;
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, connection_state_init());
+    connection_state_get_snapshot(&snapshot);
+
+    TEST_CHECK_EQUAL(CONNECTION_STATE_DISCONNECTED, snapshot.state);
+    TEST_CHECK_EQUAL(0u, snapshot.generation);
+    TEST_CHECK(!connection_state_is_connected());
+    check_event_bits_match_state();
+}
+
+
+static void test_same_state_keeps_generation(void)
+{
+    connection_state_snapshot_t snapshot;
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, connection_state_init());
+    connection_state_set(CONNECTION_STATE_DISCONNECTED);
+    connection_state_set(CONNECTION_STATE_COUNT);
+    connection_state_get_snapshot(&snapshot);
+
+    TEST_CHECK_EQUAL(0u, snapshot.generation);
+}
+
+
+static void test_snapshots_during_changes(void)
+{
+    pthread_t writer;
+    pthread_t readers[TEST_READER_COUNT];
+    reader_result_t results[TEST_READER_COUNT] = { { 0 } };
+    connection_state_snapshot_t snapshot;
+
+    tick_count = 0;
+    host_set_tick_source(counting_tick_source);
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, connection_state_init());
+    is_writer_done = false;
+
+    for (uint32_t index = 0; index < TEST_READER_COUNT; index++)
+    {
+        pthread_create(&readers[index], NULL, snapshot_reader, &results[index]);
+    }
+    pthread_create(&writer, NULL, cycling_writer, NULL);
+
+    pthread_join(writer, NULL);
+    for (uint32_t index = 0; index < TEST_READER_COUNT; index++)
+    {
+        pthread_join(readers[index], NULL);
+        printf("    reader %lu: %lu snapshots\n", (unsigned long)index, (unsigned long)results[index].snapshots);
+        TEST_CHECK(0u != results[index].snapshots);
+        TEST_CHECK_EQUAL(0u, results[index].torn_snapshots);
+        TEST_CHECK_EQUAL(0u, results[index].generation_regressions);
+    }
+    host_set_tick_source(NULL);
+
+    connection_state_get_snapshot(&snapshot);
+    TEST_CHECK_EQUAL(TEST_WRITER_CHANGES, snapshot.generation);
+    TEST_CHECK_EQUAL(TEST_WRITER_CHANGES % CONNECTION_STATE_COUNT, snapshot.state);
+    check_event_bits_match_state();
+}
+
+
+static void test_concurrent_writers(void)
+{
+    pthread_t writers[TEST_RACING_WRITER_COUNT];
+    connection_state_snapshot_t snapshot;
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, connection_state_init());
+
+    for (uint32_t index = 0; index < TEST_RACING_WRITER_COUNT; index++)
+    {
+        pthread_create(&writers[index], NULL, racing_writer, (void *)(uintptr_t)(index + 1u));
+    }
+    for (uint32_t index = 0; index < TEST_RACING_WRITER_COUNT; index++)
+    {
+        pthread_join(writers[index], NULL);
+    }
+
+    /* Each writer changes the state at most once per call. */
+    connection_state_get_snapshot(&snapshot);
+    TEST_CHECK(0u != snapshot.generation);
+    TEST_CHECK(snapshot.generation <= (TEST_RACING_WRITER_COUNT * TEST_RACING_WRITER_CHANGES));
+    check_event_bits_match_state();
+}
+
+
+static void test_wait_for_state(void)
+{
+    pthread_t writer;
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, connection_state_init());
+    TEST_CHECK_EQUAL(CONNECTION_STATE_RSLT_TIMEOUT, connection_state_wait_for_state(CONNECTION_STATE_CONNECTED, 10u));
+
+    pthread_create(&writer, NULL, connect_after_delay, NULL);
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, connection_state_wait_for_state(CONNECTION_STATE_CONNECTED, 5000u));
+    pthread_join(writer, NULL);
+
+    TEST_CHECK(connection_state_is_connected());
+    TEST_CHECK_EQUAL(CONNECTION_STATE_RSLT_TIMEOUT, connection_state_wait_for_state(CONNECTION_STATE_COUNT, 0u));
+}
+
+
+int main(void)
+{
+    printf("Connection state\n");
+
+    TEST_RUN(test_initial_state);
+    TEST_RUN(test_same_state_keeps_generation);
+    TEST_RUN(test_snapshots_during_changes);
+    TEST_RUN(test_concurrent_writers);
+    TEST_RUN(test_wait_for_state);
+
+    return (0u == test_failures) ? 0 : 1;
+}
+
+
+/* [] END OF FILE */
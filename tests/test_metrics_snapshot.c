@@ -0,0 +1,353 @@
+/*******************************************************************************
+* File Name: test_metrics_snapshot.c
+*
+* Description: Unit tests of the snapshot encoding of metrics_snapshot.c. The
+* snapshots are read back by a small scraper that accepts only the documented
+* format: lines of a metric name, one space, a decimal value with an optional
+* minus sign, and a newline.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdbool.h>
+#include <string.h>
+
+#include "metrics_endpoint.h"
+#include "test_common.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define TEST_MAX_NAME_LENGTH                (31u)
+
+/* Bytes after the buffer that the encoding must not write. */
+#define TEST_GUARD_SIZE                     (16u)
+#define TEST_GUARD_BYTE                     ((char)0xA5)
+
+#define TEST_ALL_PRESENT                    ((1uL << METRICS_SNAPSHOT_METRIC_COUNT) - 1u)
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef struct
+{
+    char    name[TEST_MAX_NAME_LENGTH + 1u];
+    int64_t value;
+} scraped_metric_t;
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+uint32_t test_failures = 0;
+
+static const char *const expected_names[METRICS_SNAPSHOT_METRIC_COUNT] =
+{
+    "uptime_s", "connected", "connections", "connect_failures", "disconnects_link_loss",
+    "disconnects_requested", "link_restorations", "restore_mttr_ms", "rssi_dbm", "pool_free_bytes",
+    "c_heap_free_bytes", "provisioning_latency_ms", "wps_latency_ms", "connect_latency_ms"
+};
+
+static char buffer[METRICS_ENDPOINT_RESPONSE_SIZE + TEST_GUARD_SIZE];
+static scraped_metric_t scraped[METRICS_SNAPSHOT_METRIC_COUNT];
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+/* Parses a snapshot as a monitoring system would. Returns the number of
+ * metrics, or -1 if the text does not follow the format.
+ */
+static int32_t scrape(const char *text, uint32_t length, scraped_metric_t *metrics, uint32_t max_count)
+{
+    uint32_t position = 0;
+    int32_t count = 0;
+
+    while (position < length)
+    {
+        scraped_metric_t *metric = &metrics[count];
+        uint32_t name_length = 0;
+        uint32_t digit_count = 0;
+        bool is_negative = false;
+
+        if ((uint32_t)count == max_count)
+        {
+            return -1;
+        }
+
+        while ((position < length) &&
+               ((('a' <= text[position]) && (text[position] <= 'z')) ||
+                (('0' <= text[position]) && (text[position] <= '9')) || ('_' == text[position])))
+        {
+            if (name_length == TEST_MAX_NAME_LENGTH)
+            {
+                return -1;
+            }
+            metric->name[name_length++] = text[position++];
+        }
+        metric->name[name_length] = '\0';
+
+        if ((0u == name_length) || (position >= length) || (' ' != text[position++]))
+        {
+            return -1;
+        }
+
+        if ((position < length) && ('-' == text[position]))
+        {
+            is_negative = true;
+            position++;
+        }
+
+        metric->value = 0;
+        while ((position < length) && ('0' <= text[position]) && (text[position] <= '9'))
+        {
+            metric->value = (metric->value * 10) + (text[position++] - '0');
+            digit_count++;
+        }
+
+        if ((0u == digit_count) || (digit_count > 10u) || (position >= length) || ('\n' != text[position++]))
+        {
+            return -1;
+        }
+
+        if (is_negative)
+        {
+            metric->value = -metric->value;
+        }
+        count++;
+    }
+
+    return count;
+}
+
+
+static uint32_t encode(const metrics_snapshot_t *snapshot, uint32_t size)
+{
+    memset(buffer, TEST_GUARD_BYTE, sizeof(buffer));
+    return metrics_snapshot_encode(snapshot, buffer, size);
+}
+
+
+static bool is_guard_intact(uint32_t size)
+{
+    for (uint32_t index = size; index < sizeof(buffer); index++)
+    {
+        if (TEST_GUARD_BYTE != buffer[index])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+static void fill_snapshot(metrics_snapshot_t *snapshot, int32_t value)
+{
+    for (uint32_t metric = 0; metric < (uint32_t)METRICS_SNAPSHOT_METRIC_COUNT; metric++)
+    {
+        snapshot->values[metric] = value;
+    }
+    snapshot->present_mask = TEST_ALL_PRESENT;
+}
+
+
+static void test_format(void)
+{
+    metrics_snapshot_t snapshot;
+    uint32_t length;
+
+    for (uint32_t metric = 0; metric < (uint32_t)METRICS_SNAPSHOT_METRIC_COUNT; metric++)
+    {
+        snapshot.values[metric] = (int32_t)(metric * 1000u);
+    }
+    snapshot.present_mask = TEST_ALL_PRESENT;
+
+    length = encode(&snapshot, METRICS_ENDPOINT_RESPONSE_SIZE);
+    TEST_CHECK(is_guard_intact(length));
+    TEST_CHECK(0 == memcmp(buffer, "uptime_s 0\nconnected 1000\nconnections 2000\n",
+                           sizeof("uptime_s 0\nconnected 1000\nconnections 2000\n") - 1u));
+    TEST_CHECK_EQUAL(METRICS_SNAPSHOT_METRIC_COUNT,
+                     scrape(buffer, length, scraped, METRICS_SNAPSHOT_METRIC_COUNT));
+
+    for (uint32_t metric = 0; metric < (uint32_t)METRICS_SNAPSHOT_METRIC_COUNT; metric++)
+    {
+        TEST_CHECK(0 == strcmp(expected_names[metric], scraped[metric].name));
+        TEST_CHECK(((int64_t)metric * 1000) == scraped[metric].value);
+    }
+}
+
+
+static void test_negative_values(void)
+{
+    metrics_snapshot_t snapshot;
+    uint32_t length;
+
+    memset(&snapshot, 0, sizeof(snapshot));
+    snapshot.present_mask = (1uL << METRICS_SNAPSHOT_RSSI_DBM) | (1uL << METRICS_SNAPSHOT_POOL_FREE_BYTES) |
+                            (1uL << METRICS_SNAPSHOT_WPS_LATENCY_MS);
+    snapshot.values[METRICS_SNAPSHOT_RSSI_DBM] = -67;
+    snapshot.values[METRICS_SNAPSHOT_POOL_FREE_BYTES] = -1;
+    snapshot.values[METRICS_SNAPSHOT_WPS_LATENCY_MS] = INT32_MIN;
+
+    length = encode(&snapshot, METRICS_ENDPOINT_RESPONSE_SIZE);
+    TEST_CHECK_EQUAL(sizeof("rssi_dbm -67\npool_free_bytes -1\nwps_latency_ms -2147483648\n") - 1u, length);
+    TEST_CHECK(0 == memcmp(buffer, "rssi_dbm -67\npool_free_bytes -1\nwps_latency_ms -2147483648\n", length));
+    TEST_CHECK_EQUAL(3, scrape(buffer, length, scraped, METRICS_SNAPSHOT_METRIC_COUNT));
+    TEST_CHECK(-67 == scraped[0].value);
+    TEST_CHECK(-1 == scraped[1].value);
+    TEST_CHECK((int64_t)INT32_MIN == scraped[2].value);
+}
+
+
+static void test_absent_metrics_left_out(void)
+{
+    metrics_snapshot_t snapshot;
+    uint32_t length;
+
+    /* Disconnected: no RSSI line. */
+    fill_snapshot(&snapshot, 5);
+    snapshot.present_mask &= ~(1uL << METRICS_SNAPSHOT_RSSI_DBM);
+
+    length = encode(&snapshot, METRICS_ENDPOINT_RESPONSE_SIZE);
+    TEST_CHECK_EQUAL(METRICS_SNAPSHOT_METRIC_COUNT - 1u,
+                     scrape(buffer, length, scraped, METRICS_SNAPSHOT_METRIC_COUNT));
+    TEST_CHECK(0 == strcmp("restore_mttr_ms", scraped[METRICS_SNAPSHOT_RSSI_DBM - 1].name));
+    TEST_CHECK(0 == strcmp("pool_free_bytes", scraped[METRICS_SNAPSHOT_RSSI_DBM].name));
+
+    snapshot.present_mask = 0u;
+    TEST_CHECK_EQUAL(0u, encode(&snapshot, METRICS_ENDPOINT_RESPONSE_SIZE));
+}
+
+
+static void test_longest_snapshot_fits(void)
+{
+    metrics_snapshot_t snapshot;
+    uint32_t length;
+
+    /* INT32_MIN has the most characters of any value. */
+    fill_snapshot(&snapshot, INT32_MIN);
+
+    length = encode(&snapshot, METRICS_ENDPOINT_RESPONSE_SIZE);
+    printf("    Longest snapshot: %lu of %lu bytes\n", (unsigned long)length,
+           (unsigned long)METRICS_ENDPOINT_RESPONSE_SIZE);
+    TEST_CHECK(length <= METRICS_ENDPOINT_RESPONSE_SIZE);
+    TEST_CHECK(is_guard_intact(METRICS_ENDPOINT_RESPONSE_SIZE));
+    TEST_CHECK_EQUAL(METRICS_SNAPSHOT_METRIC_COUNT,
+                     scrape(buffer, length, scraped, METRICS_SNAPSHOT_METRIC_COUNT));
+}
+
+
+static void test_truncated_at_line_boundary(void)
+{
+    metrics_snapshot_t snapshot;
+    uint32_t full_length;
+    uint32_t line_ends[METRICS_SNAPSHOT_METRIC_COUNT + 1u];
+    uint32_t line_count = 0;
+    char full[METRICS_ENDPOINT_RESPONSE_SIZE];
+
+    fill_snapshot(&snapshot, INT32_MIN);
+    snapshot.values[METRICS_SNAPSHOT_CONNECTED] = 1;
+    snapshot.values[METRICS_SNAPSHOT_RSSI_DBM] = -67;
+
+    full_length = encode(&snapshot, METRICS_ENDPOINT_RESPONSE_SIZE);
+    memcpy(full, buffer, full_length);
+
+    line_ends[line_count++] = 0;
+    for (uint32_t index = 0; index < full_length; index++)
+    {
+        if ('\n' == full[index])
+        {
+            line_ends[line_count++] = index + 1u;
+        }
+    }
+
+    /* Every buffer size keeps the longest prefix of whole lines that fits,
+     * and writes nothing past the size, even when a later line is shorter
+     * than the one that did not fit.
+     */
+    for (uint32_t size = 0; size <= full_length; size++)
+    {
+        uint32_t expected = 0;
+        uint32_t length;
+
+        for (uint32_t line = 0; line < line_count; line++)
+        {
+            if (line_ends[line] <= size)
+            {
+                expected = line_ends[line];
+            }
+        }
+
+        length = encode(&snapshot, size);
+        TEST_CHECK_EQUAL(expected, length);
+        TEST_CHECK(is_guard_intact(size));
+        TEST_CHECK(0 == memcmp(buffer, full, length));
+        TEST_CHECK(scrape(buffer, length, scraped, METRICS_SNAPSHOT_METRIC_COUNT) >= 0);
+    }
+}
+
+
+static void test_scraper_rejects_malformed_text(void)
+{
+    TEST_CHECK_EQUAL(-1, scrape("uptime_s 1", 10u, scraped, METRICS_SNAPSHOT_METRIC_COUNT));
+    TEST_CHECK_EQUAL(-1, scrape("uptime_s  1\n", 12u, scraped, METRICS_SNAPSHOT_METRIC_COUNT));
+    TEST_CHECK_EQUAL(-1, scrape("uptime_s -\n", 11u, scraped, METRICS_SNAPSHOT_METRIC_COUNT));
+    TEST_CHECK_EQUAL(-1, scrape("Uptime 1\n", 9u, scraped, METRICS_SNAPSHOT_METRIC_COUNT));
+    TEST_CHECK_EQUAL(1, scrape("uptime_s 1\n", 11u, scraped, METRICS_SNAPSHOT_METRIC_COUNT));
+}
+
+
+int main(void)
+{
+    printf("Metrics snapshot\n");
+
+    TEST_RUN(test_format);
+    TEST_RUN(test_negative_values);
+    TEST_RUN(test_absent_metrics_left_out);
+    TEST_RUN(test_longest_snapshot_fits);
+    TEST_RUN(test_truncated_at_line_boundary);
+    TEST_RUN(test_scraper_rejects_malformed_text);
+
+    return (0u == test_failures) ? 0 : 1;
+}
+
+
+/* [] END OF FILE */
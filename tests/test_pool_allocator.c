@@ -0,0 +1,313 @@
+/*******************************************************************************
+* File Name: test_pool_allocator.c
+*
+* Description: Host unit tests of the pool allocator (pool_allocator.c):
+* requests of zero bytes, choice of the size class, overflow to the next class
+* and to the C library heap, reuse of the freed blocks, and pvPortCalloc().
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdio.h>
+
+#include "FreeRTOS.h"
+#include "pool_allocator.h"
+#include "test_common.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Size of the smallest class, and number of blocks of the two smallest. */
+#define TEST_SMALL_SIZE                     (32u)
+#define TEST_SMALL_BLOCKS                   (96u)
+#define TEST_MEDIUM_BLOCKS                  (64u)
+
+/* Maximum size of the code of the functions that call the allocator in the
+ * trace test, to check that a caller address falls within them.
+ */
+#define TEST_CALLER_CODE_SIZE               (256u)
+
+/* Larger than the largest class. */
+#define TEST_LARGE_SIZE                     (4096u)
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+uint32_t test_failures = 0;
+
+static uint32_t malloc_failed_hook_calls = 0;
+
+static void *small_blocks[TEST_SMALL_BLOCKS];
+static void *medium_blocks[TEST_MEDIUM_BLOCKS];
+
+static volatile uint32_t caller_calls = 0;
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+void vApplicationMallocFailedHook(void)
+{
+    malloc_failed_hook_calls++;
+}
+
+
+static uint32_t blocks_in_use(uint32_t class_index)
+{
+    pool_allocator_class_stats_t stats;
+
+    pool_allocator_get_class_stats(class_index, &stats);
+
+    return stats.blocks_in_use;
+}
+
+
+static void test_zero_size_returns_null(void)
+{
+    pool_allocator_class_stats_t before;
+    pool_allocator_class_stats_t after;
+
+    pool_allocator_get_class_stats(0u, &before);
+
+    TEST_CHECK(NULL == pvPortMalloc(0u));
+    TEST_CHECK(NULL == pvPortCalloc(0u, 16u));
+    TEST_CHECK(NULL == pvPortCalloc(16u, 0u));
+
+    pool_allocator_get_class_stats(0u, &after);
+    TEST_CHECK_EQUAL(before.allocations, after.allocations);
+    TEST_CHECK_EQUAL(before.failures, after.failures);
+    TEST_CHECK_EQUAL(0u, malloc_failed_hook_calls);
+}
+
+
+static void test_smallest_fitting_class(void)
+{
+    void *small = pvPortMalloc(1u);
+    void *medium = pvPortMalloc(TEST_SMALL_SIZE + 1u);
+    pool_allocator_class_stats_t stats;
+
+    TEST_CHECK(NULL != small);
+    TEST_CHECK(NULL != medium);
+    TEST_CHECK_EQUAL(0u, (uintptr_t)small % portBYTE_ALIGNMENT);
+    TEST_CHECK_EQUAL(0u, (uintptr_t)medium % portBYTE_ALIGNMENT);
+    TEST_CHECK_EQUAL(1u, blocks_in_use(0u));
+    TEST_CHECK_EQUAL(1u, blocks_in_use(1u));
+
+    pool_allocator_get_class_stats(1u, &stats);
+    TEST_CHECK_EQUAL(TEST_SMALL_SIZE + 1u, stats.requested_bytes_in_use);
+
+    vPortFree(small);
+    vPortFree(medium);
+    TEST_CHECK_EQUAL(0u, blocks_in_use(0u));
+    TEST_CHECK_EQUAL(0u, blocks_in_use(1u));
+}
+
+
+static void test_freed_block_is_reused(void)
+{
+    void *first = pvPortMalloc(TEST_SMALL_SIZE);
+    void *second;
+
+    vPortFree(first);
+    second = pvPortMalloc(TEST_SMALL_SIZE);
+
+    TEST_CHECK(first == second);
+    vPortFree(second);
+}
+
+
+static void test_full_class_overflows(void)
+{
+    pool_allocator_class_stats_t before;
+    pool_allocator_class_stats_t after;
+    pool_allocator_heap_stats_t heap_before;
+    pool_allocator_heap_stats_t heap_after;
+    void *overflow;
+
+    pool_allocator_get_class_stats(0u, &before);
+    pool_allocator_get_heap_stats(&heap_before);
+
+    for (uint32_t index = 0; index < TEST_SMALL_BLOCKS; index++)
+    {
+        small_blocks[index] = pvPortMalloc(TEST_SMALL_SIZE);
+        TEST_CHECK(NULL != small_blocks[index]);
+    }
+
+    /* The next small request is served by the next class. */
+    overflow = pvPortMalloc(TEST_SMALL_SIZE);
+    TEST_CHECK(NULL != overflow);
+    TEST_CHECK_EQUAL(1u, blocks_in_use(1u));
+
+    /* With the two smallest classes full, it moves one class further up. */
+    for (uint32_t index = 1u; index < TEST_MEDIUM_BLOCKS; index++)
+    {
+        medium_blocks[index] = pvPortMalloc(TEST_SMALL_SIZE + 1u);
+    }
+    medium_blocks[0] = pvPortMalloc(TEST_SMALL_SIZE);
+    TEST_CHECK_EQUAL(1u, blocks_in_use(2u));
+
+    pool_allocator_get_class_stats(0u, &after);
+    pool_allocator_get_heap_stats(&heap_after);
+    TEST_CHECK_EQUAL(TEST_SMALL_BLOCKS, after.high_water);
+    TEST_CHECK_EQUAL(before.failures + 2u, after.failures);
+    TEST_CHECK_EQUAL(heap_before.overflow_allocations, heap_after.overflow_allocations);
+
+    vPortFree(overflow);
+    for (uint32_t index = 0; index < TEST_SMALL_BLOCKS; index++)
+    {
+        vPortFree(small_blocks[index]);
+    }
+    for (uint32_t index = 0; index < TEST_MEDIUM_BLOCKS; index++)
+    {
+        vPortFree(medium_blocks[index]);
+    }
+
+    TEST_CHECK_EQUAL(0u, blocks_in_use(0u));
+    TEST_CHECK_EQUAL(0u, blocks_in_use(1u));
+    TEST_CHECK_EQUAL(0u, blocks_in_use(2u));
+}
+
+
+static void test_large_request_uses_c_heap(void)
+{
+    pool_allocator_heap_stats_t before;
+    pool_allocator_heap_stats_t after;
+    void *large;
+
+    pool_allocator_get_heap_stats(&before);
+    large = pvPortMalloc(TEST_LARGE_SIZE);
+    pool_allocator_get_heap_stats(&after);
+
+    TEST_CHECK(NULL != large);
+    TEST_CHECK_EQUAL(before.large_allocations + 1u, after.large_allocations);
+
+    vPortFree(large);
+    vPortFree(NULL);
+}
+
+
+static void test_calloc_zeroes_and_checks_overflow(void)
+{
+    uint8_t *block = pvPortMalloc(TEST_SMALL_SIZE);
+    uint32_t non_zero = 0;
+
+    /* Leave a pattern in the block that calloc will get next. */
+    for (uint32_t index = 0; index < TEST_SMALL_SIZE; index++)
+    {
+        block[index] = 0xA5u;
+    }
+    vPortFree(block);
+
+    block = pvPortCalloc(4u, TEST_SMALL_SIZE / 4u);
+    TEST_CHECK(NULL != block);
+    for (uint32_t index = 0; index < TEST_SMALL_SIZE; index++)
+    {
+        non_zero += (0u != block[index]) ? 1u : 0u;
+    }
+    TEST_CHECK_EQUAL(0u, non_zero);
+    vPortFree(block);
+
+    TEST_CHECK(NULL == pvPortCalloc(SIZE_MAX / 2u, 4u));
+}
+
+
+/* The callers do some work after the call so that it is not a tail call. */
+static __attribute__((noinline)) void calloc_caller(void **block)
+{
+    *block = pvPortCalloc(2u, TEST_SMALL_SIZE / 2u);
+    caller_calls++;
+}
+
+
+static __attribute__((noinline)) void free_caller(void *block)
+{
+    vPortFree(block);
+    caller_calls++;
+}
+
+
+static bool is_in_function(void *caller, void (*function)(void))
+{
+    uintptr_t start = (uintptr_t)function;
+
+    return ((uintptr_t)caller > start) && ((uintptr_t)caller < (start + TEST_CALLER_CODE_SIZE));
+}
+
+
+static void test_trace_records_caller(void)
+{
+    pool_allocator_trace_entry_t entries[2];
+    void *block;
+
+    pool_allocator_set_trace(true);
+    calloc_caller(&block);
+    free_caller(block);
+    pool_allocator_set_trace(false);
+
+    TEST_CHECK_EQUAL(2u, pool_allocator_read_trace(entries, 2u));
+    TEST_CHECK_EQUAL(POOL_ALLOCATOR_TRACE_ALLOC, entries[0].op);
+    TEST_CHECK_EQUAL(TEST_SMALL_SIZE, entries[0].size);
+    TEST_CHECK(block == entries[0].address);
+    TEST_CHECK_EQUAL(POOL_ALLOCATOR_TRACE_FREE, entries[1].op);
+
+    /* The caller of pvPortCalloc() is recorded, not pvPortCalloc() itself. */
+    TEST_CHECK(is_in_function(entries[0].caller, (void (*)(void))calloc_caller));
+    TEST_CHECK(!is_in_function(entries[0].caller, (void (*)(void))pvPortCalloc));
+    TEST_CHECK(is_in_function(entries[1].caller, (void (*)(void))free_caller));
+}
+
+
+int main(void)
+{
+    printf("Pool allocator\n");
+
+    TEST_RUN(test_zero_size_returns_null);
+    TEST_RUN(test_smallest_fitting_class);
+    TEST_RUN(test_freed_block_is_reused);
+    TEST_RUN(test_full_class_overflows);
+    TEST_RUN(test_large_request_uses_c_heap);
+    TEST_RUN(test_calloc_zeroes_and_checks_overflow);
+    TEST_RUN(test_trace_records_caller);
+
+    return (0u == test_failures) ? 0 : 1;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,490 @@
+/*******************************************************************************
+* File Name: test_power_save_policy.c
+*
+* Description: Host unit tests of the power-save level selection
+* (power_save_policy.c): packet rate traces are replayed one sample at a time
+* and the level switches are counted, to check that steady, jittery, and
+* bursty traffic does not make the controller oscillate between levels.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdio.h>
+
+#include "power_save_controller.h"
+#include "test_common.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Length of the replayed traces, in samples. */
+#define TEST_TRACE_SAMPLES                  (1200u)
+
+/* Samples at the start of a trace in which the level may still settle. */
+#define TEST_SETTLE_SAMPLES                 (300u)
+
+/* Rate of the bursts, above the performance enter threshold. */
+#define TEST_BURST_PPS                      (80u)
+
+/* Level switches allowed while the hold of bursty traffic builds up. */
+#define TEST_MAX_SETTLE_SWITCHES            (10u)
+
+/* Samples needed to leave performance for low power with the longest hold. */
+#define TEST_MAX_DOWN_SAMPLES               ((POWER_SAVE_PERFORMANCE_EXIT_SAMPLES + \
+                                              POWER_SAVE_BALANCED_EXIT_SAMPLES) * POWER_SAVE_MAX_EXIT_BACKOFF)
+
+/* Assumed beacon interval (100 TU) with a DTIM period of one beacon, and time
+ * of a request and response once the device is awake.
+ */
+#define TEST_DTIM_MSEC                      (102u)
+#define TEST_EXCHANGE_MSEC                  (5u)
+
+/* Assumed mean round-trip time of a request from the network in each level:
+ * the device in power save receives it at the next wake, on average half a
+ * listen interval later.
+ */
+#define TEST_LOW_POWER_LATENCY_MSEC         (((POWER_SAVE_LOW_POWER_LISTEN_DTIM * TEST_DTIM_MSEC) / 2u) + \
+                                             TEST_EXCHANGE_MSEC)
+#define TEST_BALANCED_LATENCY_MSEC          ((TEST_DTIM_MSEC / 2u) + TEST_EXCHANGE_MSEC)
+#define TEST_PERFORMANCE_LATENCY_MSEC       (TEST_EXCHANGE_MSEC)
+
+/* Assumed mean current of the Wi-Fi device in each level without traffic. */
+#define TEST_LOW_POWER_CURRENT_UA           (600u)
+#define TEST_BALANCED_CURRENT_UA            (1500u)
+#define TEST_PERFORMANCE_CURRENT_UA         (25000u)
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Result of a replayed trace. */
+typedef struct
+{
+    uint32_t switches;          /* Level switches over the whole trace */
+    uint32_t settled_switches;  /* Level switches after TEST_SETTLE_SAMPLES */
+    power_save_level_t level;   /* Level after the last sample */
+    uint64_t packets;           /* Packets over the whole trace */
+    uint64_t latency_sum_ms;    /* Modeled round-trip time summed over the packets */
+    uint64_t current_sum_ua;    /* Modeled current summed over the samples */
+    uint32_t samples;
+} test_replay_t;
+
+/* Modeled cost of a level. */
+typedef struct
+{
+    uint32_t latency_ms;
+    uint32_t current_ua;
+} test_level_model_t;
+
+/* Returns the packet rate of a sample of a trace. */
+typedef uint32_t (*test_trace_t)(uint32_t sample);
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+uint32_t test_failures = 0;
+
+/* Parameters of the traces. */
+static uint32_t trace_rate;
+static uint32_t trace_low_rate;
+static uint32_t trace_period;
+static uint32_t trace_burst_samples;
+static uint32_t trace_seed;
+
+/* These are assumptions to compare the policy against fixed levels, not
+ * measurements of the board.
+ */
+static const test_level_model_t level_models[POWER_SAVE_LEVEL_COUNT] =
+{
+    [POWER_SAVE_LEVEL_LOW_POWER]   = { TEST_LOW_POWER_LATENCY_MSEC, TEST_LOW_POWER_CURRENT_UA },
+    [POWER_SAVE_LEVEL_BALANCED]    = { TEST_BALANCED_LATENCY_MSEC, TEST_BALANCED_CURRENT_UA },
+    [POWER_SAVE_LEVEL_PERFORMANCE] = { TEST_PERFORMANCE_LATENCY_MSEC, TEST_PERFORMANCE_CURRENT_UA },
+};
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/* Adds the modeled cost of a sample at the rate spent in the level. */
+static void account(test_replay_t *result, power_save_level_t level, uint32_t rate_pps)
+{
+    result->packets += rate_pps;
+    result->latency_sum_ms += (uint64_t)rate_pps * level_models[level].latency_ms;
+    result->current_sum_ua += level_models[level].current_ua;
+    result->samples++;
+}
+
+
+static uint32_t mean_latency_ms(const test_replay_t *result)
+{
+    return (0u == result->packets) ? 0u : (uint32_t)(result->latency_sum_ms / result->packets);
+}
+
+
+static uint32_t mean_current_ua(const test_replay_t *result)
+{
+    return (0u == result->samples) ? 0u : (uint32_t)(result->current_sum_ua / result->samples);
+}
+
+
+/* Feeds sample_count samples of the trace to the policy. The packets of a
+ * sample are sent in the level selected after the previous sample.
+ */
+static test_replay_t replay(power_save_policy_t *policy, test_trace_t trace, uint32_t sample_count)
+{
+    test_replay_t result = { 0u, 0u, policy->level, 0u, 0u, 0u, 0u };
+    power_save_level_t level;
+    uint32_t rate_pps;
+    uint32_t sample;
+
+    for (sample = 0u; sample < sample_count; sample++)
+    {
+        rate_pps = trace(sample);
+        account(&result, result.level, rate_pps);
+        level = power_save_policy_update(policy, rate_pps);
+        if (level != result.level)
+        {
+            result.switches++;
+            if (sample >= TEST_SETTLE_SAMPLES)
+            {
+                result.settled_switches++;
+            }
+            result.level = level;
+        }
+    }
+
+    return result;
+}
+
+
+static test_replay_t replay_from(power_save_level_t level, test_trace_t trace, uint32_t sample_count)
+{
+    power_save_policy_t policy;
+
+    power_save_policy_reset(&policy, level);
+    return replay(&policy, trace, sample_count);
+}
+
+
+/* Replays the trace in a fixed level, as without the policy. */
+static test_replay_t replay_fixed(power_save_level_t level, test_trace_t trace, uint32_t sample_count)
+{
+    test_replay_t result = { 0u, 0u, level, 0u, 0u, 0u, 0u };
+    uint32_t sample;
+
+    for (sample = 0u; sample < sample_count; sample++)
+    {
+        account(&result, level, trace(sample));
+    }
+
+    return result;
+}
+
+
+static uint32_t steady_trace(uint32_t sample)
+{
+    return trace_rate;
+}
+
+
+/* Alternates between trace_low_rate and trace_rate on every sample. */
+static uint32_t alternating_trace(uint32_t sample)
+{
+    return (0u == (sample % 2u)) ? trace_low_rate : trace_rate;
+}
+
+
+/* Pseudo-random rate between trace_low_rate and trace_rate. */
+static uint32_t jitter_trace(uint32_t sample)
+{
+    trace_seed = (trace_seed * 1103515245u) + 12345u;
+    return trace_low_rate + ((trace_seed >> 16) % (trace_rate - trace_low_rate + 1u));
+}
+
+
+/* trace_burst_samples at TEST_BURST_PPS every trace_period samples, and
+ * trace_low_rate in between.
+ */
+static uint32_t burst_trace(uint32_t sample)
+{
+    return ((sample % trace_period) < trace_burst_samples) ? TEST_BURST_PPS : trace_low_rate;
+}
+
+
+static uint32_t idle_trace(uint32_t sample)
+{
+    return 0u;
+}
+
+
+static void test_rise_is_immediate(void)
+{
+    power_save_policy_t policy;
+
+    power_save_policy_reset(&policy, POWER_SAVE_LEVEL_LOW_POWER);
+    TEST_CHECK_EQUAL(POWER_SAVE_LEVEL_BALANCED, power_save_policy_update(&policy, POWER_SAVE_BALANCED_ENTER_PPS));
+
+    power_save_policy_reset(&policy, POWER_SAVE_LEVEL_LOW_POWER);
+    TEST_CHECK_EQUAL(POWER_SAVE_LEVEL_PERFORMANCE,
+                     power_save_policy_update(&policy, POWER_SAVE_PERFORMANCE_ENTER_PPS));
+}
+
+
+static void test_steady_rates_hold_level(void)
+{
+    static const struct
+    {
+        uint32_t rate_pps;
+        power_save_level_t level;
+    } cases[] =
+    {
+        { 0u,   POWER_SAVE_LEVEL_LOW_POWER },
+        { 3u,   POWER_SAVE_LEVEL_BALANCED },
+        { 30u,  POWER_SAVE_LEVEL_BALANCED },
+        { 100u, POWER_SAVE_LEVEL_PERFORMANCE },
+    };
+    test_replay_t result;
+    uint32_t i;
+
+    for (i = 0u; i < (sizeof(cases) / sizeof(cases[0])); i++)
+    {
+        trace_rate = cases[i].rate_pps;
+        result = replay_from(POWER_SAVE_LEVEL_BALANCED, steady_trace, TEST_TRACE_SAMPLES);
+        TEST_CHECK_EQUAL(cases[i].level, result.level);
+        TEST_CHECK(result.switches <= 1u);
+    }
+
+    /* Between the exit and enter rates, performance is kept once entered. */
+    trace_rate = 30u;
+    result = replay_from(POWER_SAVE_LEVEL_PERFORMANCE, steady_trace, TEST_TRACE_SAMPLES);
+    TEST_CHECK_EQUAL(POWER_SAVE_LEVEL_PERFORMANCE, result.level);
+    TEST_CHECK_EQUAL(0u, result.switches);
+}
+
+
+static void test_rate_near_threshold_does_not_toggle(void)
+{
+    test_replay_t result;
+
+    /* Either side of the performance enter threshold. */
+    trace_low_rate = POWER_SAVE_PERFORMANCE_ENTER_PPS - 5u;
+    trace_rate = POWER_SAVE_PERFORMANCE_ENTER_PPS + 5u;
+    result = replay_from(POWER_SAVE_LEVEL_BALANCED, alternating_trace, TEST_TRACE_SAMPLES);
+    TEST_CHECK_EQUAL(POWER_SAVE_LEVEL_PERFORMANCE, result.level);
+    TEST_CHECK_EQUAL(1u, result.switches);
+
+    /* Either side of the performance exit threshold. */
+    trace_low_rate = POWER_SAVE_PERFORMANCE_EXIT_PPS - 5u;
+    trace_rate = POWER_SAVE_PERFORMANCE_EXIT_PPS + 5u;
+    result = replay_from(POWER_SAVE_LEVEL_PERFORMANCE, alternating_trace, TEST_TRACE_SAMPLES);
+    TEST_CHECK_EQUAL(POWER_SAVE_LEVEL_PERFORMANCE, result.level);
+    TEST_CHECK_EQUAL(0u, result.switches);
+
+    /* Either side of the balanced enter threshold. */
+    trace_low_rate = POWER_SAVE_BALANCED_ENTER_PPS - 1u;
+    trace_rate = POWER_SAVE_BALANCED_ENTER_PPS + 1u;
+    result = replay_from(POWER_SAVE_LEVEL_LOW_POWER, alternating_trace, TEST_TRACE_SAMPLES);
+    TEST_CHECK_EQUAL(POWER_SAVE_LEVEL_BALANCED, result.level);
+    TEST_CHECK_EQUAL(1u, result.switches);
+
+    /* Random rate across the performance enter and exit thresholds. */
+    trace_seed = 1u;
+    trace_low_rate = POWER_SAVE_PERFORMANCE_EXIT_PPS;
+    trace_rate = POWER_SAVE_PERFORMANCE_ENTER_PPS + 10u;
+    result = replay_from(POWER_SAVE_LEVEL_BALANCED, jitter_trace, TEST_TRACE_SAMPLES);
+    TEST_CHECK_EQUAL(POWER_SAVE_LEVEL_PERFORMANCE, result.level);
+    TEST_CHECK_EQUAL(1u, result.switches);
+}
+
+
+static void test_periodic_bursts_do_not_oscillate(void)
+{
+    test_replay_t result;
+
+    /* Bursts that come back within the flap window after performance is left:
+     * the level settles within a few bursts and then stays, instead of
+     * switching twice for every burst.
+     */
+    for (trace_period = 2u;
+         trace_period <= (POWER_SAVE_FLAP_WINDOW_SAMPLES + POWER_SAVE_PERFORMANCE_EXIT_SAMPLES);
+         trace_period++)
+    {
+        trace_burst_samples = 1u;
+        trace_low_rate = 0u;
+        result = replay_from(POWER_SAVE_LEVEL_BALANCED, burst_trace, TEST_TRACE_SAMPLES);
+        TEST_CHECK_EQUAL(0u, result.settled_switches);
+        TEST_CHECK(result.switches <= TEST_MAX_SETTLE_SWITCHES);
+    }
+
+    /* Rare bursts are followed, but with at most one rise and the two falls
+     * back to low power for each burst.
+     */
+    trace_period = 120u;
+    trace_burst_samples = 1u;
+    trace_low_rate = 0u;
+    result = replay_from(POWER_SAVE_LEVEL_LOW_POWER, burst_trace, TEST_TRACE_SAMPLES);
+    TEST_CHECK(result.switches <= (3u * (TEST_TRACE_SAMPLES / trace_period)));
+
+    /* Longer bursts over background traffic that keeps the balanced level. */
+    trace_period = 12u;
+    trace_burst_samples = 3u;
+    trace_low_rate = 3u;
+    result = replay_from(POWER_SAVE_LEVEL_BALANCED, burst_trace, TEST_TRACE_SAMPLES);
+    TEST_CHECK_EQUAL(POWER_SAVE_LEVEL_PERFORMANCE, result.level);
+    TEST_CHECK_EQUAL(0u, result.settled_switches);
+}
+
+
+static void test_idle_after_bursts_returns_to_low_power(void)
+{
+    power_save_policy_t policy;
+    test_replay_t result;
+
+    trace_period = 10u;
+    trace_burst_samples = 1u;
+    trace_low_rate = 0u;
+    power_save_policy_reset(&policy, POWER_SAVE_LEVEL_BALANCED);
+    (void)replay(&policy, burst_trace, TEST_TRACE_SAMPLES);
+
+    /* The hold built up by the bursts delays the return to low power but
+     * does not prevent it.
+     */
+    result = replay(&policy, idle_trace, TEST_MAX_DOWN_SAMPLES);
+    TEST_CHECK_EQUAL(POWER_SAVE_LEVEL_LOW_POWER, result.level);
+
+    /* Once idle for longer than the window, a single burst is followed by the
+     * configured exit samples again.
+     */
+    (void)replay(&policy, idle_trace, POWER_SAVE_FLAP_WINDOW_SAMPLES + 1u);
+    TEST_CHECK_EQUAL(POWER_SAVE_LEVEL_PERFORMANCE, power_save_policy_update(&policy, TEST_BURST_PPS));
+    result = replay(&policy, idle_trace, POWER_SAVE_PERFORMANCE_EXIT_SAMPLES);
+    TEST_CHECK_EQUAL(POWER_SAVE_LEVEL_BALANCED, result.level);
+}
+
+
+static void test_model_trades_latency_for_current(void)
+{
+    static const struct
+    {
+        const char *name;
+        test_trace_t trace;
+        uint32_t rate;
+        uint32_t low_rate;
+        uint32_t period;
+        uint32_t burst_samples;
+    } cases[] =
+    {
+        { "idle",                 idle_trace,   0u,   0u, 1u,   0u },
+        { "steady 3 pkt/s",       steady_trace, 3u,   0u, 1u,   0u },
+        { "steady 100 pkt/s",     steady_trace, 100u, 0u, 1u,   0u },
+        { "jitter 20-60 pkt/s",   jitter_trace, 60u,  20u, 1u,  0u },
+        { "burst every 10 s",     burst_trace,  0u,   0u, 10u,  1u },
+        { "burst every 120 s",    burst_trace,  0u,   0u, 120u, 1u },
+        { "bursts over 3 pkt/s",  burst_trace,  0u,   3u, 12u,  3u },
+    };
+    test_replay_t adaptive;
+    test_replay_t fixed[POWER_SAVE_LEVEL_COUNT];
+    uint32_t i;
+    uint32_t level;
+
+    printf("  Modeled round-trip ms / mean current mA (assumed level costs):\n");
+    printf("    %-20s %14s %14s %14s %14s\n", "Trace", "adaptive",
+           "low power", "balanced", "performance");
+
+    for (i = 0u; i < (sizeof(cases) / sizeof(cases[0])); i++)
+    {
+        trace_rate = cases[i].rate;
+        trace_low_rate = cases[i].low_rate;
+        trace_period = cases[i].period;
+        trace_burst_samples = cases[i].burst_samples;
+
+        trace_seed = 1u;
+        adaptive = replay_from(POWER_SAVE_LEVEL_BALANCED, cases[i].trace, TEST_TRACE_SAMPLES);
+        for (level = 0u; level < (uint32_t)POWER_SAVE_LEVEL_COUNT; level++)
+        {
+            trace_seed = 1u;
+            fixed[level] = replay_fixed((power_save_level_t)level, cases[i].trace, TEST_TRACE_SAMPLES);
+        }
+
+        printf("    %-20s %5lu / %6.2f", cases[i].name, (unsigned long)mean_latency_ms(&adaptive),
+               mean_current_ua(&adaptive) / 1000.0);
+        for (level = 0u; level < (uint32_t)POWER_SAVE_LEVEL_COUNT; level++)
+        {
+            printf(" %5lu / %6.2f", (unsigned long)mean_latency_ms(&fixed[level]),
+                   mean_current_ua(&fixed[level]) / 1000.0);
+        }
+        printf("\n");
+
+        /* The policy never costs more current than staying in performance nor
+         * more latency than staying in low power.
+         */
+        TEST_CHECK(mean_current_ua(&adaptive) <= mean_current_ua(&fixed[POWER_SAVE_LEVEL_PERFORMANCE]));
+        TEST_CHECK(mean_latency_ms(&adaptive) <= mean_latency_ms(&fixed[POWER_SAVE_LEVEL_LOW_POWER]));
+    }
+
+    /* Without traffic the current is close to that of low power, and with
+     * sustained traffic the latency is close to that of performance.
+     */
+    adaptive = replay_from(POWER_SAVE_LEVEL_BALANCED, idle_trace, TEST_TRACE_SAMPLES);
+    TEST_CHECK(mean_current_ua(&adaptive) <= ((TEST_LOW_POWER_CURRENT_UA * 105u) / 100u));
+
+    trace_rate = 100u;
+    adaptive = replay_from(POWER_SAVE_LEVEL_BALANCED, steady_trace, TEST_TRACE_SAMPLES);
+    TEST_CHECK(mean_latency_ms(&adaptive) <= (TEST_PERFORMANCE_LATENCY_MSEC + 1u));
+}
+
+
+int main(void)
+{
+    printf("Power-save level selection\n");
+
+    TEST_RUN(test_rise_is_immediate);
+    TEST_RUN(test_steady_rates_hold_level);
+    TEST_RUN(test_rate_near_threshold_does_not_toggle);
+    TEST_RUN(test_periodic_bursts_do_not_oscillate);
+    TEST_RUN(test_idle_after_bursts_returns_to_low_power);
+    TEST_RUN(test_model_trades_latency_for_current);
+
+    return (0u == test_failures) ? 0 : 1;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,375 @@
+/*******************************************************************************
+* File Name: test_provisioning_relay_protocol.c
+*
+* Description: Host unit tests of the framing, the key derivation, and the
+* AES-CCM encryption of the provisioning relay messages.
+*
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "mbedtls/ccm.h"
+#include "provisioning_relay.h"
+#include "test_common.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define TEST_SSID                           "HomeNetwork"
+#define TEST_PASSPHRASE                     "correct horse battery staple"
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+uint32_t test_failures = 0;
+
+/* First PROVISIONING_RELAY_KEY_SIZE bytes of
+ * HMAC-SHA256("host-test-fleet-key", "wps-relay-v1\0" | 00..0F | 80..8F),
+ * computed independently of the code under test.
+ */
+static const uint8_t expected_key[PROVISIONING_RELAY_KEY_SIZE] =
+{
+    0xF6u, 0xC9u, 0x6Eu, 0xBEu, 0x88u, 0xE0u, 0x1Eu, 0x64u,
+    0x37u, 0x82u, 0xD4u, 0xADu, 0x48u, 0x54u, 0x1Du, 0x52u
+};
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+static void fill_nonce(uint8_t *nonce, uint8_t first)
+{
+    for (uint32_t index = 0; index < PROVISIONING_RELAY_NONCE_SIZE; index++)
+    {
+        nonce[index] = (uint8_t)(first + index);
+    }
+}
+
+
+static void fill_credential(provisioning_relay_credential_t *credential)
+{
+    static const cy_wcm_mac_t bssid = { 0x00u, 0x03u, 0x7Fu, 0x12u, 0x34u, 0x56u };
+
+    memset(credential, 0, sizeof(provisioning_relay_credential_t));
+    credential->security = (uint32_t)CY_WCM_SECURITY_WPA2_AES_PSK;
+    credential->band = (uint32_t)CY_WCM_WIFI_BAND_5GHZ;
+    memcpy(credential->bssid, bssid, sizeof(bssid));
+    memcpy(credential->ssid, TEST_SSID, sizeof(TEST_SSID));
+    memcpy(credential->passphrase, TEST_PASSPHRASE, sizeof(TEST_PASSPHRASE));
+}
+
+
+static bool contains(const void *buffer, uint32_t length, const char *text)
+{
+    uint32_t text_length = (uint32_t)strlen(text);
+
+    for (uint32_t offset = 0; (offset + text_length) <= length; offset++)
+    {
+        if (0 == memcmp((const uint8_t *)buffer + offset, text, text_length))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+/* Builds a request and the response a relay seals for it. */
+static void exchange(uint8_t request_first, uint8_t response_first, provisioning_relay_header_t *request,
+                     provisioning_relay_response_t *response)
+{
+    provisioning_relay_credential_t credential;
+    uint8_t nonce[PROVISIONING_RELAY_NONCE_SIZE];
+
+    fill_nonce(nonce, request_first);
+    provisioning_relay_init_header(request, PROVISIONING_RELAY_MESSAGE_REQUEST, nonce);
+
+    fill_credential(&credential);
+    fill_nonce(nonce, response_first);
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, provisioning_relay_seal_response(request, nonce, &credential, response));
+}
+
+
+/* Checks that a response is rejected and that no credential is returned. */
+static void check_rejected(const provisioning_relay_header_t *request, const provisioning_relay_response_t *response,
+                           cy_rslt_t expected)
+{
+    provisioning_relay_credential_t credential;
+    provisioning_relay_credential_t cleared;
+
+    memset(&credential, 0xA5, sizeof(credential));
+    memset(&cleared, 0, sizeof(cleared));
+
+    TEST_CHECK_EQUAL(expected, provisioning_relay_open_response(request, response, &credential));
+    TEST_CHECK(0 == memcmp(&cleared, &credential, sizeof(credential)));
+}
+
+
+/* The CCM stand-in must match RFC 3610 packet vector #1 for the tests below
+ * to be meaningful.
+ */
+static void test_ccm_matches_rfc3610(void)
+{
+    static const uint8_t key[16] =
+    {
+        0xC0u, 0xC1u, 0xC2u, 0xC3u, 0xC4u, 0xC5u, 0xC6u, 0xC7u,
+        0xC8u, 0xC9u, 0xCAu, 0xCBu, 0xCCu, 0xCDu, 0xCEu, 0xCFu
+    };
+    static const uint8_t nonce[13] =
+    {
+        0x00u, 0x00u, 0x00u, 0x03u, 0x02u, 0x01u, 0x00u, 0xA0u, 0xA1u, 0xA2u, 0xA3u, 0xA4u, 0xA5u
+    };
+    static const uint8_t expected_ciphertext[23] =
+    {
+        0x58u, 0x8Cu, 0x97u, 0x9Au, 0x61u, 0xC6u, 0x63u, 0xD2u, 0xF0u, 0x66u, 0xD0u, 0xC2u,
+        0xC0u, 0xF9u, 0x89u, 0x80u, 0x6Du, 0x5Fu, 0x6Bu, 0x61u, 0xDAu, 0xC3u, 0x84u
+    };
+    static const uint8_t expected_tag[8] = { 0x17u, 0xE8u, 0xD1u, 0x2Cu, 0xFDu, 0xF9u, 0x26u, 0xE0u };
+    uint8_t aad[8];
+    uint8_t plaintext[23];
+    uint8_t ciphertext[23];
+    uint8_t decrypted[23];
+    uint8_t tag[8];
+    mbedtls_ccm_context ccm;
+
+    for (uint32_t index = 0; index < sizeof(aad); index++)
+    {
+        aad[index] = (uint8_t)index;
+    }
+    for (uint32_t index = 0; index < sizeof(plaintext); index++)
+    {
+        plaintext[index] = (uint8_t)(sizeof(aad) + index);
+    }
+
+    mbedtls_ccm_init(&ccm);
+    TEST_CHECK_EQUAL(0, mbedtls_ccm_setkey(&ccm, MBEDTLS_CIPHER_ID_AES, key, 128u));
+    TEST_CHECK_EQUAL(0, mbedtls_ccm_encrypt_and_tag(&ccm, sizeof(plaintext), nonce, sizeof(nonce), aad, sizeof(aad),
+                                                    plaintext, ciphertext, tag, sizeof(tag)));
+    TEST_CHECK(0 == memcmp(expected_ciphertext, ciphertext, sizeof(ciphertext)));
+    TEST_CHECK(0 == memcmp(expected_tag, tag, sizeof(tag)));
+
+    TEST_CHECK_EQUAL(0, mbedtls_ccm_auth_decrypt(&ccm, sizeof(ciphertext), nonce, sizeof(nonce), aad, sizeof(aad),
+                                                 ciphertext, decrypted, tag, sizeof(tag)));
+    TEST_CHECK(0 == memcmp(plaintext, decrypted, sizeof(plaintext)));
+
+    tag[0] ^= 0x01u;
+    TEST_CHECK_EQUAL(MBEDTLS_ERR_CCM_AUTH_FAILED,
+                     mbedtls_ccm_auth_decrypt(&ccm, sizeof(ciphertext), nonce, sizeof(nonce), aad, sizeof(aad),
+                                              ciphertext, decrypted, tag, sizeof(tag)));
+    mbedtls_ccm_free(&ccm);
+}
+
+
+/* The messages are exchanged as raw structures between devices that may run
+ * different builds, so their layout is part of the protocol.
+ */
+static void test_message_layout(void)
+{
+    TEST_CHECK_EQUAL(8u + PROVISIONING_RELAY_NONCE_SIZE, sizeof(provisioning_relay_header_t));
+    TEST_CHECK_EQUAL(8u, offsetof(provisioning_relay_header_t, nonce));
+    TEST_CHECK_EQUAL(8u + CY_WCM_MAC_ADDR_LEN + (CY_WCM_MAX_SSID_LEN + 1u) + (CY_WCM_MAX_PASSPHRASE_LEN + 1u),
+                     sizeof(provisioning_relay_credential_t));
+    TEST_CHECK_EQUAL(sizeof(provisioning_relay_header_t) + sizeof(provisioning_relay_credential_t) +
+                     PROVISIONING_RELAY_TAG_SIZE, sizeof(provisioning_relay_response_t));
+}
+
+
+static void test_header(void)
+{
+    provisioning_relay_header_t header;
+    uint8_t nonce[PROVISIONING_RELAY_NONCE_SIZE];
+
+    fill_nonce(nonce, 1u);
+    memset(&header, 0xFF, sizeof(header));
+    provisioning_relay_init_header(&header, PROVISIONING_RELAY_MESSAGE_REQUEST, nonce);
+
+    TEST_CHECK_EQUAL(PROVISIONING_RELAY_MESSAGE_MAGIC, header.magic);
+    TEST_CHECK_EQUAL(0u, header.reserved[0] | header.reserved[1] | header.reserved[2]);
+    TEST_CHECK(0 == memcmp(nonce, header.nonce, sizeof(nonce)));
+    TEST_CHECK(provisioning_relay_is_header_valid(&header, PROVISIONING_RELAY_MESSAGE_REQUEST));
+    TEST_CHECK(!provisioning_relay_is_header_valid(&header, PROVISIONING_RELAY_MESSAGE_RESPONSE));
+
+    header.magic ^= 1u;
+    TEST_CHECK(!provisioning_relay_is_header_valid(&header, PROVISIONING_RELAY_MESSAGE_REQUEST));
+}
+
+
+static void test_key_derivation(void)
+{
+    uint8_t request_nonce[PROVISIONING_RELAY_NONCE_SIZE];
+    uint8_t response_nonce[PROVISIONING_RELAY_NONCE_SIZE];
+    uint8_t key[PROVISIONING_RELAY_KEY_SIZE];
+
+    fill_nonce(request_nonce, 0x00u);
+    fill_nonce(response_nonce, 0x80u);
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, provisioning_relay_derive_key(request_nonce, response_nonce, key));
+    TEST_CHECK(0 == memcmp(expected_key, key, sizeof(key)));
+
+    /* The nonces are not interchangeable. */
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, provisioning_relay_derive_key(response_nonce, request_nonce, key));
+    TEST_CHECK(0 != memcmp(expected_key, key, sizeof(key)));
+
+    /* Each side changes the key. */
+    response_nonce[PROVISIONING_RELAY_NONCE_SIZE - 1u] ^= 0x01u;
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, provisioning_relay_derive_key(request_nonce, response_nonce, key));
+    TEST_CHECK(0 != memcmp(expected_key, key, sizeof(key)));
+}
+
+
+static void test_round_trip(void)
+{
+    provisioning_relay_header_t request;
+    provisioning_relay_response_t response;
+    provisioning_relay_credential_t sent;
+    provisioning_relay_credential_t received;
+    uint8_t nonce[PROVISIONING_RELAY_NONCE_SIZE];
+
+    exchange(0x10u, 0x90u, &request, &response);
+
+    fill_nonce(nonce, 0x90u);
+    TEST_CHECK(provisioning_relay_is_header_valid(&response.header, PROVISIONING_RELAY_MESSAGE_RESPONSE));
+    TEST_CHECK(0 == memcmp(nonce, response.header.nonce, sizeof(nonce)));
+
+    /* Neither the passphrase nor the SSID is sent in clear. */
+    TEST_CHECK(!contains(&response, sizeof(response), TEST_PASSPHRASE));
+    TEST_CHECK(!contains(&response, sizeof(response), TEST_SSID));
+
+    fill_credential(&sent);
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, provisioning_relay_open_response(&request, &response, &received));
+    TEST_CHECK(0 == memcmp(&sent, &received, sizeof(sent)));
+}
+
+
+static void test_tampered_response_is_rejected(void)
+{
+    provisioning_relay_header_t request;
+    provisioning_relay_response_t response;
+    provisioning_relay_response_t tampered;
+
+    exchange(0x20u, 0xA0u, &request, &response);
+
+    memcpy(&tampered, &response, sizeof(response));
+    tampered.ciphertext[0] ^= 0x01u;
+    check_rejected(&request, &tampered, PROVISIONING_RELAY_RSLT_AUTH_FAILED);
+
+    memcpy(&tampered, &response, sizeof(response));
+    tampered.ciphertext[sizeof(tampered.ciphertext) - 1u] ^= 0x80u;
+    check_rejected(&request, &tampered, PROVISIONING_RELAY_RSLT_AUTH_FAILED);
+
+    memcpy(&tampered, &response, sizeof(response));
+    tampered.tag[PROVISIONING_RELAY_TAG_SIZE - 1u] ^= 0x01u;
+    check_rejected(&request, &tampered, PROVISIONING_RELAY_RSLT_AUTH_FAILED);
+
+    /* The nonce of the relay is authenticated, including the bytes that are
+     * not part of the CCM nonce.
+     */
+    memcpy(&tampered, &response, sizeof(response));
+    tampered.header.nonce[PROVISIONING_RELAY_NONCE_SIZE - 1u] ^= 0x01u;
+    check_rejected(&request, &tampered, PROVISIONING_RELAY_RSLT_AUTH_FAILED);
+
+    memcpy(&tampered, &response, sizeof(response));
+    tampered.header.reserved[0] = 1u;
+    check_rejected(&request, &tampered, PROVISIONING_RELAY_RSLT_AUTH_FAILED);
+}
+
+
+static void test_bad_header_is_rejected(void)
+{
+    provisioning_relay_header_t request;
+    provisioning_relay_response_t response;
+    provisioning_relay_response_t tampered;
+
+    exchange(0x30u, 0xB0u, &request, &response);
+
+    memcpy(&tampered, &response, sizeof(response));
+    tampered.header.magic = 0u;
+    check_rejected(&request, &tampered, PROVISIONING_RELAY_RSLT_PROTOCOL);
+
+    /* A request echoed back is not a response. */
+    memcpy(&tampered, &response, sizeof(response));
+    tampered.header.type = PROVISIONING_RELAY_MESSAGE_REQUEST;
+    check_rejected(&request, &tampered, PROVISIONING_RELAY_RSLT_PROTOCOL);
+}
+
+
+static void test_replayed_response_is_rejected(void)
+{
+    provisioning_relay_header_t first_request;
+    provisioning_relay_header_t second_request;
+    provisioning_relay_response_t first_response;
+    provisioning_relay_response_t second_response;
+
+    /* A response recorded for one request does not open for another. */
+    exchange(0x40u, 0xC0u, &first_request, &first_response);
+    exchange(0x41u, 0xC0u, &second_request, &second_response);
+
+    check_rejected(&second_request, &first_response, PROVISIONING_RELAY_RSLT_AUTH_FAILED);
+    check_rejected(&first_request, &second_response, PROVISIONING_RELAY_RSLT_AUTH_FAILED);
+
+    /* The same credential is encrypted differently in each exchange. */
+    TEST_CHECK(0 != memcmp(first_response.ciphertext, second_response.ciphertext,
+                           sizeof(first_response.ciphertext)));
+}
+
+
+int main(void)
+{
+    printf("Provisioning relay protocol\n");
+
+    TEST_RUN(test_ccm_matches_rfc3610);
+    TEST_RUN(test_message_layout);
+    TEST_RUN(test_header);
+    TEST_RUN(test_key_derivation);
+    TEST_RUN(test_round_trip);
+    TEST_RUN(test_tampered_response_is_rejected);
+    TEST_RUN(test_bad_header_is_rejected);
+    TEST_RUN(test_replayed_response_is_rejected);
+
+    return (0u == test_failures) ? 0 : 1;
+}
+
+
+/* [] END OF FILE */
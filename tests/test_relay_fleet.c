@@ -0,0 +1,618 @@
+/*******************************************************************************
+* File Name: test_relay_fleet.c
+*
+* Description: Host simulation of the provisioning of a fleet through the
+* provisioning relay. Every device follows the sequence of wps_enrollee_task.c
+* (relay scan, relay request or WPS fallback, connection, relay start) on a
+* simulated clock, and every relay exchange runs the real message framing and
+* encryption of provisioning_relay_protocol.c. The durations of the steps are
+* model assumptions, not measurements; the simulation shows how the fleet-wide
+* time to provisioned and the number of registrar sessions scale with the fleet
+* size and with the interval between the WPS commands.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdbool.h>
+#include <string.h>
+
+#include "provisioning_relay.h"
+#include "test_common.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Step of the simulated clock in milliseconds. */
+#define SIM_TICK_MS                         (10u)
+
+/* Modelled durations in milliseconds. */
+#define SIM_SCAN_MS                         (2500u)     /* Scan for the relay SSID */
+#define SIM_RELAY_JOIN_MS                   (1500u)     /* WPA2 join and DHCP on the relay soft-AP */
+#define SIM_EXCHANGE_MS                     (50u)       /* Request and response over TCP */
+#define SIM_WPS_MS                          (15000u)    /* WPS registration with the registrar */
+#define SIM_AP_CONNECT_MS                   (2500u)     /* Join and DHCP on the AP */
+#define SIM_RELAY_START_MS                  (800u)      /* Start of the soft-AP and of the relay server */
+
+/* Stations admitted by a relay soft-AP at the same time. */
+#define SIM_RELAY_MAX_CLIENTS               (5u)
+
+#define SIM_MAX_DEVICES                     (64u)
+#define SIM_END_MS                          (3600u * 1000u)
+#define SIM_NONE                            (-1)
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef enum
+{
+    SIM_STATE_IDLE,                 /* Waiting for the WPS command */
+    SIM_STATE_SCANNING,             /* Scanning for a relay */
+    SIM_STATE_JOINING,              /* Joining the relay soft-AP */
+    SIM_STATE_WAITING_RELAY,        /* Waiting for the relay server */
+    SIM_STATE_EXCHANGING,           /* Exchanging the request and the response */
+    SIM_STATE_WAITING_REGISTRAR,    /* Waiting for the WPS registrar */
+    SIM_STATE_WPS,                  /* Running WPS */
+    SIM_STATE_CONNECTING,           /* Connecting to the AP */
+    SIM_STATE_STARTING_RELAY,       /* Starting the relay soft-AP */
+    SIM_STATE_PROVISIONED           /* Connected; serving as a relay if enabled */
+} sim_state_t;
+
+typedef struct
+{
+    sim_state_t state;
+    uint32_t    command_ms;
+    uint32_t    until_ms;
+    uint32_t    wait_start_ms;
+    int32_t     relay;
+    uint32_t    provisioned_ms;
+    bool        is_via_relay;
+    provisioning_relay_credential_t credential;
+
+    /* Relay side */
+    uint32_t    relay_up_ms;
+    uint32_t    clients;
+    uint32_t    server_busy_until_ms;
+    provisioning_relay_header_t  request;
+} sim_device_t;
+
+typedef struct
+{
+    uint32_t device_count;
+    uint32_t command_interval_ms;
+    bool     is_relay_enabled;
+
+    /* Devices already provisioned when the first command is given. */
+    uint32_t provisioned_count;
+} sim_scenario_t;
+
+typedef struct
+{
+    bool     is_complete;
+    uint32_t fleet_ms;
+    uint32_t median_ms;
+    uint32_t via_relay;
+    uint32_t registrar_sessions;
+    uint32_t relay_rejections;
+    uint32_t protocol_failures;
+} sim_result_t;
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+uint32_t test_failures = 0;
+
+static sim_device_t devices[SIM_MAX_DEVICES];
+static uint32_t random_state;
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+static uint32_t next_random(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+
+    return random_state;
+}
+
+
+static void fill_nonce(uint8_t *nonce)
+{
+    for (uint32_t index = 0; index < PROVISIONING_RELAY_NONCE_SIZE; index++)
+    {
+        nonce[index] = (uint8_t)next_random();
+    }
+}
+
+
+static void network_credential(provisioning_relay_credential_t *credential)
+{
+    static const cy_wcm_mac_t bssid = { 0x00u, 0x03u, 0x7Fu, 0x0Au, 0x0Bu, 0x0Cu };
+
+    memset(credential, 0, sizeof(provisioning_relay_credential_t));
+    credential->security = (uint32_t)CY_WCM_SECURITY_WPA2_AES_PSK;
+    credential->band = (uint32_t)CY_WCM_WIFI_BAND_2_4GHZ;
+    memcpy(credential->bssid, bssid, sizeof(bssid));
+    memcpy(credential->ssid, "FleetNetwork", sizeof("FleetNetwork"));
+    memcpy(credential->passphrase, "fleet network passphrase", sizeof("fleet network passphrase"));
+}
+
+
+/* Signal strength of a relay as seen by a device, fixed for the pair. */
+static int32_t relay_rssi(uint32_t device, uint32_t relay)
+{
+    return -40 - (int32_t)(((device * 7u) + (relay * 13u)) % 41u);
+}
+
+
+/* Strongest relay whose soft-AP is up at the end of the scan. */
+static int32_t find_relay(uint32_t device, uint32_t count, uint32_t now_ms)
+{
+    int32_t best = SIM_NONE;
+
+    for (uint32_t relay = 0; relay < count; relay++)
+    {
+        if ((relay != device) && (devices[relay].relay_up_ms <= now_ms) &&
+            ((SIM_NONE == best) || (relay_rssi(device, relay) > relay_rssi(device, (uint32_t)best))))
+        {
+            best = (int32_t)relay;
+        }
+    }
+
+    return best;
+}
+
+
+/* Runs the relay exchange between a device and its relay with the real
+ * framing and encryption.
+ */
+static bool run_exchange(sim_device_t *device, sim_device_t *relay)
+{
+    provisioning_relay_response_t response;
+    uint8_t nonce[PROVISIONING_RELAY_NONCE_SIZE];
+
+    fill_nonce(nonce);
+    provisioning_relay_init_header(&device->request, PROVISIONING_RELAY_MESSAGE_REQUEST, nonce);
+
+    if (!provisioning_relay_is_header_valid(&device->request, PROVISIONING_RELAY_MESSAGE_REQUEST))
+    {
+        return false;
+    }
+
+    fill_nonce(nonce);
+    if (CY_RSLT_SUCCESS != provisioning_relay_seal_response(&device->request, nonce, &relay->credential, &response))
+    {
+        return false;
+    }
+
+    return (CY_RSLT_SUCCESS == provisioning_relay_open_response(&device->request, &response, &device->credential));
+}
+
+
+/* Gives a free relay server or the registrar to the device that has waited
+ * the longest for it.
+ */
+static void assign_waiting(uint32_t count, uint32_t now_ms, uint32_t *registrar_busy_until_ms,
+                           sim_result_t *result)
+{
+    for (int32_t server = SIM_NONE; server < (int32_t)count; server++)
+    {
+        bool is_registrar = (SIM_NONE == server);
+        uint32_t busy_until_ms = is_registrar ? *registrar_busy_until_ms :
+                                                devices[server].server_busy_until_ms;
+        sim_state_t waiting_state = is_registrar ? SIM_STATE_WAITING_REGISTRAR : SIM_STATE_WAITING_RELAY;
+        int32_t next = SIM_NONE;
+
+        if (busy_until_ms > now_ms)
+        {
+            continue;
+        }
+
+        for (uint32_t index = 0; index < count; index++)
+        {
+            if ((waiting_state == devices[index].state) && (is_registrar || (server == devices[index].relay)) &&
+                ((SIM_NONE == next) || (devices[index].wait_start_ms < devices[next].wait_start_ms)))
+            {
+                next = (int32_t)index;
+            }
+        }
+
+        if (SIM_NONE == next)
+        {
+            continue;
+        }
+
+        if (is_registrar)
+        {
+            devices[next].state = SIM_STATE_WPS;
+            devices[next].until_ms = now_ms + SIM_WPS_MS;
+            *registrar_busy_until_ms = devices[next].until_ms;
+            result->registrar_sessions++;
+        }
+        else
+        {
+            devices[next].state = SIM_STATE_EXCHANGING;
+            devices[next].until_ms = now_ms + SIM_EXCHANGE_MS;
+            devices[server].server_busy_until_ms = devices[next].until_ms;
+        }
+    }
+}
+
+
+/* Advances one device whose current step has ended. */
+static void step_device(uint32_t index, const sim_scenario_t *scenario, uint32_t now_ms, sim_result_t *result)
+{
+    sim_device_t *device = &devices[index];
+    provisioning_relay_credential_t expected;
+
+    switch (device->state)
+    {
+    case SIM_STATE_IDLE:
+        if (now_ms >= device->command_ms)
+        {
+            if (scenario->is_relay_enabled)
+            {
+                device->state = SIM_STATE_SCANNING;
+                device->until_ms = now_ms + SIM_SCAN_MS;
+            }
+            else
+            {
+                device->state = SIM_STATE_WAITING_REGISTRAR;
+                device->wait_start_ms = now_ms;
+            }
+        }
+        break;
+
+    case SIM_STATE_SCANNING:
+        device->relay = find_relay(index, scenario->device_count, now_ms);
+        if (SIM_NONE == device->relay)
+        {
+            device->state = SIM_STATE_WAITING_REGISTRAR;
+            device->wait_start_ms = now_ms;
+            break;
+        }
+
+        /* A full soft-AP rejects the join, which fails after the same time. */
+        if (devices[device->relay].clients < SIM_RELAY_MAX_CLIENTS)
+        {
+            devices[device->relay].clients++;
+        }
+        else
+        {
+            device->relay = SIM_NONE;
+            result->relay_rejections++;
+        }
+        device->state = SIM_STATE_JOINING;
+        device->until_ms = now_ms + SIM_RELAY_JOIN_MS;
+        break;
+
+    case SIM_STATE_JOINING:
+        device->state = (SIM_NONE == device->relay) ? SIM_STATE_WAITING_REGISTRAR : SIM_STATE_WAITING_RELAY;
+        device->wait_start_ms = now_ms;
+        break;
+
+    case SIM_STATE_WAITING_RELAY:
+        /* The request times out if the server is busy with other devices. */
+        if ((now_ms - device->wait_start_ms) > PROVISIONING_RELAY_TIMEOUT_MSEC)
+        {
+            devices[device->relay].clients--;
+            device->relay = SIM_NONE;
+            device->state = SIM_STATE_WAITING_REGISTRAR;
+            device->wait_start_ms = now_ms;
+            result->relay_rejections++;
+        }
+        break;
+
+    case SIM_STATE_EXCHANGING:
+        devices[device->relay].clients--;
+        if (run_exchange(device, &devices[device->relay]))
+        {
+            device->is_via_relay = true;
+            device->state = SIM_STATE_CONNECTING;
+            device->until_ms = now_ms + SIM_AP_CONNECT_MS;
+        }
+        else
+        {
+            result->protocol_failures++;
+            device->state = SIM_STATE_WAITING_REGISTRAR;
+            device->wait_start_ms = now_ms;
+        }
+        break;
+
+    case SIM_STATE_WPS:
+        network_credential(&device->credential);
+        device->state = SIM_STATE_CONNECTING;
+        device->until_ms = now_ms + SIM_AP_CONNECT_MS;
+        break;
+
+    case SIM_STATE_CONNECTING:
+        /* Only a device that received the credential of the network can
+         * connect.
+         */
+        network_credential(&expected);
+        if (0 != memcmp(&expected, &device->credential, sizeof(expected)))
+        {
+            result->protocol_failures++;
+        }
+        device->provisioned_ms = now_ms;
+        device->state = scenario->is_relay_enabled ? SIM_STATE_STARTING_RELAY : SIM_STATE_PROVISIONED;
+        device->until_ms = now_ms + SIM_RELAY_START_MS;
+        break;
+
+    case SIM_STATE_STARTING_RELAY:
+        device->relay_up_ms = now_ms;
+        device->state = SIM_STATE_PROVISIONED;
+        break;
+
+    default:
+        break;
+    }
+}
+
+
+static void run_scenario(const sim_scenario_t *scenario, sim_result_t *result)
+{
+    uint32_t registrar_busy_until_ms = 0;
+    uint32_t durations[SIM_MAX_DEVICES];
+    uint32_t remaining;
+    uint32_t now_ms;
+
+    memset(result, 0, sizeof(sim_result_t));
+    memset(devices, 0, sizeof(devices));
+    random_state = 0x2545F491u;
+
+    for (uint32_t index = 0; index < scenario->device_count; index++)
+    {
+        devices[index].state = SIM_STATE_IDLE;
+        devices[index].relay = SIM_NONE;
+        devices[index].relay_up_ms = UINT32_MAX;
+        devices[index].command_ms = (index - ((index < scenario->provisioned_count) ? index :
+                                                                                       scenario->provisioned_count)) *
+                                    scenario->command_interval_ms;
+
+        /* Devices provisioned before the simulation already run a relay. */
+        if (index < scenario->provisioned_count)
+        {
+            network_credential(&devices[index].credential);
+            devices[index].state = SIM_STATE_PROVISIONED;
+            devices[index].relay_up_ms = 0;
+        }
+    }
+
+    for (now_ms = 0; now_ms < SIM_END_MS; now_ms += SIM_TICK_MS)
+    {
+        remaining = 0;
+        for (uint32_t index = 0; index < scenario->device_count; index++)
+        {
+            if ((SIM_STATE_PROVISIONED != devices[index].state) && (devices[index].until_ms <= now_ms))
+            {
+                step_device(index, scenario, now_ms, result);
+            }
+
+            if (SIM_STATE_PROVISIONED != devices[index].state)
+            {
+                remaining++;
+            }
+        }
+
+        assign_waiting(scenario->device_count, now_ms, &registrar_busy_until_ms, result);
+
+        if (0u == remaining)
+        {
+            break;
+        }
+    }
+
+    result->is_complete = (now_ms < SIM_END_MS);
+
+    /* Fleet-wide and median time to provisioned of the devices commanded. */
+    for (uint32_t index = scenario->provisioned_count; index < scenario->device_count; index++)
+    {
+        uint32_t duration = devices[index].provisioned_ms - devices[index].command_ms;
+        uint32_t position = index - scenario->provisioned_count;
+
+        if (devices[index].provisioned_ms > result->fleet_ms)
+        {
+            result->fleet_ms = devices[index].provisioned_ms;
+        }
+        if (devices[index].is_via_relay)
+        {
+            result->via_relay++;
+        }
+
+        /* Insertion sort of the durations. */
+        while ((position > 0u) && (durations[position - 1u] > duration))
+        {
+            durations[position] = durations[position - 1u];
+            position--;
+        }
+        durations[position] = duration;
+    }
+    result->median_ms = durations[(scenario->device_count - scenario->provisioned_count) / 2u];
+}
+
+
+static void print_result(const char *name, const sim_scenario_t *scenario, const sim_result_t *result)
+{
+    printf("    %-10s %2lu devices, %5lu ms apart: fleet %7.1f s, median %6.1f s, "
+           "%2lu by relay, %2lu registrar sessions, %lu relay rejections\n",
+           name, (unsigned long)scenario->device_count, (unsigned long)scenario->command_interval_ms,
+           result->fleet_ms / 1000.0, result->median_ms / 1000.0, (unsigned long)result->via_relay,
+           (unsigned long)result->registrar_sessions, (unsigned long)result->relay_rejections);
+}
+
+
+/* Runs the scenario with and without the relay and checks the invariants of
+ * both runs.
+ */
+static void run_pair(uint32_t device_count, uint32_t command_interval_ms, sim_result_t *relay,
+                     sim_result_t *wps_only)
+{
+    sim_scenario_t scenario = { device_count, command_interval_ms, true, 0u };
+
+    run_scenario(&scenario, relay);
+    print_result("relay", &scenario, relay);
+
+    scenario.is_relay_enabled = false;
+    run_scenario(&scenario, wps_only);
+    print_result("WPS only", &scenario, wps_only);
+
+    TEST_CHECK(relay->is_complete);
+    TEST_CHECK(wps_only->is_complete);
+    TEST_CHECK_EQUAL(0u, relay->protocol_failures);
+    TEST_CHECK_EQUAL(0u, wps_only->protocol_failures);
+    TEST_CHECK_EQUAL(device_count, relay->via_relay + relay->registrar_sessions);
+    TEST_CHECK_EQUAL(device_count, wps_only->registrar_sessions);
+}
+
+
+static void test_single_device(void)
+{
+    sim_result_t relay;
+    sim_result_t wps_only;
+
+    run_pair(1u, 0u, &relay, &wps_only);
+
+    /* Looking for a relay costs one scan when there is none. */
+    TEST_CHECK_EQUAL(SIM_SCAN_MS + SIM_WPS_MS + SIM_AP_CONNECT_MS, relay.fleet_ms);
+    TEST_CHECK_EQUAL(SIM_WPS_MS + SIM_AP_CONNECT_MS, wps_only.fleet_ms);
+}
+
+
+static void test_registrar_sessions_do_not_grow_with_fleet(void)
+{
+    static const uint32_t fleet_sizes[] = { 8u, 16u, 32u, 64u };
+    sim_result_t relay;
+    sim_result_t wps_only;
+    uint32_t first_sessions = 0;
+
+    for (uint32_t size = 0; size < (sizeof(fleet_sizes) / sizeof(fleet_sizes[0])); size++)
+    {
+        run_pair(fleet_sizes[size], 5000u, &relay, &wps_only);
+
+        /* Only the devices commanded before the first relay is up use WPS. */
+        if (0u == size)
+        {
+            first_sessions = relay.registrar_sessions;
+        }
+        TEST_CHECK_EQUAL(first_sessions, relay.registrar_sessions);
+        TEST_CHECK(relay.fleet_ms < wps_only.fleet_ms);
+        TEST_CHECK(relay.median_ms < wps_only.median_ms);
+    }
+
+    /* The relay was up (SCAN + WPS + CONNECT + START) ms after the first
+     * command; the devices whose scan ended before that used WPS.
+     */
+    TEST_CHECK_EQUAL(1u + ((SIM_WPS_MS + SIM_AP_CONNECT_MS + SIM_RELAY_START_MS - 1u) / 5000u), first_sessions);
+}
+
+
+static void test_simultaneous_commands_all_use_wps(void)
+{
+    sim_result_t relay;
+    sim_result_t wps_only;
+
+    /* No relay is up when the devices scan, so each of them needs its own
+     * registrar session; the relay only adds the scan.
+     */
+    run_pair(16u, 0u, &relay, &wps_only);
+    TEST_CHECK_EQUAL(16u, relay.registrar_sessions);
+    TEST_CHECK_EQUAL(wps_only.fleet_ms + SIM_SCAN_MS, relay.fleet_ms);
+}
+
+
+static void test_burst_beyond_relay_capacity(void)
+{
+    sim_scenario_t scenario = { SIM_MAX_DEVICES, 0u, true, 1u };
+    sim_result_t result;
+
+    /* One relay is up and all the other devices are commanded at once: the
+     * soft-AP admits SIM_RELAY_MAX_CLIENTS of them and the others fall back
+     * to WPS; the relays started by the first ones do not help the devices
+     * that have already fallen back.
+     */
+    run_scenario(&scenario, &result);
+    print_result("burst", &scenario, &result);
+
+    TEST_CHECK(result.is_complete);
+    TEST_CHECK_EQUAL(0u, result.protocol_failures);
+    TEST_CHECK_EQUAL(SIM_RELAY_MAX_CLIENTS, result.via_relay);
+    TEST_CHECK_EQUAL(SIM_MAX_DEVICES - 1u - SIM_RELAY_MAX_CLIENTS, result.relay_rejections);
+    TEST_CHECK_EQUAL(SIM_MAX_DEVICES - 1u - SIM_RELAY_MAX_CLIENTS, result.registrar_sessions);
+}
+
+
+static void test_staggered_commands_after_first_relay(void)
+{
+    sim_scenario_t scenario = { SIM_MAX_DEVICES, 1000u, true, 1u };
+    sim_result_t result;
+
+    /* With one relay up and a command every second, the relays multiply
+     * faster than the devices arrive and no registrar session is needed.
+     */
+    run_scenario(&scenario, &result);
+    print_result("staggered", &scenario, &result);
+
+    TEST_CHECK(result.is_complete);
+    TEST_CHECK_EQUAL(0u, result.protocol_failures);
+    TEST_CHECK_EQUAL(SIM_MAX_DEVICES - 1u, result.via_relay);
+    TEST_CHECK_EQUAL(0u, result.registrar_sessions);
+    TEST_CHECK_EQUAL(SIM_SCAN_MS + SIM_RELAY_JOIN_MS + SIM_EXCHANGE_MS + SIM_AP_CONNECT_MS, result.median_ms);
+}
+
+
+int main(void)
+{
+    printf("Provisioning relay fleet simulation\n");
+
+    TEST_RUN(test_single_device);
+    TEST_RUN(test_registrar_sessions_do_not_grow_with_fleet);
+    TEST_RUN(test_simultaneous_commands_all_use_wps);
+    TEST_RUN(test_burst_beyond_relay_capacity);
+    TEST_RUN(test_staggered_commands_after_first_relay);
+
+    return (0u == test_failures) ? 0 : 1;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,482 @@
+/*******************************************************************************
+* File Name: test_trace_to_chrome.c
+*
+* Description: Unit tests of the host converter of the trace recorder dump in
+* tools/trace_to_chrome.c. Synthetic dumps are written in the format of
+* trace_recorder_dump(), mixed with other console output as the other tasks
+* would print it, and the converted trace is checked with a JSON parser and
+* against the expected slices and events.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "trace_recorder.h"
+#include "tools/trace_to_chrome.h"
+#include "test_common.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define TEST_CYCLES_PER_US                  (100u)
+
+#define TEST_TASK_ENROLLEE                  (0x08001000uL)
+#define TEST_TASK_TIMER                     (0x08002000uL)
+#define TEST_QUEUE                          (0x08003000uL)
+#define TEST_ISR_NAME                       (0x10000100uL)
+#define TEST_SPAN_NAME                      (0x10000200uL)
+
+#define TEST_EVENT_COUNT                    (9u)
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef struct
+{
+    uint32_t      timestamp;
+    unsigned long object;
+    uint32_t      arg;
+    trace_event_t event;
+} test_event_t;
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+uint32_t test_failures = 0;
+
+/* The enrollee task runs, starts a span and sends to a queue; the timer task
+ * runs and inherits the priority of the enrollee; the enrollee runs again
+ * through an interrupt and ends the span.
+ */
+static const test_event_t trace_events[TEST_EVENT_COUNT] =
+{
+    { 0u,     TEST_TASK_ENROLLEE, 3u, TRACE_EVENT_TASK_SWITCHED_IN },
+    { 1000u,  TEST_SPAN_NAME,     0u, TRACE_EVENT_SPAN_BEGIN },
+    { 2000u,  TEST_QUEUE,         0u, TRACE_EVENT_QUEUE_SEND },
+    { 5000u,  TEST_TASK_TIMER,    2u, TRACE_EVENT_TASK_SWITCHED_IN },
+    { 6000u,  TEST_TASK_TIMER,    3u, TRACE_EVENT_PRIORITY_INHERIT },
+    { 8000u,  TEST_TASK_ENROLLEE, 3u, TRACE_EVENT_TASK_SWITCHED_IN },
+    { 9000u,  TEST_ISR_NAME,      0u, TRACE_EVENT_ISR_ENTER },
+    { 9500u,  TEST_ISR_NAME,      0u, TRACE_EVENT_ISR_EXIT },
+    { 10000u, TEST_SPAN_NAME,     0u, TRACE_EVENT_SPAN_END },
+};
+
+static char *log_text;
+static size_t log_size;
+static FILE *log_file;
+
+static char *json_text;
+static size_t json_size;
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+/* Formats a line of the dump as trace_recorder_dump() does, with the prefix
+ * and the checksum, between the given texts of other output.
+ */
+static void dump_line(const char *before, const char *inside, const char *format, ...)
+{
+    char fields[128];
+    uint8_t checksum = 0;
+    size_t split;
+    va_list args;
+
+    va_start(args, format);
+    vsnprintf(fields, sizeof(fields), format, args);
+    va_end(args);
+
+    for (size_t index = 0; '\0' != fields[index]; index++)
+    {
+        checksum ^= (uint8_t)fields[index];
+    }
+
+    /* Other output printed in the middle of the line. */
+    split = strlen(fields) / 2u;
+    fprintf(log_file, "%s%s%.*s%s%s*%02X\n", before, TRACE_RECORDER_DUMP_PREFIX, (int)split, fields, inside,
+            &fields[split], (unsigned int)checksum);
+}
+
+
+static void open_log(void)
+{
+    log_file = open_memstream(&log_text, &log_size);
+}
+
+
+static void write_dump(const test_event_t *trace, uint32_t count, uint32_t corrupted_event, bool is_complete)
+{
+    dump_line("", "", "H %lu %lu %lu %lu", (unsigned long)TRACE_RECORDER_DUMP_VERSION,
+              (unsigned long)TEST_CYCLES_PER_US, (unsigned long)count, 7ul);
+    fprintf(log_file, "Info: Connected to AP.\n");
+    dump_line("", "", "T %08lx %lu %s", TEST_TASK_ENROLLEE, 3ul, "WPS enrollee");
+    dump_line("", "", "T %08lx %lu %s", TEST_TASK_TIMER, 2ul, "Tmr Svc");
+    dump_line("", "", "N %08lx %s", TEST_SPAN_NAME, "cy_wcm_wps_enrollee");
+    dump_line("", "", "N %08lx %s", TEST_QUEUE, "Command queue");
+    dump_line("Error: Failed to ", "", "N %08lx %s", TEST_ISR_NAME, "gpio_interrupt_handler");
+
+    for (uint32_t index = 0; index < count; index++)
+    {
+        dump_line("", (index == corrupted_event) ? "Info: IP address changed.\n" : "",
+                  "E %lu %08lx %08lx %lu %u", (unsigned long)index, (unsigned long)trace[index].timestamp,
+                  trace[index].object, (unsigned long)trace[index].arg, (unsigned int)trace[index].event);
+    }
+
+    if (is_complete)
+    {
+        dump_line("", "", "Z %lu", (unsigned long)count);
+    }
+    fprintf(log_file, "> ");
+}
+
+
+static int convert(trace_to_chrome_stats_t *stats)
+{
+    FILE *input;
+    FILE *output;
+    int result;
+
+    fclose(log_file);
+    input = fmemopen(log_text, log_size, "r");
+    output = open_memstream(&json_text, &json_size);
+
+    result = trace_to_chrome_convert(input, output, stats);
+
+    fclose(input);
+    fclose(output);
+    free(log_text);
+
+    return result;
+}
+
+
+/* Minimal JSON parser, enough to check that the output is well formed. */
+static const char *parse_value(const char *text, uint32_t depth);
+
+static const char *skip_space(const char *text)
+{
+    while ((' ' == *text) || ('\n' == *text) || ('\r' == *text) || ('\t' == *text))
+    {
+        text++;
+    }
+
+    return text;
+}
+
+
+static const char *parse_string(const char *text)
+{
+    if ('"' != *text++)
+    {
+        return NULL;
+    }
+
+    while ('"' != *text)
+    {
+        if (('\0' == *text) || ((uint8_t)*text < 0x20u))
+        {
+            return NULL;
+        }
+        if ('\\' == *text)
+        {
+            text++;
+            if ('u' == *text)
+            {
+                text += 4;
+            }
+            else if (NULL == strchr("\"\\/bfnrt", *text))
+            {
+                return NULL;
+            }
+        }
+        text++;
+    }
+
+    return text + 1;
+}
+
+
+static const char *parse_list(const char *text, char close, bool is_object, uint32_t depth)
+{
+    text = skip_space(text + 1);
+    if (close == *text)
+    {
+        return text + 1;
+    }
+
+    while (NULL != text)
+    {
+        if (is_object)
+        {
+            text = parse_string(skip_space(text));
+            if ((NULL == text) || (':' != *(text = skip_space(text))))
+            {
+                return NULL;
+            }
+            text++;
+        }
+
+        if (NULL == (text = parse_value(text, depth + 1u)))
+        {
+            return NULL;
+        }
+
+        text = skip_space(text);
+        if (close == *text)
+        {
+            return text + 1;
+        }
+        text = (',' == *text) ? (text + 1) : NULL;
+    }
+
+    return NULL;
+}
+
+
+static const char *parse_value(const char *text, uint32_t depth)
+{
+    text = skip_space(text);
+
+    if (depth > 16u)
+    {
+        return NULL;
+    }
+
+    switch (*text)
+    {
+        case '{':
+            return parse_list(text, '}', true, depth);
+        case '[':
+            return parse_list(text, ']', false, depth);
+        case '"':
+            return parse_string(text);
+        default:
+            if (('-' == *text) || (('0' <= *text) && (*text <= '9')))
+            {
+                char *end;
+                (void)strtod(text, &end);
+                return end;
+            }
+            return NULL;
+    }
+}
+
+
+static bool is_valid_json(const char *text)
+{
+    const char *end = parse_value(text, 0u);
+
+    return (NULL != end) && ('\0' == *skip_space(end));
+}
+
+
+static bool contains(const char *fragment)
+{
+    return (NULL != json_text) && (NULL != strstr(json_text, fragment));
+}
+
+
+static void test_complete_dump(void)
+{
+    trace_to_chrome_stats_t stats;
+
+    open_log();
+    write_dump(trace_events, TEST_EVENT_COUNT, UINT32_MAX, true);
+    TEST_CHECK_EQUAL(0, convert(&stats));
+
+    TEST_CHECK(is_valid_json(json_text));
+    TEST_CHECK(stats.is_complete);
+    TEST_CHECK_EQUAL(TEST_EVENT_COUNT, stats.events);
+    TEST_CHECK_EQUAL(0u, stats.missing_events);
+    TEST_CHECK_EQUAL(0u, stats.corrupted_lines);
+    TEST_CHECK_EQUAL(7u, stats.overwritten_events);
+
+    TEST_CHECK(contains("\"args\":{\"name\":\"WPS enrollee (priority 3)\"}"));
+    TEST_CHECK(contains("{\"ph\":\"X\",\"name\":\"WPS enrollee\",\"ts\":0,\"pid\":1,\"tid\":1,"
+                        "\"dur\":50,\"args\":{\"priority\":3}}"));
+    TEST_CHECK(contains("{\"ph\":\"B\",\"name\":\"cy_wcm_wps_enrollee\",\"ts\":10,\"pid\":1,\"tid\":101,"));
+    TEST_CHECK(contains("{\"ph\":\"i\",\"name\":\"queue send\",\"ts\":20,\"pid\":1,\"tid\":1,"
+                        "\"s\":\"t\",\"args\":{\"queue\":\"Command queue\"}}"));
+
+    /* The inherited priority splits the slice of the timer task. */
+    TEST_CHECK(contains("{\"ph\":\"X\",\"name\":\"Tmr Svc\",\"ts\":50,\"pid\":1,\"tid\":2,"
+                        "\"dur\":10,\"args\":{\"priority\":2}}"));
+    TEST_CHECK(contains("{\"ph\":\"X\",\"name\":\"Tmr Svc\",\"ts\":60,\"pid\":1,\"tid\":2,"
+                        "\"dur\":20,\"args\":{\"priority\":3}}"));
+    TEST_CHECK(contains("{\"ph\":\"B\",\"name\":\"gpio_interrupt_handler\",\"ts\":90,\"pid\":1,\"tid\":0,"));
+    TEST_CHECK(contains("{\"ph\":\"E\",\"name\":\"cy_wcm_wps_enrollee\",\"ts\":100,\"pid\":1,\"tid\":101,"));
+
+    free(json_text);
+}
+
+
+static void test_line_mixed_with_output_is_dropped(void)
+{
+    trace_to_chrome_stats_t stats;
+
+    /* Another task prints in the middle of the first switch to the timer
+     * task.
+     */
+    open_log();
+    write_dump(trace_events, TEST_EVENT_COUNT, 3u, true);
+    TEST_CHECK_EQUAL(0, convert(&stats));
+
+    TEST_CHECK(is_valid_json(json_text));
+    TEST_CHECK(stats.is_complete);
+    TEST_CHECK_EQUAL(TEST_EVENT_COUNT - 1u, stats.events);
+    TEST_CHECK_EQUAL(1u, stats.missing_events);
+    TEST_CHECK_EQUAL(1u, stats.corrupted_lines);
+
+    /* The enrollee slice runs on to the next switch. */
+    TEST_CHECK(contains("{\"ph\":\"X\",\"name\":\"WPS enrollee\",\"ts\":0,\"pid\":1,\"tid\":1,"
+                        "\"dur\":80,\"args\":{\"priority\":3}}"));
+
+    free(json_text);
+}
+
+
+static void test_incomplete_dump(void)
+{
+    trace_to_chrome_stats_t stats;
+
+    /* The log ends before the last events and the end line. */
+    open_log();
+    write_dump(trace_events, TEST_EVENT_COUNT - 3u, UINT32_MAX, false);
+    TEST_CHECK_EQUAL(0, convert(&stats));
+
+    TEST_CHECK(is_valid_json(json_text));
+    TEST_CHECK(!stats.is_complete);
+    TEST_CHECK_EQUAL(TEST_EVENT_COUNT - 3u, stats.events);
+
+    free(json_text);
+}
+
+
+static void test_cycle_counter_wrap(void)
+{
+    static const test_event_t wrapping[2] =
+    {
+        { 0xFFFFFF00u, TEST_TASK_ENROLLEE, 3u, TRACE_EVENT_TASK_SWITCHED_IN },
+        { 0x00000100u, TEST_TASK_TIMER,    2u, TRACE_EVENT_TASK_SWITCHED_IN },
+    };
+    trace_to_chrome_stats_t stats;
+
+    open_log();
+    write_dump(wrapping, 2u, UINT32_MAX, true);
+    TEST_CHECK_EQUAL(0, convert(&stats));
+
+    /* 512 cycles at 100 cycles per microsecond */
+    TEST_CHECK(is_valid_json(json_text));
+    TEST_CHECK(contains("{\"ph\":\"X\",\"name\":\"WPS enrollee\",\"ts\":0,\"pid\":1,\"tid\":1,"
+                        "\"dur\":5,\"args\":{\"priority\":3}}"));
+
+    free(json_text);
+}
+
+
+static void test_last_dump_is_converted(void)
+{
+    trace_to_chrome_stats_t stats;
+
+    open_log();
+    write_dump(trace_events, TEST_EVENT_COUNT, 2u, true);
+    write_dump(trace_events, 2u, UINT32_MAX, true);
+    TEST_CHECK_EQUAL(0, convert(&stats));
+
+    TEST_CHECK(is_valid_json(json_text));
+    TEST_CHECK_EQUAL(2u, stats.events);
+    TEST_CHECK_EQUAL(0u, stats.corrupted_lines);
+
+    free(json_text);
+}
+
+
+static void test_names_are_escaped(void)
+{
+    trace_to_chrome_stats_t stats;
+
+    open_log();
+    dump_line("", "", "H %lu %lu %lu %lu", (unsigned long)TRACE_RECORDER_DUMP_VERSION,
+              (unsigned long)TEST_CYCLES_PER_US, 1ul, 0ul);
+    dump_line("", "", "T %08lx %lu %s", TEST_TASK_ENROLLEE, 3ul, "Say \"hi\\\"");
+    dump_line("", "", "E 0 00000000 %08lx 3 %u", TEST_TASK_ENROLLEE, (unsigned int)TRACE_EVENT_TASK_SWITCHED_IN);
+    dump_line("", "", "Z 1");
+    TEST_CHECK_EQUAL(0, convert(&stats));
+
+    TEST_CHECK(is_valid_json(json_text));
+    TEST_CHECK(contains("\"name\":\"Say \\\"hi\\\\\\\"\""));
+
+    free(json_text);
+}
+
+
+static void test_log_without_dump(void)
+{
+    trace_to_chrome_stats_t stats;
+
+    open_log();
+    fprintf(log_file, "Info: Connected to AP.\nTRC E 0 00000000 00000000 0 1*00\n");
+    TEST_CHECK_EQUAL(-1, convert(&stats));
+    free(json_text);
+}
+
+
+int main(void)
+{
+    printf("Trace dump converter\n");
+
+    TEST_RUN(test_complete_dump);
+    TEST_RUN(test_line_mixed_with_output_is_dropped);
+    TEST_RUN(test_incomplete_dump);
+    TEST_RUN(test_cycle_counter_wrap);
+    TEST_RUN(test_last_dump_is_converted);
+    TEST_RUN(test_names_are_escaped);
+    TEST_RUN(test_log_without_dump);
+
+    return (0u == test_failures) ? 0 : 1;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,233 @@
+/*******************************************************************************
+* File Name: test_wps_prescan_select.c
+*
+* Description: Host unit tests of the WPS registrar selection
+* (wps_prescan_select.c): expiry of the cache entries, PBC session overlap,
+* and the choice between PIN and push button in race mode.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+#include "wps_prescan.h"
+#include "test_common.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define TEST_ENTRY_COUNT                    (4u)
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+uint32_t test_failures = 0;
+
+static const cy_wcm_wps_mode_t pin_mode[] = { CY_WCM_WPS_PIN_MODE };
+static const cy_wcm_wps_mode_t pbc_mode[] = { CY_WCM_WPS_PBC_MODE };
+static const cy_wcm_wps_mode_t race_modes[] = { CY_WCM_WPS_PIN_MODE, CY_WCM_WPS_PBC_MODE };
+
+static wps_prescan_registrar_t entries[TEST_ENTRY_COUNT];
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/* Fills a cache entry. The last byte of the BSSID identifies the entry. */
+static void set_entry(uint32_t index, const char *ssid, uint16_t device_password_id, int16_t signal_strength,
+                      uint32_t first_seen_ms, uint32_t last_seen_ms)
+{
+    memset(&entries[index], 0, sizeof(entries[index]));
+    strncpy((char *)entries[index].ssid, ssid, sizeof(entries[index].ssid) - 1u);
+    entries[index].bssid[5] = (uint8_t)index;
+    entries[index].device_password_id = device_password_id;
+    entries[index].signal_strength = signal_strength;
+    entries[index].first_seen_ms = first_seen_ms;
+    entries[index].last_seen_ms = last_seen_ms;
+}
+
+
+static cy_rslt_t select_registrar(const cy_wcm_wps_mode_t *modes, uint32_t mode_count, uint32_t entry_count,
+                                  uint32_t now_ms, wps_prescan_registrar_t *registrar)
+{
+    return wps_prescan_select_registrar(entries, entry_count, modes, mode_count, now_ms, registrar);
+}
+
+
+static void test_empty_cache_times_out(void)
+{
+    wps_prescan_registrar_t registrar;
+
+    TEST_CHECK_EQUAL(WPS_PRESCAN_RSLT_TIMEOUT, select_registrar(race_modes, 2u, 0u, 1000u, &registrar));
+}
+
+
+static void test_expired_entry_is_ignored(void)
+{
+    wps_prescan_registrar_t registrar;
+
+    set_entry(0u, "home", WPS_DEVICE_PASSWORD_ID_PIN, -50, 0u, 1000u);
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS,
+                     select_registrar(pin_mode, 1u, 1u, 1000u + WPS_PRESCAN_CACHE_TTL_MSEC - 1u, &registrar));
+    TEST_CHECK_EQUAL(WPS_PRESCAN_RSLT_TIMEOUT,
+                     select_registrar(pin_mode, 1u, 1u, 1000u + WPS_PRESCAN_CACHE_TTL_MSEC, &registrar));
+}
+
+
+static void test_mode_must_match(void)
+{
+    wps_prescan_registrar_t registrar;
+
+    set_entry(0u, "home", WPS_DEVICE_PASSWORD_ID_PBC, -50, 100u, 100u);
+
+    TEST_CHECK_EQUAL(WPS_PRESCAN_RSLT_TIMEOUT, select_registrar(pin_mode, 1u, 1u, 200u, &registrar));
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, select_registrar(pbc_mode, 1u, 1u, 200u, &registrar));
+}
+
+
+static void test_strongest_ap_of_network(void)
+{
+    wps_prescan_registrar_t registrar;
+
+    /* Same network advertised on both bands: not an overlap. */
+    set_entry(0u, "home", WPS_DEVICE_PASSWORD_ID_PBC, -70, 100u, 100u);
+    set_entry(1u, "home", WPS_DEVICE_PASSWORD_ID_PBC, -40, 100u, 100u);
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, select_registrar(pbc_mode, 1u, 2u, 200u, &registrar));
+    TEST_CHECK_EQUAL(1u, registrar.bssid[5]);
+}
+
+
+static void test_pbc_overlap(void)
+{
+    wps_prescan_registrar_t registrar;
+
+    set_entry(0u, "home", WPS_DEVICE_PASSWORD_ID_PBC, -50, 100u, 100u);
+    set_entry(1u, "neighbour", WPS_DEVICE_PASSWORD_ID_PBC, -60, 100u, 100u);
+
+    TEST_CHECK_EQUAL(WPS_PRESCAN_RSLT_PBC_OVERLAP, select_registrar(pbc_mode, 1u, 2u, 200u, &registrar));
+    TEST_CHECK_EQUAL(WPS_PRESCAN_RSLT_PBC_OVERLAP, select_registrar(race_modes, 2u, 2u, 200u, &registrar));
+
+    /* A PIN registrar is still selected while PBC overlaps. */
+    set_entry(2u, "office", WPS_DEVICE_PASSWORD_ID_PIN, -80, 150u, 150u);
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, select_registrar(race_modes, 2u, 3u, 200u, &registrar));
+    TEST_CHECK_EQUAL(WPS_DEVICE_PASSWORD_ID_PIN, registrar.device_password_id);
+}
+
+
+static void test_race_pbc_first_wins(void)
+{
+    wps_prescan_registrar_t registrar;
+
+    /* Push button pressed on one AP, then the PIN entered on another. */
+    set_entry(0u, "home", WPS_DEVICE_PASSWORD_ID_PBC, -70, 1000u, 3000u);
+    set_entry(1u, "office", WPS_DEVICE_PASSWORD_ID_PIN, -40, 2500u, 3000u);
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, select_registrar(race_modes, 2u, 2u, 3000u, &registrar));
+    TEST_CHECK_EQUAL(WPS_DEVICE_PASSWORD_ID_PBC, registrar.device_password_id);
+    TEST_CHECK_EQUAL(0u, registrar.bssid[5]);
+}
+
+
+static void test_race_pin_first_wins(void)
+{
+    wps_prescan_registrar_t registrar;
+
+    set_entry(0u, "home", WPS_DEVICE_PASSWORD_ID_PBC, -40, 2500u, 3000u);
+    set_entry(1u, "office", WPS_DEVICE_PASSWORD_ID_PIN, -70, 1000u, 3000u);
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, select_registrar(race_modes, 2u, 2u, 3000u, &registrar));
+    TEST_CHECK_EQUAL(WPS_DEVICE_PASSWORD_ID_PIN, registrar.device_password_id);
+}
+
+
+static void test_race_same_scan_prefers_first_mode(void)
+{
+    wps_prescan_registrar_t registrar;
+    static const cy_wcm_wps_mode_t pbc_first[] = { CY_WCM_WPS_PBC_MODE, CY_WCM_WPS_PIN_MODE };
+
+    /* Both first seen in the scan started at 2000 ms, which reported the
+     * PBC registrar first.
+     */
+    set_entry(0u, "home", WPS_DEVICE_PASSWORD_ID_PBC, -40, 2000u, 2150u);
+    set_entry(1u, "office", WPS_DEVICE_PASSWORD_ID_PIN, -70, 2000u, 2900u);
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, select_registrar(race_modes, 2u, 2u, 3000u, &registrar));
+    TEST_CHECK_EQUAL(WPS_DEVICE_PASSWORD_ID_PIN, registrar.device_password_id);
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, select_registrar(pbc_first, 2u, 2u, 3000u, &registrar));
+    TEST_CHECK_EQUAL(WPS_DEVICE_PASSWORD_ID_PBC, registrar.device_password_id);
+}
+
+
+static void test_race_across_clock_wrap(void)
+{
+    wps_prescan_registrar_t registrar;
+
+    /* PBC first seen just before the millisecond clock wraps, PIN after. */
+    set_entry(0u, "home", WPS_DEVICE_PASSWORD_ID_PBC, -70, 0xFFFFFF00u, 200u);
+    set_entry(1u, "office", WPS_DEVICE_PASSWORD_ID_PIN, -40, 100u, 200u);
+
+    TEST_CHECK_EQUAL(CY_RSLT_SUCCESS, select_registrar(race_modes, 2u, 2u, 300u, &registrar));
+    TEST_CHECK_EQUAL(WPS_DEVICE_PASSWORD_ID_PBC, registrar.device_password_id);
+}
+
+
+int main(void)
+{
+    printf("WPS registrar selection\n");
+
+    TEST_RUN(test_empty_cache_times_out);
+    TEST_RUN(test_expired_entry_is_ignored);
+    TEST_RUN(test_mode_must_match);
+    TEST_RUN(test_strongest_ap_of_network);
+    TEST_RUN(test_pbc_overlap);
+    TEST_RUN(test_race_pbc_first_wins);
+    TEST_RUN(test_race_pin_first_wins);
+    TEST_RUN(test_race_same_scan_prefers_first_mode);
+    TEST_RUN(test_race_across_clock_wrap);
+
+    return (0u == test_failures) ? 0 : 1;
+}
+
+
+/* [] END OF FILE */
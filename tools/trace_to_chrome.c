@@ -0,0 +1,717 @@
+/*******************************************************************************
+* File Name: trace_to_chrome.c
+*
+* Description: This file contains the host converter of the dump printed by
+* trace_recorder_dump() to Chrome trace JSON, which can be opened in Perfetto
+* or chrome://tracing. The dump is found among the other console output, and
+* the lines that the other output was mixed with are dropped.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "trace_recorder.h"
+#include "trace_to_chrome.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Track of the interrupt service routines in the exported trace. */
+#define TRACE_TID_INTERRUPTS                (0u)
+
+/* Track of the events of unknown tasks. Task i is on track i + 1. */
+#define TRACE_TID_OTHER_TASKS               (TRACE_RECORDER_MAX_TASKS + 1u)
+
+/* The spans of task i are on their own track, so that they may cross the
+ * context switches of the task.
+ */
+#define TRACE_TID_SPAN_OFFSET               (100u)
+
+#define CONVERTER_LINE_LENGTH               (512u)
+#define CONVERTER_NAME_LENGTH               (64u)
+#define CONVERTER_MAX_NAMES                 (256u)
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef struct
+{
+    uint64_t handle;
+    uint32_t base_priority;
+    char     name[CONVERTER_NAME_LENGTH];
+} converter_task_t;
+
+typedef struct
+{
+    uint64_t object;
+    char     name[CONVERTER_NAME_LENGTH];
+} converter_name_t;
+
+typedef struct
+{
+    uint32_t timestamp;
+    uint64_t object;
+    uint32_t arg;
+    uint32_t event;
+    bool     is_present;
+} converter_event_t;
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static converter_task_t tasks[TRACE_RECORDER_MAX_TASKS];
+static uint32_t task_count;
+static converter_name_t names[CONVERTER_MAX_NAMES];
+static uint32_t name_count;
+static converter_event_t *events;
+static uint32_t event_count;
+static uint32_t cycles_per_us;
+
+/* True until the export has printed its first JSON event. */
+static bool is_first_json_event;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static bool read_dump_line(char **payload);
+static bool parse_dump_line(char *payload, trace_to_chrome_stats_t *stats);
+static void copy_name(char *name, const char *text);
+static const char *find_name(uint64_t object, char *fallback, size_t fallback_size);
+static uint32_t find_task_tid(uint64_t handle);
+static void write_json(FILE *output);
+static void write_string(FILE *output, const char *text);
+static void write_event_header(FILE *output, const char *phase, const char *name, uint32_t timestamp_us,
+                               uint32_t tid);
+static void write_queue_event(FILE *output, const char *name, uint64_t queue, uint32_t timestamp_us,
+                              uint32_t tid);
+static void write_task_slice(FILE *output, uint32_t tid, uint32_t start_us, uint32_t end_us, uint32_t priority);
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: trace_to_chrome_convert
+ *******************************************************************************
+ * Summary: Reads a console log, finds the last trace dump in it, and writes the
+ * dump as Chrome trace JSON. The lines without the dump prefix are skipped.
+ * A line of the dump with a wrong checksum, because other output was printed
+ * in the middle of it, is dropped and counted; the events it held are
+ * reported as missing, and the JSON is still valid.
+ *
+ * Parameters:
+ *  FILE *input: Console log.
+ *  FILE *output: Destination of the JSON.
+ *  trace_to_chrome_stats_t *stats: Filled with the statistics of the dump.
+ *
+ * Return:
+ *  int: 0 on success, or -1 if the log holds no dump header or memory could
+ *  not be allocated.
+ *
+ ******************************************************************************/
+int trace_to_chrome_convert(FILE *input, FILE *output, trace_to_chrome_stats_t *stats)
+{
+    char line[CONVERTER_LINE_LENGTH];
+    char *payload;
+    bool is_header_read = false;
+
+    memset(stats, 0, sizeof(trace_to_chrome_stats_t));
+    free(events);
+    events = NULL;
+    event_count = 0;
+
+    while (NULL != fgets(line, sizeof(line), input))
+    {
+        /* A line longer than the buffer is not part of a dump. */
+        if ((NULL == strchr(line, '\n')) && !feof(input))
+        {
+            int character;
+
+            do
+            {
+                character = fgetc(input);
+            } while ((EOF != character) && ('\n' != character));
+        }
+
+        if (NULL == (payload = strstr(line, TRACE_RECORDER_DUMP_PREFIX)))
+        {
+            continue;
+        }
+        payload += sizeof(TRACE_RECORDER_DUMP_PREFIX) - 1u;
+
+        if (!read_dump_line(&payload))
+        {
+            stats->corrupted_lines++;
+            continue;
+        }
+
+        /* A new dump replaces the previous one. */
+        if ('H' == payload[0])
+        {
+            memset(stats, 0, sizeof(trace_to_chrome_stats_t));
+            is_header_read = true;
+        }
+
+        if (!is_header_read)
+        {
+            continue;
+        }
+
+        if (!parse_dump_line(payload, stats))
+        {
+            if (NULL == events)
+            {
+                return -1;
+            }
+            stats->corrupted_lines++;
+            continue;
+        }
+
+        stats->dump_lines++;
+    }
+
+    if (!is_header_read)
+    {
+        return -1;
+    }
+
+    for (uint32_t index = 0; index < event_count; index++)
+    {
+        if (events[index].is_present)
+        {
+            stats->events++;
+        }
+    }
+    stats->missing_events = event_count - stats->events;
+
+    write_json(output);
+
+    return 0;
+}
+
+
+/*******************************************************************************
+ * Function Name: read_dump_line
+ *******************************************************************************
+ * Summary: Checks the checksum of a line of the dump and cuts the checksum off
+ * the payload.
+ *
+ * Parameters:
+ *  char **payload: Points to the fields after the prefix.
+ *
+ * Return:
+ *  bool: true if the checksum matches the fields.
+ *
+ ******************************************************************************/
+static bool read_dump_line(char **payload)
+{
+    char *separator = strrchr(*payload, '*');
+    uint8_t checksum = 0;
+    unsigned int expected;
+    int consumed = 0;
+
+    if ((NULL == separator) || (1 != sscanf(separator + 1, "%2X%n", &expected, &consumed)) || (2 != consumed) ||
+        (strspn(separator + 3, "\r\n") != strlen(separator + 3)))
+    {
+        return false;
+    }
+
+    for (const char *position = *payload; position < separator; position++)
+    {
+        checksum ^= (uint8_t)*position;
+    }
+
+    *separator = '\0';
+    return (checksum == expected) && ('\0' != (*payload)[0]) && (' ' == (*payload)[1]);
+}
+
+
+/*******************************************************************************
+ * Function Name: parse_dump_line
+ *******************************************************************************
+ * Summary: Stores the header, task, name, event, or end line of the dump.
+ *
+ * Parameters:
+ *  char *payload: Fields of the line, without the checksum.
+ *  trace_to_chrome_stats_t *stats: Statistics of the dump.
+ *
+ * Return:
+ *  bool: false if the fields do not have the format of their line type.
+ *
+ ******************************************************************************/
+static bool parse_dump_line(char *payload, trace_to_chrome_stats_t *stats)
+{
+    unsigned int version;
+    unsigned int index;
+    unsigned int timestamp;
+    unsigned int arg;
+    unsigned int event;
+    unsigned int value;
+    unsigned long long object;
+    int consumed = 0;
+
+    switch (payload[0])
+    {
+        case 'H':
+            if ((4 != sscanf(payload + 2, "%u %u %u %u", &version, &cycles_per_us, &event_count,
+                             &stats->overwritten_events)) || (TRACE_RECORDER_DUMP_VERSION != version))
+            {
+                return false;
+            }
+            cycles_per_us = (0u == cycles_per_us) ? 1u : cycles_per_us;
+            task_count = 0;
+            name_count = 0;
+            free(events);
+            events = calloc((0u == event_count) ? 1u : event_count, sizeof(converter_event_t));
+            return (NULL != events);
+
+        case 'T':
+            if ((2 != sscanf(payload + 2, "%llx %u %n", &object, &value, &consumed)) || (0 == consumed))
+            {
+                return false;
+            }
+            if (task_count < TRACE_RECORDER_MAX_TASKS)
+            {
+                tasks[task_count].handle = object;
+                tasks[task_count].base_priority = value;
+                copy_name(tasks[task_count].name, payload + 2 + consumed);
+                task_count++;
+            }
+            return true;
+
+        case 'N':
+            if ((1 != sscanf(payload + 2, "%llx %n", &object, &consumed)) || (0 == consumed))
+            {
+                return false;
+            }
+            if (name_count < CONVERTER_MAX_NAMES)
+            {
+                names[name_count].object = object;
+                copy_name(names[name_count].name, payload + 2 + consumed);
+                name_count++;
+            }
+            return true;
+
+        case 'E':
+            if ((5 != sscanf(payload + 2, "%u %x %llx %u %u", &index, &timestamp, &object, &arg, &event)) ||
+                (index >= event_count))
+            {
+                return false;
+            }
+            events[index].timestamp = timestamp;
+            events[index].object = object;
+            events[index].arg = arg;
+            events[index].event = event;
+            events[index].is_present = true;
+            return true;
+
+        case 'Z':
+            stats->is_complete = true;
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: copy_name
+ *******************************************************************************
+ * Summary: Copies a name from the dump, truncated to CONVERTER_NAME_LENGTH.
+ *
+ * Parameters:
+ *  char *name: Destination of CONVERTER_NAME_LENGTH bytes.
+ *  const char *text: Name in the dump.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void copy_name(char *name, const char *text)
+{
+    strncpy(name, text, CONVERTER_NAME_LENGTH - 1u);
+    name[CONVERTER_NAME_LENGTH - 1u] = '\0';
+}
+
+
+/*******************************************************************************
+ * Function Name: find_name
+ *******************************************************************************
+ * Summary: Finds the name of an interrupt, span, or queue.
+ *
+ * Parameters:
+ *  uint64_t object: Object of the event.
+ *  char *fallback: Buffer for the address of an object without a name.
+ *  size_t fallback_size: Size of the buffer.
+ *
+ * Return:
+ *  const char *: Name of the object, or its address.
+ *
+ ******************************************************************************/
+static const char *find_name(uint64_t object, char *fallback, size_t fallback_size)
+{
+    for (uint32_t index = 0; index < name_count; index++)
+    {
+        if (names[index].object == object)
+        {
+            return names[index].name;
+        }
+    }
+
+    snprintf(fallback, fallback_size, "0x%08llx", (unsigned long long)object);
+    return fallback;
+}
+
+
+/*******************************************************************************
+ * Function Name: find_task_tid
+ *******************************************************************************
+ * Summary: Finds the track of a task in the exported trace.
+ *
+ * Parameters:
+ *  uint64_t handle: Handle of the task.
+ *
+ * Return:
+ *  uint32_t: Track of the task, or of the other tasks if it is unknown.
+ *
+ ******************************************************************************/
+static uint32_t find_task_tid(uint64_t handle)
+{
+    for (uint32_t index = 0; index < task_count; index++)
+    {
+        if (tasks[index].handle == handle)
+        {
+            return index + 1u;
+        }
+    }
+
+    return TRACE_TID_OTHER_TASKS;
+}
+
+
+/*******************************************************************************
+ * Function Name: write_json
+ *******************************************************************************
+ * Summary: Writes the events of the dump as Chrome trace JSON. Each task has a
+ * track of the slices in which it ran, labelled with the priority it ran at,
+ * so that inherited priorities stand out, and a second track for its spans.
+ * Interrupts have a track of their own.
+ *
+ * The timestamps are in microseconds from the oldest event of the dump. The
+ * 32-bit cycle counter wraps every few tens of seconds, so periods without any
+ * event longer than that are shortened in the export.
+ *
+ * Parameters:
+ *  FILE *output: Destination of the JSON.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void write_json(FILE *output)
+{
+    uint64_t elapsed_cycles = 0;
+    uint32_t previous_timestamp = 0;
+    uint32_t timestamp_us = 0;
+    uint32_t current_tid = TRACE_TID_OTHER_TASKS;
+    uint32_t slice_start_us = 0;
+    uint32_t slice_priority = 0;
+    bool is_slice_open = false;
+    bool is_first_event = true;
+    const converter_event_t *entry;
+    char fallback[24];
+    uint32_t tid;
+
+    is_first_json_event = true;
+
+    fprintf(output, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+    /* Track names */
+    write_event_header(output, "M", "thread_name", 0, TRACE_TID_INTERRUPTS);
+    fprintf(output, "\"args\":{\"name\":\"Interrupts\"}}");
+    write_event_header(output, "M", "thread_name", 0, TRACE_TID_OTHER_TASKS);
+    fprintf(output, "\"args\":{\"name\":\"Other tasks\"}}");
+
+    for (uint32_t index = 0; index < task_count; index++)
+    {
+        write_event_header(output, "M", "thread_name", 0, index + 1u);
+        fprintf(output, "\"args\":{\"name\":\"");
+        write_string(output, tasks[index].name);
+        fprintf(output, " (priority %lu)\"}}", (unsigned long)tasks[index].base_priority);
+        write_event_header(output, "M", "thread_name", 0, TRACE_TID_SPAN_OFFSET + index + 1u);
+        fprintf(output, "\"args\":{\"name\":\"");
+        write_string(output, tasks[index].name);
+        fprintf(output, " spans\"}}");
+    }
+
+    for (uint32_t index = 0; index < event_count; index++)
+    {
+        entry = &events[index];
+        if (!entry->is_present)
+        {
+            continue;
+        }
+
+        if (!is_first_event)
+        {
+            elapsed_cycles += (uint32_t)(entry->timestamp - previous_timestamp);
+        }
+        is_first_event = false;
+        previous_timestamp = entry->timestamp;
+        timestamp_us = (uint32_t)(elapsed_cycles / cycles_per_us);
+
+        switch ((trace_event_t)entry->event)
+        {
+            case TRACE_EVENT_TASK_SWITCHED_IN:
+            {
+                if (is_slice_open)
+                {
+                    write_task_slice(output, current_tid, slice_start_us, timestamp_us, slice_priority);
+                }
+
+                current_tid = find_task_tid(entry->object);
+                slice_start_us = timestamp_us;
+                slice_priority = entry->arg;
+                is_slice_open = true;
+                break;
+            }
+
+            case TRACE_EVENT_QUEUE_SEND:
+                write_queue_event(output, "queue send", entry->object, timestamp_us, current_tid);
+                break;
+
+            case TRACE_EVENT_QUEUE_SEND_FROM_ISR:
+                write_queue_event(output, "queue send", entry->object, timestamp_us, TRACE_TID_INTERRUPTS);
+                break;
+
+            case TRACE_EVENT_QUEUE_SEND_FAILED:
+                write_queue_event(output, "queue send failed", entry->object, timestamp_us, current_tid);
+                break;
+
+            case TRACE_EVENT_QUEUE_RECEIVE:
+                write_queue_event(output, "queue receive", entry->object, timestamp_us, current_tid);
+                break;
+
+            case TRACE_EVENT_QUEUE_RECEIVE_FAILED:
+                write_queue_event(output, "queue receive failed", entry->object, timestamp_us, current_tid);
+                break;
+
+            case TRACE_EVENT_QUEUE_BLOCK_ON_SEND:
+                write_queue_event(output, "block on send", entry->object, timestamp_us, current_tid);
+                break;
+
+            case TRACE_EVENT_QUEUE_BLOCK_ON_RECEIVE:
+                write_queue_event(output, "block on receive", entry->object, timestamp_us, current_tid);
+                break;
+
+            case TRACE_EVENT_PRIORITY_INHERIT:
+            case TRACE_EVENT_PRIORITY_DISINHERIT:
+            {
+                tid = find_task_tid(entry->object);
+                write_event_header(output, "i", (TRACE_EVENT_PRIORITY_INHERIT == entry->event) ?
+                                   "priority inherit" : "priority disinherit", timestamp_us, tid);
+                fprintf(output, "\"s\":\"t\",\"args\":{\"priority\":%lu}}", (unsigned long)entry->arg);
+
+                /* The holder keeps running at the new priority. */
+                if (is_slice_open && (tid == current_tid))
+                {
+                    write_task_slice(output, current_tid, slice_start_us, timestamp_us, slice_priority);
+                    slice_start_us = timestamp_us;
+                    slice_priority = entry->arg;
+                }
+                break;
+            }
+
+            case TRACE_EVENT_ISR_ENTER:
+            case TRACE_EVENT_ISR_EXIT:
+                write_event_header(output, (TRACE_EVENT_ISR_ENTER == entry->event) ? "B" : "E",
+                                   find_name(entry->object, fallback, sizeof(fallback)), timestamp_us,
+                                   TRACE_TID_INTERRUPTS);
+                fprintf(output, "\"args\":{}}");
+                break;
+
+            case TRACE_EVENT_SPAN_BEGIN:
+            case TRACE_EVENT_SPAN_END:
+            {
+                tid = (current_tid <= task_count) ? (TRACE_TID_SPAN_OFFSET + current_tid) : current_tid;
+                write_event_header(output, (TRACE_EVENT_SPAN_BEGIN == entry->event) ? "B" : "E",
+                                   find_name(entry->object, fallback, sizeof(fallback)), timestamp_us, tid);
+                fprintf(output, "\"args\":{}}");
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+
+    if (is_slice_open)
+    {
+        write_task_slice(output, current_tid, slice_start_us, timestamp_us, slice_priority);
+    }
+
+    fprintf(output, "\n]}\n");
+}
+
+
+/*******************************************************************************
+ * Function Name: write_string
+ *******************************************************************************
+ * Summary: Writes text inside a JSON string, escaping the quotes, the
+ * backslashes, and the control characters.
+ *
+ * Parameters:
+ *  FILE *output: Destination of the JSON.
+ *  const char *text: Text to write.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void write_string(FILE *output, const char *text)
+{
+    for (; '\0' != *text; text++)
+    {
+        if (('"' == *text) || ('\\' == *text))
+        {
+            fprintf(output, "\\%c", *text);
+        }
+        else if ((uint8_t)*text < 0x20u)
+        {
+            fprintf(output, "\\u%04x", (unsigned int)(uint8_t)*text);
+        }
+        else
+        {
+            fputc(*text, output);
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: write_event_header
+ *******************************************************************************
+ * Summary: Writes the fields common to all the JSON events. The caller writes
+ * the remaining fields and the closing brace.
+ *
+ * Parameters:
+ *  FILE *output: Destination of the JSON.
+ *  const char *phase: Chrome trace event phase.
+ *  const char *name: Name of the event.
+ *  uint32_t timestamp_us: Timestamp in microseconds.
+ *  uint32_t tid: Track of the event.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void write_event_header(FILE *output, const char *phase, const char *name, uint32_t timestamp_us,
+                               uint32_t tid)
+{
+    fprintf(output, "%s{\"ph\":\"%s\",\"name\":\"", is_first_json_event ? "" : ",\n", phase);
+    write_string(output, name);
+    fprintf(output, "\",\"ts\":%lu,\"pid\":1,\"tid\":%lu,", (unsigned long)timestamp_us, (unsigned long)tid);
+    is_first_json_event = false;
+}
+
+
+/*******************************************************************************
+ * Function Name: write_queue_event
+ *******************************************************************************
+ * Summary: Writes a queue operation as an instant event, naming the queue if
+ * it was in the queue registry.
+ *
+ * Parameters:
+ *  FILE *output: Destination of the JSON.
+ *  const char *name: Name of the operation.
+ *  uint64_t queue: Queue of the operation.
+ *  uint32_t timestamp_us: Timestamp in microseconds.
+ *  uint32_t tid: Track of the event.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void write_queue_event(FILE *output, const char *name, uint64_t queue, uint32_t timestamp_us,
+                              uint32_t tid)
+{
+    char fallback[24];
+
+    write_event_header(output, "i", name, timestamp_us, tid);
+    fprintf(output, "\"s\":\"t\",\"args\":{\"queue\":\"");
+    write_string(output, find_name(queue, fallback, sizeof(fallback)));
+    fprintf(output, "\"}}");
+}
+
+
+/*******************************************************************************
+ * Function Name: write_task_slice
+ *******************************************************************************
+ * Summary: Writes a period in which a task ran at one priority as a complete
+ * event.
+ *
+ * Parameters:
+ *  FILE *output: Destination of the JSON.
+ *  uint32_t tid: Track of the task.
+ *  uint32_t start_us: Start of the period in microseconds.
+ *  uint32_t end_us: End of the period in microseconds.
+ *  uint32_t priority: Priority the task ran at.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void write_task_slice(FILE *output, uint32_t tid, uint32_t start_us, uint32_t end_us, uint32_t priority)
+{
+    const char *name = (tid <= task_count) ? tasks[tid - 1u].name : "Task";
+
+    write_event_header(output, "X", name, start_us, tid);
+    fprintf(output, "\"dur\":%lu,\"args\":{\"priority\":%lu}}", (unsigned long)(end_us - start_us),
+            (unsigned long)priority);
+}
+
+
+/* [] END OF FILE */
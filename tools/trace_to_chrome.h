@@ -0,0 +1,81 @@
+/*******************************************************************************
+* File Name: trace_to_chrome.h
+*
+* Description: This file includes the function prototypes of the host
+* converter of the trace recorder dump to Chrome trace JSON in
+* trace_to_chrome.c
+*
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ *  Include guard
+ ******************************************************************************/
+#ifndef TOOLS_TRACE_TO_CHROME_H_
+#define TOOLS_TRACE_TO_CHROME_H_
+
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef struct
+{
+    uint32_t dump_lines;            /* Valid lines of the converted dump */
+    uint32_t corrupted_lines;       /* Lines of the dump with a wrong checksum or format */
+    uint32_t events;                /* Events converted */
+    uint32_t missing_events;        /* Events of the dump lost to corrupted lines */
+    uint32_t overwritten_events;    /* Oldest events lost to the ring buffer before the dump */
+    bool     is_complete;           /* The end line of the dump was read */
+} trace_to_chrome_stats_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+int trace_to_chrome_convert(FILE *input, FILE *output, trace_to_chrome_stats_t *stats);
+
+#endif /*TOOLS_TRACE_TO_CHROME_H_*/
+
+
+/* [] END OF FILE */
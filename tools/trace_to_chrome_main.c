@@ -0,0 +1,96 @@
+/*******************************************************************************
+* File Name: trace_to_chrome_main.c
+*
+* Description: Command line of the host converter of the trace recorder dump.
+* Reads a console log from a file or from the standard input, writes the last
+* dump in it as Chrome trace JSON to the standard output, and reports the
+* lines and events lost to other console output on the standard error.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdio.h>
+
+#include "trace_to_chrome.h"
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+int main(int argc, char *argv[])
+{
+    trace_to_chrome_stats_t stats;
+    FILE *input = stdin;
+    int result;
+
+    if (argc > 2)
+    {
+        fprintf(stderr, "Usage: %s [console log]\n", argv[0]);
+        return 2;
+    }
+
+    if ((2 == argc) && (NULL == (input = fopen(argv[1], "r"))))
+    {
+        perror(argv[1]);
+        return 2;
+    }
+
+    result = trace_to_chrome_convert(input, stdout, &stats);
+
+    if (stdin != input)
+    {
+        fclose(input);
+    }
+
+    if (0 != result)
+    {
+        fprintf(stderr, "No trace dump found.\n");
+        return 1;
+    }
+
+    fprintf(stderr, "%lu events converted, %lu missing, %lu overwritten before the dump, "
+            "%lu corrupted lines%s\n",
+            (unsigned long)stats.events, (unsigned long)stats.missing_events,
+            (unsigned long)stats.overwritten_events, (unsigned long)stats.corrupted_lines,
+            stats.is_complete ? "" : ", dump incomplete");
+
+    return 0;
+}
+
+
+/* [] END OF FILE */
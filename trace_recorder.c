@@ -0,0 +1,491 @@
+/*******************************************************************************
+* File Name: trace_recorder.c
+*
+* Description: This file contains the scheduler trace recorder. The FreeRTOS
+* trace hooks record context switches, queue operations and priority
+* inheritance into a RAM ring buffer, together with the interrupt entries and
+* exits and the spans marked by the application. The buffer is printed as
+* checksummed dump lines, which tools/trace_to_chrome converts on the host to
+* Chrome trace JSON for Perfetto (ui.perfetto.dev) or chrome://tracing.
+*
+* Related Document: See README.md
+*
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "cyhal.h"
+#include "cybsp.h"
+
+/* FreeRTOS includes */
+#include "FreeRTOS.h"
+#include "queue.h"
+
+#include "trace_recorder.h"
+
+#if (TRACE_RECORDER_ENABLE)
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define CYCLES_PER_MICROSECOND              (SystemCoreClock / 1000000u)
+
+/* Longest line of the dump, including the prefix and the checksum. */
+#define TRACE_DUMP_LINE_LENGTH              (96u)
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef struct
+{
+    uint32_t   timestamp;       /* DWT cycle count */
+    const void *object;
+    uint32_t   arg;
+    uint8_t    event;
+} trace_entry_t;
+
+typedef struct
+{
+    const void *handle;
+    uint32_t   base_priority;
+    char       name[TRACE_RECORDER_TASK_NAME_LENGTH];
+} trace_task_t;
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static trace_entry_t trace_buffer[TRACE_RECORDER_BUFFER_SIZE];
+static volatile uint32_t trace_count = 0;
+static volatile bool is_recording = false;
+
+/* Filled by the task creation hook whether or not recording is on, so that
+ * the tasks created at start-up are named in the export.
+ */
+static trace_task_t trace_tasks[TRACE_RECORDER_MAX_TASKS];
+static uint32_t trace_task_count = 0;
+
+/* Line of the dump being printed. */
+static char dump_line_buffer[TRACE_DUMP_LINE_LENGTH];
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static const char *get_object_name(const trace_entry_t *entry);
+static bool is_name_dumped(uint32_t first, uint32_t index);
+static void dump_line(const char *format, ...);
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: trace_recorder_record
+ *******************************************************************************
+ * Summary: Appends an event to the trace buffer, overwriting the oldest event
+ * when the buffer is full. Called from the kernel trace hooks, from tasks and
+ * from interrupts.
+ *
+ * Parameters:
+ *  trace_event_t event: Recorded event.
+ *  const void *object: Task, queue or name of the event.
+ *  uint32_t arg: Event specific argument.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void trace_recorder_record(trace_event_t event, const void *object, uint32_t arg)
+{
+    UBaseType_t interrupt_mask;
+    trace_entry_t *entry;
+
+    if (!is_recording)
+    {
+        return;
+    }
+
+    interrupt_mask = portSET_INTERRUPT_MASK_FROM_ISR();
+
+    entry = &trace_buffer[trace_count % TRACE_RECORDER_BUFFER_SIZE];
+    entry->timestamp = DWT->CYCCNT;
+    entry->object = object;
+    entry->arg = arg;
+    entry->event = (uint8_t)event;
+    trace_count++;
+
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(interrupt_mask);
+}
+
+
+/*******************************************************************************
+ * Function Name: trace_recorder_task_created
+ *******************************************************************************
+ * Summary: Keeps the name and the priority of a new task for the export.
+ * Called from the task creation hook inside a kernel critical section.
+ *
+ * Parameters:
+ *  const void *task: Handle of the task.
+ *  const char *name: Name of the task.
+ *  uint32_t priority: Priority of the task.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void trace_recorder_task_created(const void *task, const char *name, uint32_t priority)
+{
+    uint32_t index;
+
+    /* A new task may reuse the memory of a deleted one. */
+    for (index = 0; index < trace_task_count; index++)
+    {
+        if (trace_tasks[index].handle == task)
+        {
+            break;
+        }
+    }
+
+    if (index == trace_task_count)
+    {
+        if (trace_task_count == TRACE_RECORDER_MAX_TASKS)
+        {
+            return;
+        }
+        trace_task_count++;
+    }
+
+    trace_tasks[index].handle = task;
+    trace_tasks[index].base_priority = priority;
+    strncpy(trace_tasks[index].name, name, TRACE_RECORDER_TASK_NAME_LENGTH - 1u);
+    trace_tasks[index].name[TRACE_RECORDER_TASK_NAME_LENGTH - 1u] = '\0';
+}
+
+
+/*******************************************************************************
+ * Function Name: trace_recorder_start
+ *******************************************************************************
+ * Summary: Clears the trace buffer and starts recording. Deep sleep is locked
+ * while recording because the cycle counter used for the timestamps stops in
+ * deep sleep.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void trace_recorder_start(void)
+{
+    if (is_recording)
+    {
+        return;
+    }
+
+    cyhal_syspm_lock_deepsleep();
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    trace_count = 0;
+    is_recording = true;
+}
+
+
+/*******************************************************************************
+ * Function Name: trace_recorder_stop
+ *******************************************************************************
+ * Summary: Stops recording. The trace buffer is kept until the next start.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void trace_recorder_stop(void)
+{
+    if (!is_recording)
+    {
+        return;
+    }
+
+    is_recording = false;
+    cyhal_syspm_unlock_deepsleep();
+}
+
+
+/*******************************************************************************
+ * Function Name: trace_recorder_get_stats
+ *******************************************************************************
+ * Summary: Copies the recording statistics.
+ *
+ * Parameters:
+ *  trace_recorder_stats_t *stats_copy: Filled with the statistics.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void trace_recorder_get_stats(trace_recorder_stats_t *stats_copy)
+{
+    uint32_t count = trace_count;
+
+    stats_copy->recorded_events = count;
+    stats_copy->overwritten_events = (count > TRACE_RECORDER_BUFFER_SIZE) ?
+                                     (count - TRACE_RECORDER_BUFFER_SIZE) : 0u;
+    stats_copy->is_recording = is_recording;
+}
+
+
+/*******************************************************************************
+ * Function Name: trace_recorder_dump
+ *******************************************************************************
+ * Summary: Stops recording and prints the trace buffer as text lines, which
+ * tools/trace_to_chrome converts to Chrome trace JSON on the host. The dump
+ * has a header line, a line for each known task, a line naming each interrupt,
+ * span, and registered queue found in the events, a line for each event from
+ * the oldest, and an end line. The other tasks may print while the dump is
+ * printed, so every line carries the TRACE_RECORDER_DUMP_PREFIX and a
+ * checksum, and every event its position in the dump: the converter skips the
+ * other output, and drops and counts the lines that were mixed with it.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void trace_recorder_dump(void)
+{
+    uint32_t cycles_per_us = (CYCLES_PER_MICROSECOND > 0u) ? CYCLES_PER_MICROSECOND : 1u;
+    uint32_t available;
+    uint32_t first;
+    const trace_entry_t *entry;
+    const char *name;
+
+    trace_recorder_stop();
+
+    available = (trace_count < TRACE_RECORDER_BUFFER_SIZE) ? trace_count : TRACE_RECORDER_BUFFER_SIZE;
+    first = trace_count - available;
+
+    dump_line("H %lu %lu %lu %lu", (unsigned long)TRACE_RECORDER_DUMP_VERSION, (unsigned long)cycles_per_us,
+              (unsigned long)available, (unsigned long)first);
+
+    for (uint32_t index = 0; index < trace_task_count; index++)
+    {
+        dump_line("T %08lx %lu %s", (unsigned long)(uintptr_t)trace_tasks[index].handle,
+                  (unsigned long)trace_tasks[index].base_priority, trace_tasks[index].name);
+    }
+
+    for (uint32_t index = 0; index < available; index++)
+    {
+        entry = &trace_buffer[(first + index) % TRACE_RECORDER_BUFFER_SIZE];
+        name = get_object_name(entry);
+
+        if ((NULL != name) && !is_name_dumped(first, index))
+        {
+            dump_line("N %08lx %s", (unsigned long)(uintptr_t)entry->object, name);
+        }
+    }
+
+    for (uint32_t index = 0; index < available; index++)
+    {
+        entry = &trace_buffer[(first + index) % TRACE_RECORDER_BUFFER_SIZE];
+        dump_line("E %lu %08lx %08lx %lu %u", (unsigned long)index, (unsigned long)entry->timestamp,
+                  (unsigned long)(uintptr_t)entry->object, (unsigned long)entry->arg, (unsigned int)entry->event);
+    }
+
+    dump_line("Z %lu", (unsigned long)available);
+}
+
+
+/*******************************************************************************
+ * Function Name: get_object_name
+ *******************************************************************************
+ * Summary: Finds the name of the object of an event: the name given to an
+ * interrupt or span hook, or the name of a queue in the queue registry.
+ *
+ * Parameters:
+ *  const trace_entry_t *entry: Recorded event.
+ *
+ * Return:
+ *  const char *: Name of the object, or NULL if it has none.
+ *
+ ******************************************************************************/
+static const char *get_object_name(const trace_entry_t *entry)
+{
+    switch ((trace_event_t)entry->event)
+    {
+        case TRACE_EVENT_ISR_ENTER:
+        case TRACE_EVENT_ISR_EXIT:
+        case TRACE_EVENT_SPAN_BEGIN:
+        case TRACE_EVENT_SPAN_END:
+            return (const char *)entry->object;
+
+        case TRACE_EVENT_QUEUE_SEND:
+        case TRACE_EVENT_QUEUE_SEND_FROM_ISR:
+        case TRACE_EVENT_QUEUE_SEND_FAILED:
+        case TRACE_EVENT_QUEUE_RECEIVE:
+        case TRACE_EVENT_QUEUE_RECEIVE_FAILED:
+        case TRACE_EVENT_QUEUE_BLOCK_ON_SEND:
+        case TRACE_EVENT_QUEUE_BLOCK_ON_RECEIVE:
+            #if (configQUEUE_REGISTRY_SIZE > 0)
+            return pcQueueGetName((QueueHandle_t)entry->object);
+            #else
+            return NULL;
+            #endif
+
+        default:
+            return NULL;
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: is_name_dumped
+ *******************************************************************************
+ * Summary: Checks whether the object of an event was already named by an
+ * older event of the dump.
+ *
+ * Parameters:
+ *  uint32_t first: Count of the oldest event of the dump.
+ *  uint32_t index: Position of the event in the dump.
+ *
+ * Return:
+ *  bool: true if an older event has the same named object.
+ *
+ ******************************************************************************/
+static bool is_name_dumped(uint32_t first, uint32_t index)
+{
+    const trace_entry_t *entry = &trace_buffer[(first + index) % TRACE_RECORDER_BUFFER_SIZE];
+    const trace_entry_t *older;
+
+    for (uint32_t older_index = 0; older_index < index; older_index++)
+    {
+        older = &trace_buffer[(first + older_index) % TRACE_RECORDER_BUFFER_SIZE];
+        if ((older->object == entry->object) && (NULL != get_object_name(older)))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+/*******************************************************************************
+ * Function Name: dump_line
+ *******************************************************************************
+ * Summary: Prints a line of the dump: the prefix, the formatted fields, '*',
+ * and the XOR of the characters of the fields in two hexadecimal digits. The
+ * line is printed with a single call, so that other output is less likely to
+ * be mixed with it.
+ *
+ * Parameters:
+ *  const char *format: printf format of the fields.
+ *  ...: Values of the fields.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void dump_line(const char *format, ...)
+{
+    uint32_t prefix_length = sizeof(TRACE_RECORDER_DUMP_PREFIX) - 1u;
+    uint32_t length;
+    uint8_t checksum = 0;
+    va_list args;
+    int result;
+
+    memcpy(dump_line_buffer, TRACE_RECORDER_DUMP_PREFIX, prefix_length);
+
+    /* Room is left for the checksum, the newline, and the terminator. */
+    va_start(args, format);
+    result = vsnprintf(&dump_line_buffer[prefix_length], sizeof(dump_line_buffer) - prefix_length - 4u,
+                       format, args);
+    va_end(args);
+
+    if (result < 0)
+    {
+        return;
+    }
+
+    length = (uint32_t)strlen(dump_line_buffer);
+    for (uint32_t index = prefix_length; index < length; index++)
+    {
+        checksum ^= (uint8_t)dump_line_buffer[index];
+    }
+
+    snprintf(&dump_line_buffer[length], sizeof(dump_line_buffer) - length, "*%02X\n", (unsigned int)checksum);
+    printf("%s", dump_line_buffer);
+}
+
+#else
+
+void trace_recorder_start(void)
+{
+}
+
+void trace_recorder_stop(void)
+{
+}
+
+void trace_recorder_get_stats(trace_recorder_stats_t *stats_copy)
+{
+    memset(stats_copy, 0, sizeof(trace_recorder_stats_t));
+}
+
+void trace_recorder_dump(void)
+{
+}
+
+#endif /* TRACE_RECORDER_ENABLE */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,185 @@
+/*******************************************************************************
+* File Name: trace_recorder.h
+*
+* Description: This file includes the macros, structures, and function
+* prototypes of the scheduler trace recorder used in trace_recorder.c. It is
+* included at the end of FreeRTOSConfig.h so that the kernel trace hooks
+* defined here are compiled into the FreeRTOS sources.
+*
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ *  Include guard
+ ******************************************************************************/
+#ifndef SOURCE_TRACE_RECORDER_H_
+#define SOURCE_TRACE_RECORDER_H_
+
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Set to 1 to compile the kernel trace hooks and reserve the trace buffer.
+ * Recording is then started and stopped at run time with
+ * trace_recorder_start() and trace_recorder_stop().
+ */
+#define TRACE_RECORDER_ENABLE               (1)
+
+/* Number of the newest events kept in the trace buffer. Must be a power of
+ * two. Each event takes 16 bytes.
+ */
+#define TRACE_RECORDER_BUFFER_SIZE          (512u)
+
+/* Number of tasks whose names are kept for the export. Tasks created after
+ * the table is full are exported on a shared track.
+ */
+#define TRACE_RECORDER_MAX_TASKS            (12u)
+
+/* Length of the task names kept for the export, including the terminator. */
+#define TRACE_RECORDER_TASK_NAME_LENGTH     (16u)
+
+/* Format of the dump printed by trace_recorder_dump() and read by
+ * tools/trace_to_chrome. Every line starts with the prefix and ends with '*'
+ * and a checksum.
+ */
+#define TRACE_RECORDER_DUMP_VERSION         (1u)
+#define TRACE_RECORDER_DUMP_PREFIX          "TRC "
+
+
+/*******************************************************************************
+ * Enumerations
+ ******************************************************************************/
+/* Recorded events. The object and the argument of each event are given next
+ * to it.
+ */
+typedef enum
+{
+    TRACE_EVENT_TASK_SWITCHED_IN = 1,   /* object: task, arg: current priority */
+    TRACE_EVENT_QUEUE_SEND,             /* object: queue */
+    TRACE_EVENT_QUEUE_SEND_FROM_ISR,    /* object: queue */
+    TRACE_EVENT_QUEUE_SEND_FAILED,      /* object: queue */
+    TRACE_EVENT_QUEUE_RECEIVE,          /* object: queue */
+    TRACE_EVENT_QUEUE_RECEIVE_FAILED,   /* object: queue */
+    TRACE_EVENT_QUEUE_BLOCK_ON_SEND,    /* object: queue */
+    TRACE_EVENT_QUEUE_BLOCK_ON_RECEIVE, /* object: queue */
+    TRACE_EVENT_PRIORITY_INHERIT,       /* object: mutex holder task, arg: inherited priority */
+    TRACE_EVENT_PRIORITY_DISINHERIT,    /* object: mutex holder task, arg: restored priority */
+    TRACE_EVENT_ISR_ENTER,              /* object: ISR name */
+    TRACE_EVENT_ISR_EXIT,               /* object: ISR name */
+    TRACE_EVENT_SPAN_BEGIN,             /* object: span name */
+    TRACE_EVENT_SPAN_END                /* object: span name */
+} trace_event_t;
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef struct
+{
+    uint32_t recorded_events;       /* Since the last start */
+    uint32_t overwritten_events;    /* Oldest events lost to the ring buffer */
+    bool     is_recording;
+} trace_recorder_stats_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+void trace_recorder_record(trace_event_t event, const void *object, uint32_t arg);
+void trace_recorder_task_created(const void *task, const char *name, uint32_t priority);
+void trace_recorder_start(void);
+void trace_recorder_stop(void);
+void trace_recorder_get_stats(trace_recorder_stats_t *stats_copy);
+void trace_recorder_dump(void);
+
+
+/*******************************************************************************
+ * Trace hooks
+ ******************************************************************************/
+#if (TRACE_RECORDER_ENABLE)
+
+/* Kernel trace hooks. These are expanded inside the FreeRTOS sources, where
+ * pxCurrentTCB and the TCB members are visible.
+ */
+#define traceTASK_CREATE(pxNewTCB) \
+    trace_recorder_task_created((pxNewTCB), (pxNewTCB)->pcTaskName, (uint32_t)(pxNewTCB)->uxPriority)
+#define traceTASK_SWITCHED_IN() \
+    trace_recorder_record(TRACE_EVENT_TASK_SWITCHED_IN, pxCurrentTCB, (uint32_t)pxCurrentTCB->uxPriority)
+#define traceQUEUE_SEND(pxQueue) \
+    trace_recorder_record(TRACE_EVENT_QUEUE_SEND, (pxQueue), 0u)
+#define traceQUEUE_SEND_FROM_ISR(pxQueue) \
+    trace_recorder_record(TRACE_EVENT_QUEUE_SEND_FROM_ISR, (pxQueue), 0u)
+#define traceQUEUE_SEND_FAILED(pxQueue) \
+    trace_recorder_record(TRACE_EVENT_QUEUE_SEND_FAILED, (pxQueue), 0u)
+#define traceQUEUE_RECEIVE(pxQueue) \
+    trace_recorder_record(TRACE_EVENT_QUEUE_RECEIVE, (pxQueue), 0u)
+#define traceQUEUE_RECEIVE_FAILED(pxQueue) \
+    trace_recorder_record(TRACE_EVENT_QUEUE_RECEIVE_FAILED, (pxQueue), 0u)
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue) \
+    trace_recorder_record(TRACE_EVENT_QUEUE_BLOCK_ON_SEND, (pxQueue), 0u)
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue) \
+    trace_recorder_record(TRACE_EVENT_QUEUE_BLOCK_ON_RECEIVE, (pxQueue), 0u)
+#define traceTASK_PRIORITY_INHERIT(pxTCBOfMutexHolder, uxInheritedPriority) \
+    trace_recorder_record(TRACE_EVENT_PRIORITY_INHERIT, (pxTCBOfMutexHolder), (uint32_t)(uxInheritedPriority))
+#define traceTASK_PRIORITY_DISINHERIT(pxTCBOfMutexHolder, uxOriginalPriority) \
+    trace_recorder_record(TRACE_EVENT_PRIORITY_DISINHERIT, (pxTCBOfMutexHolder), (uint32_t)(uxOriginalPriority))
+
+/* Application hooks. The name must be a string literal. */
+#define TRACE_RECORDER_ISR_ENTER(name)      trace_recorder_record(TRACE_EVENT_ISR_ENTER, (name), 0u)
+#define TRACE_RECORDER_ISR_EXIT(name)       trace_recorder_record(TRACE_EVENT_ISR_EXIT, (name), 0u)
+#define TRACE_RECORDER_SPAN_BEGIN(name)     trace_recorder_record(TRACE_EVENT_SPAN_BEGIN, (name), 0u)
+#define TRACE_RECORDER_SPAN_END(name)       trace_recorder_record(TRACE_EVENT_SPAN_END, (name), 0u)
+
+#else
+
+#define TRACE_RECORDER_ISR_ENTER(name)
+#define TRACE_RECORDER_ISR_EXIT(name)
+#define TRACE_RECORDER_SPAN_BEGIN(name)
+#define TRACE_RECORDER_SPAN_END(name)
+
+#endif /* TRACE_RECORDER_ENABLE */
+
+#endif /*SOURCE_TRACE_RECORDER_H_*/
+
+
+/* [] END OF FILE */
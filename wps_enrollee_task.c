@@ -52,18 +52,70 @@
 /* Wi-Fi Connection Manager includes */
 #include "cy_wcm.h"
 
+/* FreeRTOS includes */
+#include "queue.h"
+#include "timers.h"
+
 /* Task header files */
 #include "wps_enrollee_task.h"
+#include "wps_prescan.h"
+#include "conn_journal_flash.h"
+#include "network_event_dispatcher.h"
+#include "command_console.h"
+#include "fault_recovery.h"
+#include "provisioning_relay.h"
+#include "connection_state.h"
+#include "network_warmup.h"
+#include "power_save_controller.h"
+#include "trace_recorder.h"
+#include "metrics_endpoint.h"
+#include "connection_context.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Index of the given percentile in a sorted array of count samples. */
+#define PERCENTILE_INDEX(count, percentile) ((((count) - 1u) * (percentile)) / 100u)
 
 
 /*******************************************************************************
  * Global Variables
  ******************************************************************************/
 TaskHandle_t wps_enrollee_task_handle;
-bool is_network_connected = false;
 bool is_retarget_io_initialized = false;
 bool is_led_initialized = false;
 
+static QueueHandle_t wps_enrollee_command_queue = NULL;
+static volatile bool is_cancel_requested = false;
+static wps_enrollee_stats_t stats;
+
+/* WPS mode used by the next WPS command. */
+static volatile wps_enrollee_mode_t wps_mode = WPS_MODE_CONFIG;
+
+/* Names of the WPS modes, as accepted by the wps console command. */
+static const char* const mode_names[WPS_ENROLLEE_MODE_COUNT] =
+{
+    "pbc",
+    "pin",
+    "race"
+};
+
+/* Time of the last link loss, while the connection has not been regained. */
+static TickType_t link_loss_time;
+static bool is_link_lost = false;
+
+/* Parameters of the last network joined through WPS. */
+static cy_wcm_connect_params_t connect_param;
+static cy_wcm_ip_address_t ip_addr;
+static bool is_credential_available = false;
+
+/* DHCP lease reused from the retained connection context, and the timer that
+ * runs DHCP once it reaches the renewal time granted by the DHCP server.
+ */
+static cy_wcm_ip_setting_t resumed_lease;
+static TimerHandle_t lease_timer = NULL;
+
 /* Device's enrollee details. The details of WPS mode, WPS authentication, and
  * encryption methods supported are provided in this structure.
  */
@@ -86,10 +138,20 @@ const cy_wcm_wps_device_detail_t enrollee_details =
  * Function Definitions
  ******************************************************************************/
 
-static void network_event_callback(cy_wcm_event_t event, cy_wcm_event_data_t *event_data);
+static void network_event_callback(cy_wcm_event_t event, const cy_wcm_event_data_t *event_data, void *arg);
 static cy_rslt_t wifi_connect(cy_wcm_connect_params_t *connect_param, cy_wcm_ip_address_t *ip_addr);
 static void gpio_interrupt_handler(void *arg, cyhal_gpio_event_t event);
 static void print_wps_ap_credential(cy_wcm_wps_credential_t *result);
+static cy_rslt_t wps_provision_and_connect(void);
+static cy_rslt_t relay_provision_and_connect(void);
+static void disconnect_from_ap(const char *message);
+static void run_stress_test(uint32_t cycles, bool is_wps_cycle);
+static cy_rslt_t wcm_init_operation(void *arg);
+static cy_rslt_t button_init_operation(void *arg);
+static void record_link_restored(void);
+static void resume_connection(void);
+static void lease_timer_callback(TimerHandle_t timer);
+static void clear_cancel_request(wps_enrollee_command_type_t type);
 
 /*******************************************************************************
  * Callback Definitions
@@ -109,12 +171,13 @@ cyhal_gpio_callback_data_t cb_data =
 /*******************************************************************************
  * Function Name: wps_enrollee_task
  *******************************************************************************
- * Summary: Task waits for notification from the ISR associated with the user
- * button. After receiving notification, it starts to scan for APs. If the
- * AP is WPS enabled then a WPS transaction occurs between them on exchange of
- * PIN or on button press on the AP. Afterwards, it connects to the AP with the
- * credentials obtained. If the user presses the button again after connecting
- * to the AP, the device disconnects before starting the enrollee operation.
+ * Summary: Task waits for commands from the ISR associated with the user
+ * button or from the command console. On a WPS command, it starts to scan for
+ * APs. If the AP is WPS enabled then a WPS transaction occurs between them on
+ * exchange of PIN or on button press on the AP. Afterwards, it connects to the
+ * AP with the credentials obtained. If the user presses the button again after
+ * connecting to the AP, the device disconnects before starting the enrollee
+ * operation.
  *
  * Parameters:
  *  void* arg: Task parameter defined during task creation (unused).
@@ -126,110 +189,699 @@ cyhal_gpio_callback_data_t cb_data =
 void wps_enrollee_task(void *arg)
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
-    cy_wcm_config_t wcm_config = { .interface = CY_WCM_INTERFACE_TYPE_STA };
-    cy_wcm_wps_config_t wps_config = { .mode = WPS_MODE_CONFIG };
-    cy_wcm_wps_credential_t credentials[MAX_WIFI_CREDENTIALS_COUNT];
-    uint16_t credential_count = MAX_WIFI_CREDENTIALS_COUNT;
-    cy_wcm_connect_params_t connect_param;
-    cy_wcm_ip_address_t ip_addr;
+    wps_enrollee_command_t command;
+    TickType_t provision_start_time;
+
+    /* The relay soft-AP runs concurrently with the STA interface. */
+    cy_wcm_config_t wcm_config =
+    {
+        .interface = (PROVISIONING_RELAY_ENABLE) ? CY_WCM_INTERFACE_TYPE_AP_STA : CY_WCM_INTERFACE_TYPE_STA
+    };
+
+    /* Create the command queue before any source of commands is enabled. */
+    wps_enrollee_command_queue = xQueueCreate(WPS_ENROLLEE_COMMAND_QUEUE_LENGTH, sizeof(wps_enrollee_command_t));
+    error_handler((NULL == wps_enrollee_command_queue) ? WPS_ENROLLEE_RSLT_NO_MEMORY : CY_RSLT_SUCCESS,
+                  "Failed to create WPS enrollee command queue.\n");
+    vQueueAddToRegistry(wps_enrollee_command_queue, "WPS command");
+
+    /* Print the history recorded before the last reset. */
+    print_connection_journal(CONN_JOURNAL_BOOT_PRINT_COUNT);
+    conn_journal_append(CONN_JOURNAL_EVENT_BOOT, 0, (uint32_t)cyhal_system_get_reset_reason());
+
+    fault_recovery_run(wcm_init_operation, &wcm_config, true,
+                       "Failed to initialize Wi-Fi Connection Manager.\n");
+
+    result = wps_prescan_init();
+    error_handler(result, "Failed to initialize WPS pre-scan.\n");
 
-    result = cy_wcm_init(&wcm_config);
-    error_handler(result, "Failed to initialize Wi-Fi Connection Manager.\n");
+    /* Start the dispatcher of the WCM events and subscribe to the changes in
+     * Wi-Fi link status. These events could be related to IP address changes,
+     * connection, and disconnection events.
+     */
+    result = connection_state_init();
+    error_handler(result, "Failed to initialize connection state.\n");
+
+    result = connection_context_init();
+    error_handler(result, "Failed to initialize connection context.\n");
+
+    /* The period is set from the reused lease when the timer is started. */
+    lease_timer = xTimerCreate("Lease renewal", pdMS_TO_TICKS(1000u), pdFALSE, NULL, lease_timer_callback);
+    error_handler((NULL == lease_timer) ? WPS_ENROLLEE_RSLT_NO_MEMORY : CY_RSLT_SUCCESS,
+                  "Failed to create lease renewal timer.\n");
+
+    result = network_event_dispatcher_init();
+    error_handler(result, "Failed to start network event dispatcher.\n");
 
-    /* Register event callbacks for changes in Wi-Fi link status. These events
-     * could be related to IP address changes, connection, and disconnection
-     * events.
+    network_event_subscribe(network_event_callback,
+                            NETWORK_EVENT_MASK(CY_WCM_EVENT_DISCONNECTED) |
+                            NETWORK_EVENT_MASK(CY_WCM_EVENT_RECONNECTED) |
+                            NETWORK_EVENT_MASK(CY_WCM_EVENT_IP_CHANGED), NULL);
+
+    /* The warm-up subscribes after the network event callback, so the
+     * connection state is already updated when it is notified.
      */
-    cy_wcm_register_event_callback(network_event_callback);
+    result = network_warmup_init();
+    error_handler(result, "Failed to start network warm-up.\n");
+
+    result = power_save_controller_init();
+    error_handler(result, "Failed to start power-save controller.\n");
+
+    result = metrics_endpoint_init();
+    error_handler(result, "Failed to start metrics endpoint.\n");
 
     /* Initialize the user button after the tasks are created to prevent sending
-     * task notification to wps_enrollee_task before its creation.
+     * commands to wps_enrollee_task before its creation.
      */
-    result = cyhal_gpio_init(CYBSP_USER_BTN, CYHAL_GPIO_DIR_INPUT,
-                             CYHAL_GPIO_DRIVE_PULLUP, CYBSP_BTN_OFF);
-    error_handler(result, "Failed to initialize GPIO button.\n");
+    fault_recovery_run(button_init_operation, NULL, false, "Failed to initialize GPIO button.\n");
 
     /* Configure GPIO interrupt */
     cyhal_gpio_register_callback(CYBSP_USER_BTN, &cb_data);
     cyhal_gpio_enable_event(CYBSP_USER_BTN, CYHAL_GPIO_IRQ_FALL, GPIO_INTERRUPT_PRIORITY, true);
 
-    memset(credentials, 0, sizeof(credentials));
+    result = command_console_init();
+    error_handler(result, "Failed to start command console.\n");
+
     memset(&connect_param, 0, sizeof(cy_wcm_connect_params_t));
     memset(&ip_addr, 0, sizeof(cy_wcm_ip_address_t));
 
+    /* Initialization is complete. Record the recovery if the device was reset
+     * by the error handler.
+     */
+    fault_recovery_mark_healthy();
+
+    /* Resume the connection retained across the reset, if any, instead of
+     * waiting for WPS.
+     */
+    resume_connection();
+
     while(true)
     {
-        /* The task waits until it receives task notification from the user
-         * button ISR. If this value is not pdPASS, then it was something other
-         * than a button press (such as a timeout) that caused the notification.
+        /* The task waits until it receives a command from the user button ISR
+         * or from the command console.
          */
-        if (xTaskNotifyWait(0, 0, NULL, portMAX_DELAY))
+        if (pdTRUE != xQueueReceive(wps_enrollee_command_queue, &command, portMAX_DELAY))
+        {
+            continue;
+        }
+
+        clear_cancel_request(command.type);
+
+        switch (command.type)
         {
-            credential_count = MAX_WIFI_CREDENTIALS_COUNT;
+        case WPS_ENROLLEE_CMD_START_WPS:
+            disconnect_from_ap("Already connected to Wi-Fi. Disconnecting before starting WPS.\n");
+            provision_start_time = xTaskGetTickCount();
+            connection_state_set(CONNECTION_STATE_PROVISIONING);
 
-            if(is_network_connected)
+            /* A credential from a nearby relay is used when one is found;
+             * otherwise the device is provisioned through WPS.
+             */
+            result = relay_provision_and_connect();
+            if ((CY_RSLT_SUCCESS != result) && !connection_state_is_connected())
             {
-                APP_INFO(("Already connected to Wi-Fi. Disconnecting before starting WPS.\n"));
-                if(CY_RSLT_SUCCESS == cy_wcm_disconnect_ap())
-                {
-                    APP_INFO(("Disconnected from Wi-Fi.\n"));
-                    is_network_connected = false;
-                }
+                connection_state_set(CONNECTION_STATE_PROVISIONING);
+                result = wps_provision_and_connect();
             }
 
-            /* Check for the WPS mode.*/
-            if (CY_WCM_WPS_PIN_MODE == WPS_MODE_CONFIG)
+            if (CY_RSLT_SUCCESS == result)
             {
-                APP_INFO(("Starting Enrollee in PIN mode.\n"));
-                char pin_string[CY_WCM_WPS_PIN_LENGTH];
-
-                /* Here, the WPS PIN is generated by the device. the user has to
-                 * enter the pin in the AP to join the network through WPS.
-                 */
-                cy_wcm_wps_generate_pin(pin_string);
-                wps_config.password = pin_string;
-                APP_INFO(("Enter this PIN: \'%s\' in your AP.\n", pin_string));
+                stats.last_provision_duration_ms = (xTaskGetTickCount() - provision_start_time) * portTICK_PERIOD_MS;
             }
             else
             {
-                APP_INFO(("Press the push button on your WPS AP.\n"));
+                connection_state_set(CONNECTION_STATE_DISCONNECTED);
             }
+            break;
 
-            result = cy_wcm_wps_enrollee(&wps_config, &enrollee_details, credentials, &credential_count);
-
-            if (CY_RSLT_SUCCESS == result)
+        case WPS_ENROLLEE_CMD_CONNECT:
+            if (!is_credential_available)
+            {
+                ERR_INFO(("No credentials available. Run WPS first.\n"));
+            }
+            else if (!connection_state_is_connected())
             {
-                APP_INFO(("WPS Success.\n"));
+                wifi_connect(&connect_param, &ip_addr);
+            }
+            break;
 
-                /* Print the WPS credentials obtained through WPS.*/
-                for (uint32_t loop = 0; loop < credential_count; loop++)
-                {
-                    print_wps_ap_credential(&credentials[loop]);
-                }
+        case WPS_ENROLLEE_CMD_DISCONNECT:
+            disconnect_from_ap(NULL);
+            break;
 
-                /* Copy credentials of first AP credential obtained through WPS and
-                 * connect to AP.
-                 */
-                memcpy(connect_param.ap_credentials.SSID, credentials->ssid, sizeof(credentials->ssid));
-                memcpy(connect_param.ap_credentials.password, credentials->passphrase, sizeof(credentials->passphrase));
-                connect_param.ap_credentials.security = credentials->security;
-                result = wifi_connect(&connect_param, &ip_addr);
+        case WPS_ENROLLEE_CMD_STRESS_CONNECT:
+        case WPS_ENROLLEE_CMD_STRESS_WPS:
+            run_stress_test(command.arg, (WPS_ENROLLEE_CMD_STRESS_WPS == command.type));
+            break;
 
-                if(CY_RSLT_SUCCESS != result)
-                {
-                    /* Failed after maximum retry attempts. */
-                    ERR_INFO(("Exceeded maximum Wi-Fi connection attempts. Failed to connect to Wi-Fi\n"));
-                }
-                else
+        case WPS_ENROLLEE_CMD_RENEW_LEASE:
+            /* Nothing to renew if the connection parameters were replaced
+             * since the resume.
+             */
+            if (NULL != connect_param.static_ip_settings)
+            {
+                connect_param.static_ip_settings = NULL;
+                if (connection_state_is_connected())
                 {
-                    is_network_connected = true;
+                    APP_INFO(("The reused DHCP lease reached its renewal time. Starting DHCP.\n"));
+                    result = connection_context_renew_lease();
+                    if (CONNECTION_CONTEXT_RSLT_TIMEOUT == result)
+                    {
+                        ERR_INFO(("The DHCP server did not answer yet. DHCP goes on in the background.\n"));
+                    }
+                    else if (CY_RSLT_SUCCESS != result)
+                    {
+                        ERR_INFO(("Failed to start DHCP.\n"));
+                    }
                 }
             }
-            else
+            break;
+
+        case WPS_ENROLLEE_CMD_REFRESH_RELAY:
+            /* Moves the relay soft-AP to the channel of the AP after a
+             * reconnection.
+             */
+            if (connection_state_is_connected())
             {
-                ERR_INFO(("WPS Enrollee failed.\n"));
+                provisioning_relay_start(&connect_param);
             }
+            break;
+
+        default:
+            break;
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: wps_enrollee_send_command
+ *******************************************************************************
+ * Summary: Queues a command for wps_enrollee_task. The commands are executed
+ * one after the other in the order they are received.
+ *
+ * Parameters:
+ *  wps_enrollee_command_type_t type: Command to be executed.
+ *  uint32_t arg: Command argument (number of cycles of the stress commands).
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the command was queued.
+ *
+ ******************************************************************************/
+cy_rslt_t wps_enrollee_send_command(wps_enrollee_command_type_t type, uint32_t arg)
+{
+    wps_enrollee_command_t command = { .type = type, .arg = arg };
+
+    if ((NULL == wps_enrollee_command_queue) ||
+        (pdTRUE != xQueueSend(wps_enrollee_command_queue, &command, 0)))
+    {
+        return WPS_ENROLLEE_RSLT_BUSY;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/*******************************************************************************
+ * Function Name: clear_cancel_request
+ *******************************************************************************
+ * Summary: Clears a previous cancel request when wps_enrollee_task starts a
+ * command that can be cancelled. Clearing it when the command is sent instead
+ * would drop a cancel of the command that is running whenever another one is
+ * queued behind it. A cancel applies to the command running when it is
+ * issued; commands still in the queue run afterwards. Other commands, such as
+ * those queued on network events, do not clear the request.
+ *
+ * Parameters:
+ *  wps_enrollee_command_type_t type: Command dequeued.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void clear_cancel_request(wps_enrollee_command_type_t type)
+{
+    if ((WPS_ENROLLEE_CMD_START_WPS == type) || (WPS_ENROLLEE_CMD_STRESS_CONNECT == type) ||
+        (WPS_ENROLLEE_CMD_STRESS_WPS == type))
+    {
+        is_cancel_requested = false;
+        wps_prescan_clear_cancel();
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: wps_enrollee_cancel
+ *******************************************************************************
+ * Summary: Cancels the wait for an active WPS registrar and stops a running
+ * stress test after its current cycle. A WPS transaction that has already been
+ * started runs until it completes or times out.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void wps_enrollee_cancel(void)
+{
+    is_cancel_requested = true;
+    wps_prescan_cancel();
+}
+
+
+/*******************************************************************************
+ * Function Name: wps_enrollee_set_mode
+ *******************************************************************************
+ * Summary: Selects the WPS mode used by the next WPS command, whether it is
+ * started from the console, the user button, or a stress test. A WPS
+ * transaction in progress keeps its mode.
+ *
+ * Parameters:
+ *  wps_enrollee_mode_t mode: WPS mode.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void wps_enrollee_set_mode(wps_enrollee_mode_t mode)
+{
+    if (mode < WPS_ENROLLEE_MODE_COUNT)
+    {
+        wps_mode = mode;
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: wps_enrollee_get_mode
+ *******************************************************************************
+ * Summary: Returns the WPS mode used by the next WPS command.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  wps_enrollee_mode_t: WPS mode.
+ *
+ ******************************************************************************/
+wps_enrollee_mode_t wps_enrollee_get_mode(void)
+{
+    return wps_mode;
+}
+
+
+/*******************************************************************************
+ * Function Name: wps_enrollee_mode_name
+ *******************************************************************************
+ * Summary: Returns the printable name of a WPS mode.
+ *
+ * Parameters:
+ *  wps_enrollee_mode_t mode: WPS mode.
+ *
+ * Return:
+ *  const char*: Name of the mode.
+ *
+ ******************************************************************************/
+const char* wps_enrollee_mode_name(wps_enrollee_mode_t mode)
+{
+    return (mode < WPS_ENROLLEE_MODE_COUNT) ? mode_names[mode] : "unknown";
+}
+
+
+/*******************************************************************************
+ * Function Name: wps_enrollee_get_stats
+ *******************************************************************************
+ * Summary: Copies the provisioning and connection statistics.
+ *
+ * Parameters:
+ *  wps_enrollee_stats_t *stats_copy: Filled with the statistics.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void wps_enrollee_get_stats(wps_enrollee_stats_t *stats_copy)
+{
+    taskENTER_CRITICAL();
+    memcpy(stats_copy, &stats, sizeof(wps_enrollee_stats_t));
+    taskEXIT_CRITICAL();
+}
+
+
+/*******************************************************************************
+ * Function Name: wps_provision_and_connect
+ *******************************************************************************
+ * Summary: Obtains the AP credentials through WPS in the selected mode and
+ * connects to the AP with the first credential obtained. In race mode, the
+ * enrollee is started in the mode of the registrar that becomes active first.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  cy_rslt_t: The status of the provisioning and connection.
+ *
+ ******************************************************************************/
+static cy_rslt_t wps_provision_and_connect(void)
+{
+    cy_rslt_t result;
+    wps_enrollee_mode_t mode = wps_mode;
+    cy_wcm_wps_config_t wps_config = { .mode = CY_WCM_WPS_PBC_MODE };
+    cy_wcm_wps_credential_t credentials[MAX_WIFI_CREDENTIALS_COUNT];
+    uint16_t credential_count = MAX_WIFI_CREDENTIALS_COUNT;
+    wps_prescan_registrar_t registrar;
+    char pin_string[CY_WCM_WPS_PIN_LENGTH];
+    wps_enrollee_method_stats_t *method_stats;
+    TickType_t start_time = xTaskGetTickCount();
+    TickType_t wps_start_time;
+    uint32_t time_to_credential_ms;
+
+    memset(credentials, 0, sizeof(credentials));
+
+    APP_INFO(("Starting Enrollee in %s mode.\n", wps_enrollee_mode_name(mode)));
+
+    /* Check for the WPS mode.*/
+    if (WPS_ENROLLEE_MODE_PBC != mode)
+    {
+        /* Here, the WPS PIN is generated by the device. the user has to
+         * enter the pin in the AP to join the network through WPS.
+         */
+        cy_wcm_wps_generate_pin(pin_string);
+        APP_INFO(("Enter this PIN: \'%s\' in your AP.\n", pin_string));
+    }
+
+    if (WPS_ENROLLEE_MODE_PIN != mode)
+    {
+        APP_INFO(("Press the push button on your WPS AP.\n"));
+    }
+
+    stats.wps_attempts++;
+
+    /* Wait for the AP to activate its registrar before starting the
+     * enrollee, to detect a PBC session overlap and, in race mode, to
+     * choose the method activated first. cy_wcm_wps_enrollee() takes no
+     * channel or BSSID, so the enrollee still scans every channel; the
+     * wait adds the delay between the activation of the registrar and the
+     * scan that sees it, which is recorded in the statistics.
+     */
+    if (WPS_ENROLLEE_MODE_RACE == mode)
+    {
+        result = wps_prescan_race_registrar(WPS_PRESCAN_TIMEOUT_MSEC, &registrar);
+    }
+    else
+    {
+        wps_config.mode = (WPS_ENROLLEE_MODE_PIN == mode) ? CY_WCM_WPS_PIN_MODE : CY_WCM_WPS_PBC_MODE;
+        result = wps_prescan_find_registrar(wps_config.mode, WPS_PRESCAN_TIMEOUT_MSEC, &registrar);
+    }
+
+    if (WPS_PRESCAN_RSLT_PBC_OVERLAP == result)
+    {
+        ERR_INFO(("PBC is active on more than one network. Retry after some time.\n"));
+        conn_journal_append(CONN_JOURNAL_EVENT_WPS_FAILED, 0, (uint32_t)result);
+        stats.wps_failures++;
+        return result;
+    }
+    else if (CY_RSLT_SUCCESS != result)
+    {
+        ERR_INFO(("No active WPS registrar found.\n"));
+        conn_journal_append(CONN_JOURNAL_EVENT_WPS_FAILED, 0, (uint32_t)result);
+        stats.wps_failures++;
+        return result;
+    }
+
+    /* Commit to the method activated on the AP. */
+    if (WPS_DEVICE_PASSWORD_ID_PBC == registrar.device_password_id)
+    {
+        wps_config.mode = CY_WCM_WPS_PBC_MODE;
+        method_stats = &stats.pbc;
+    }
+    else
+    {
+        wps_config.mode = CY_WCM_WPS_PIN_MODE;
+        wps_config.password = pin_string;
+        method_stats = &stats.pin;
+    }
+
+    if (WPS_ENROLLEE_MODE_RACE == mode)
+    {
+        APP_INFO(("%s activated first on the AP. Continuing in that mode.\n",
+                  (CY_WCM_WPS_PBC_MODE == wps_config.mode) ? "Push button" : "PIN"));
+    }
+
+    APP_INFO(("Found WPS registrar '%s' on channel %d.\n", registrar.ssid, registrar.channel));
+
+    conn_journal_append(CONN_JOURNAL_EVENT_WPS_START, (uint8_t)wps_config.mode, 0);
+    wps_start_time = xTaskGetTickCount();
+    stats.last_registrar_wait_ms = (wps_start_time - start_time) * portTICK_PERIOD_MS;
+    stats.last_registrar_detect_ms = (uint32_t)(wps_start_time * portTICK_PERIOD_MS) - registrar.first_seen_ms;
+
+    TRACE_RECORDER_SPAN_BEGIN("cy_wcm_wps_enrollee");
+    result = cy_wcm_wps_enrollee(&wps_config, &enrollee_details, credentials, &credential_count);
+    TRACE_RECORDER_SPAN_END("cy_wcm_wps_enrollee");
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        ERR_INFO(("WPS Enrollee failed.\n"));
+        conn_journal_append(CONN_JOURNAL_EVENT_WPS_FAILED, 0, (uint32_t)result);
+        stats.wps_failures++;
+        return result;
+    }
+
+    APP_INFO(("WPS Success.\n"));
+    stats.wps_successes++;
+    stats.last_wps_duration_ms = (xTaskGetTickCount() - wps_start_time) * portTICK_PERIOD_MS;
+
+    time_to_credential_ms = (xTaskGetTickCount() - start_time) * portTICK_PERIOD_MS;
+    method_stats->credentials++;
+    method_stats->last_time_to_credential_ms = time_to_credential_ms;
+    method_stats->total_time_to_credential_ms += time_to_credential_ms;
+    conn_journal_append(CONN_JOURNAL_EVENT_WPS_SUCCESS, (uint8_t)credential_count,
+                        stats.last_wps_duration_ms);
+
+    /* Print the WPS credentials obtained through WPS.*/
+    for (uint32_t loop = 0; loop < credential_count; loop++)
+    {
+        print_wps_ap_credential(&credentials[loop]);
+    }
+
+    /* Copy credentials of first AP credential obtained through WPS and
+     * connect to AP.
+     */
+    memset(&connect_param, 0, sizeof(cy_wcm_connect_params_t));
+    memcpy(connect_param.ap_credentials.SSID, credentials->ssid, sizeof(credentials->ssid));
+    memcpy(connect_param.ap_credentials.password, credentials->passphrase, sizeof(credentials->passphrase));
+    connect_param.ap_credentials.security = credentials->security;
+    is_credential_available = true;
+
+    /* Join the AP found during the pre-scan directly when the
+     * credential belongs to its network.
+     */
+    connect_param.band = CY_WCM_WIFI_BAND_ANY;
+    if (0 == strncmp((const char *)credentials->ssid, (const char *)registrar.ssid, sizeof(registrar.ssid)))
+    {
+        memcpy(connect_param.BSSID, registrar.bssid, sizeof(connect_param.BSSID));
+        connect_param.band = registrar.band;
+    }
+
+    result = wifi_connect(&connect_param, &ip_addr);
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        /* Failed after maximum retry attempts. */
+        ERR_INFO(("Exceeded maximum Wi-Fi connection attempts. Failed to connect to Wi-Fi\n"));
+    }
+
+    return result;
+}
+
+
+/*******************************************************************************
+ * Function Name: relay_provision_and_connect
+ *******************************************************************************
+ * Summary: Requests the network credential from a nearby provisioning relay
+ * and connects to the AP with it.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if connected with a credential from a relay.
+ *
+ ******************************************************************************/
+static cy_rslt_t relay_provision_and_connect(void)
+{
+    cy_rslt_t result;
+    cy_wcm_connect_params_t relay_credential;
+    wps_prescan_network_t relay;
+    TickType_t start_time = xTaskGetTickCount();
+    uint32_t duration_ms;
+
+    if (!PROVISIONING_RELAY_ENABLE)
+    {
+        return PROVISIONING_RELAY_RSLT_NOT_ENABLED;
+    }
+
+    APP_INFO(("Looking for a provisioning relay.\n"));
+
+    /* The relay is joined only if its soft-AP is seen in a scan. The scan
+     * also fills the cache of the WPS pre-scan that follows if no relay is
+     * found.
+     */
+    if (CY_RSLT_SUCCESS != wps_prescan_find_network(PROVISIONING_RELAY_SSID, &relay))
+    {
+        APP_INFO(("No provisioning relay found. Starting WPS.\n"));
+        return PROVISIONING_RELAY_RSLT_NOT_FOUND;
+    }
+
+    result = provisioning_relay_request(&relay.bssid, relay.band, &relay_credential);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        ERR_INFO(("Failed to obtain the credential from the provisioning relay. Starting WPS.\n"));
+        return result;
+    }
+
+    duration_ms = (xTaskGetTickCount() - start_time) * portTICK_PERIOD_MS;
+    APP_INFO(("Received the credential of '%s' from a relay in %lu ms.\n",
+              relay_credential.ap_credentials.SSID, (unsigned long)duration_ms));
+    stats.relay_provisions++;
+    conn_journal_append(CONN_JOURNAL_EVENT_RELAY_PROVISIONED, 0, duration_ms);
+
+    memcpy(&connect_param, &relay_credential, sizeof(connect_param));
+    is_credential_available = true;
+
+    return wifi_connect(&connect_param, &ip_addr);
+}
+
+
+/*******************************************************************************
+ * Function Name: disconnect_from_ap
+ *******************************************************************************
+ * Summary: Disconnects from the AP if the device is connected.
+ *
+ * Parameters:
+ *  const char *message: Message printed before disconnecting (optional).
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void disconnect_from_ap(const char *message)
+{
+    if(connection_state_is_connected())
+    {
+        if (NULL != message)
+        {
+            APP_INFO(("%s", message));
+        }
+
+        /* The relay soft-AP follows the channel of the AP, so it is stopped
+         * before leaving the AP.
+         */
+        provisioning_relay_stop();
+
+        if(CY_RSLT_SUCCESS == cy_wcm_disconnect_ap())
+        {
+            APP_INFO(("Disconnected from Wi-Fi.\n"));
+            connection_state_set(CONNECTION_STATE_DISCONNECTED);
+            stats.user_disconnects++;
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: run_stress_test
+ *******************************************************************************
+ * Summary: Runs the given number of provisioning/connection cycles and prints
+ * the latency percentiles and the failure count. Each cycle disconnects from
+ * the AP and then either reconnects with the stored credentials, which needs
+ * no user interaction, or runs the complete WPS provisioning followed by the
+ * connection. A WPS cycle waits for an active registrar like any WPS run, so
+ * the registrar must be activated on the AP once per cycle, by pressing its
+ * button or entering the PIN, and the latency includes that wait.
+ *
+ * Parameters:
+ *  uint32_t cycles: Number of cycles, limited to STRESS_TEST_MAX_CYCLES.
+ *  bool is_wps_cycle: true to run WPS in every cycle.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void run_stress_test(uint32_t cycles, bool is_wps_cycle)
+{
+    static uint32_t latency_ms[STRESS_TEST_MAX_CYCLES];
+    uint32_t success_count = 0;
+    uint32_t failure_count = 0;
+    uint32_t cycle;
+    cy_rslt_t result;
+    TickType_t start_time;
+
+    if (!is_wps_cycle && !is_credential_available)
+    {
+        ERR_INFO(("No credentials available. Run WPS first.\n"));
+        return;
+    }
+
+    if (cycles > STRESS_TEST_MAX_CYCLES)
+    {
+        cycles = STRESS_TEST_MAX_CYCLES;
+    }
+
+    if (is_wps_cycle)
+    {
+        APP_INFO(("Activate the WPS registrar on the AP once for each of the %lu cycles.\n", (unsigned long)cycles));
+    }
+
+    for (cycle = 0; (cycle < cycles) && !is_cancel_requested; cycle++)
+    {
+        disconnect_from_ap(NULL);
+
+        start_time = xTaskGetTickCount();
+        result = is_wps_cycle ? wps_provision_and_connect() : wifi_connect(&connect_param, &ip_addr);
+
+        if (CY_RSLT_SUCCESS == result)
+        {
+            latency_ms[success_count] = (xTaskGetTickCount() - start_time) * portTICK_PERIOD_MS;
+            APP_INFO(("Stress cycle %lu/%lu passed in %lu ms.\n", (unsigned long)(cycle + 1),
+                      (unsigned long)cycles, (unsigned long)latency_ms[success_count]));
+            success_count++;
+        }
+        else
+        {
+            ERR_INFO(("Stress cycle %lu/%lu failed with error code 0x%08lx.\n", (unsigned long)(cycle + 1),
+                      (unsigned long)cycles, (unsigned long)result));
+            failure_count++;
         }
+
+        vTaskDelay(pdMS_TO_TICKS(STRESS_TEST_CYCLE_DELAY_MSEC));
+    }
+
+    /* Sort the latencies to read the percentiles. */
+    for (uint32_t i = 1; i < success_count; i++)
+    {
+        uint32_t value = latency_ms[i];
+        uint32_t j = i;
+
+        while ((j > 0) && (latency_ms[j - 1] > value))
+        {
+            latency_ms[j] = latency_ms[j - 1];
+            j--;
+        }
+        latency_ms[j] = value;
+    }
+
+    APP_INFO(("Stress test: %lu cycles, %lu passed, %lu failed.\n", (unsigned long)cycle,
+              (unsigned long)success_count, (unsigned long)failure_count));
+
+    if (success_count > 0)
+    {
+        APP_INFO(("Latency (ms): p50 = %lu, p90 = %lu, p99 = %lu, max = %lu.\n",
+                  (unsigned long)latency_ms[PERCENTILE_INDEX(success_count, 50u)],
+                  (unsigned long)latency_ms[PERCENTILE_INDEX(success_count, 90u)],
+                  (unsigned long)latency_ms[PERCENTILE_INDEX(success_count, 99u)],
+                  (unsigned long)latency_ms[success_count - 1]));
     }
 }
 
@@ -238,42 +890,76 @@ void wps_enrollee_task(void *arg)
  * Function Name: network_event_callback
  *******************************************************************************
  * Summary: This callback function is called when there is a change in the link
- * status. Registering this callback function will enable the notifications from
- * WCM in the events of disconnection, reconnection, and change in IP address.
+ * status. It is subscribed to the network event dispatcher for the events of
+ * disconnection, reconnection, and change in IP address, and runs in the
+ * dispatcher task context. A disconnection is handled as a link loss only when
+ * connected to the AP.
  *
  * Parameters:
  * cy_wcm_event_t event: Network event as listed in the enumeration 
  *                       cy_wcm_event_t.
- * cy_wcm_event_data_t *event_data: Contains data related to the network event.
+ * const cy_wcm_event_data_t *event_data: Contains data related to the network
+ *                                        event.
+ * void *arg: Subscriber argument (unused).
  *
  * Return:
  * void
  *
  ******************************************************************************/
-static void network_event_callback(cy_wcm_event_t event, cy_wcm_event_data_t *event_data)
+static void network_event_callback(cy_wcm_event_t event, const cy_wcm_event_data_t *event_data, void *arg)
 {
     if (CY_WCM_EVENT_DISCONNECTED == event)
     {
+        /* Leaving the soft-AP of a provisioning relay after requesting the
+         * credential, or a disconnection requested by the application, is not
+         * a link loss.
+         */
+        if (!connection_state_is_connected())
+        {
+            return;
+        }
+
         APP_INFO(("Disconnected from Wi-Fi\n"));
-        is_network_connected = false;
+        connection_state_set(CONNECTION_STATE_DISCONNECTED);
+        stats.link_losses++;
+        link_loss_time = xTaskGetTickCount();
+        is_link_lost = true;
+        conn_journal_append(CONN_JOURNAL_EVENT_DISCONNECTED, 0, 0);
     }
     else if (CY_WCM_EVENT_RECONNECTED == event)
     {
         APP_INFO(("Reconnected to Wi-Fi.\n"));
-        is_network_connected = true;
+        connection_state_set(CONNECTION_STATE_CONNECTED);
+        record_link_restored();
+        conn_journal_append(CONN_JOURNAL_EVENT_RECONNECTED, 0, 0);
+
+        /* The WCM may have rejoined another AP of the network on another
+         * channel, which the relay soft-AP has to follow.
+         */
+        if (PROVISIONING_RELAY_ENABLE)
+        {
+            wps_enrollee_send_command(WPS_ENROLLEE_CMD_REFRESH_RELAY, 0);
+        }
     }
     /* This event corresponds to the event when the IP address of the device
      * changes.
      */
     else if (CY_WCM_EVENT_IP_CHANGED == event)
     {
-        if (event_data->ip_addr.version == CY_WCM_IP_VER_V4)
+        if ((event_data->ip_addr.version == CY_WCM_IP_VER_V4) &&
+            provisioning_relay_is_relay_network(event_data->ip_addr.ip.v4))
+        {
+            /* Address of a relay soft-AP joined to request the credential. */
+        }
+        else if (event_data->ip_addr.version == CY_WCM_IP_VER_V4)
         {
             APP_INFO(("Assigned IP address = %s\n", ip4addr_ntoa((const ip4_addr_t *)&event_data->ip_addr.ip.v4)));
+            conn_journal_append(CONN_JOURNAL_EVENT_IP_CHANGED, CY_WCM_IP_VER_V4, event_data->ip_addr.ip.v4);
         }
         else if(event_data->ip_addr.version == CY_WCM_IP_VER_V6)
         {
             APP_INFO(("Assigned IP address = %s\n", ip6addr_ntoa((const ip6_addr_t *)&event_data->ip_addr.ip.v6)));
+            conn_journal_append(CONN_JOURNAL_EVENT_IP_CHANGED, CY_WCM_IP_VER_V6, 0);
         }
     }
 }
@@ -297,26 +983,58 @@ static cy_rslt_t wifi_connect(cy_wcm_connect_params_t *connect_param, cy_wcm_ip_
 {
     APP_INFO(("Connecting to AP \n"));
     cy_rslt_t result;
+    cy_rslt_t relay_result;
+    uint32_t conn_retries;
+    TickType_t start_time = xTaskGetTickCount();
+
+    connection_state_set(CONNECTION_STATE_CONNECTING);
 
     /* Attempt to connect to WiFi until a connection is made or until
      * MAX_WIFI_RETRY_COUNT attempts have been made.
      */
-    for(uint32_t conn_retries = 0; conn_retries < MAX_WIFI_RETRY_COUNT; conn_retries++ )
+    for(conn_retries = 0; conn_retries < MAX_WIFI_RETRY_COUNT; conn_retries++ )
     {
+        stats.connect_attempts++;
+        TRACE_RECORDER_SPAN_BEGIN("cy_wcm_connect_ap");
         result = cy_wcm_connect_ap(connect_param, ip_address);
+        TRACE_RECORDER_SPAN_END("cy_wcm_connect_ap");
 
         if(result == CY_RSLT_SUCCESS)
         {
             APP_INFO(("Successfully connected to Wi-Fi network '%s'.\n", connect_param->ap_credentials.SSID));
+            connection_state_set(CONNECTION_STATE_CONNECTED);
+            stats.connect_successes++;
+            record_link_restored();
+            stats.last_connect_duration_ms = (xTaskGetTickCount() - start_time) * portTICK_PERIOD_MS;
+            connection_context_save(connect_param);
+            conn_journal_append(CONN_JOURNAL_EVENT_CONNECTED, (uint8_t)(conn_retries + 1),
+                                stats.last_connect_duration_ms);
+
+            /* Hand the credential on to the devices that are not yet
+             * provisioned.
+             */
+            relay_result = provisioning_relay_start(connect_param);
+            if ((CY_RSLT_SUCCESS != relay_result) && (PROVISIONING_RELAY_RSLT_NOT_ENABLED != relay_result))
+            {
+                ERR_INFO(("Failed to start the provisioning relay.\n"));
+            }
             break;
         }
 
         ERR_INFO(("Connection to Wi-Fi network failed with error code %d."
                "Retrying in %d ms...\n", (int)result, WIFI_CONN_RETRY_INTERVAL_MSEC));
+        conn_journal_append(CONN_JOURNAL_EVENT_CONNECT_RETRY, (uint8_t)(conn_retries + 1), (uint32_t)result);
                
         vTaskDelay(pdMS_TO_TICKS(WIFI_CONN_RETRY_INTERVAL_MSEC));
     }
 
+    if(result != CY_RSLT_SUCCESS)
+    {
+        connection_state_set(CONNECTION_STATE_DISCONNECTED);
+        stats.connect_failures++;
+        conn_journal_append(CONN_JOURNAL_EVENT_CONNECT_FAILED, (uint8_t)conn_retries, (uint32_t)result);
+    }
+
     return result;
 }
 
@@ -398,12 +1116,49 @@ static void print_wps_ap_credential(cy_wcm_wps_credential_t *result)
 }
 
 
+/*******************************************************************************
+ * Function Name: print_connection_journal
+ *******************************************************************************
+ * Summary: This function prints the newest records of the connection journal,
+ * which survive resets, oldest first.
+ *
+ * Parameters:
+ *  uint32_t count: Number of records to print, limited to
+ *                  CONN_JOURNAL_PRINT_MAX_COUNT.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void print_connection_journal(uint32_t count)
+{
+    conn_journal_record_t records[CONN_JOURNAL_PRINT_MAX_COUNT];
+
+    if (count > CONN_JOURNAL_PRINT_MAX_COUNT)
+    {
+        count = CONN_JOURNAL_PRINT_MAX_COUNT;
+    }
+
+    count = conn_journal_read_latest(records, count);
+
+    for (uint32_t loop = count; loop > 0; loop--)
+    {
+        conn_journal_record_t *record = &records[loop - 1];
+
+        APP_INFO(("Journal #%lu at %lu ms: %s, detail = %u, value = 0x%08lx.\n",
+                  (unsigned long)record->sequence, (unsigned long)record->timestamp_ms,
+                  conn_journal_event_name(record->event), record->detail,
+                  (unsigned long)record->value));
+    }
+}
+
+
 /*******************************************************************************
  * Function Name: gpio_interrupt_handler
  *******************************************************************************
  * Summary:
  *  GPIO interrupt service routine. This function detects button presses and
- *  sends task notifications to the WPS Enrollee task to scan for WPS AP.
+ *  sends a command to the WPS Enrollee task to scan for WPS AP.
  *
  * Parameters:
  *  void *arg : pointer to variable passed to the ISR
@@ -416,25 +1171,182 @@ static void print_wps_ap_credential(cy_wcm_wps_credential_t *result)
 static void gpio_interrupt_handler(void *arg, cyhal_gpio_event_t event)
 {
     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    wps_enrollee_command_t command = { .type = WPS_ENROLLEE_CMD_START_WPS, .arg = 0 };
+
+    TRACE_RECORDER_ISR_ENTER("gpio_interrupt_handler");
 
     /* Notify wps_enrollee_task to start scanning for existing WPS AP to obtain
      * credentials through WPS.
      */
-    xTaskNotifyFromISR(wps_enrollee_task_handle, 0x00, eSetValueWithoutOverwrite,
-                       &xHigherPriorityTaskWoken);
+    xQueueSendFromISR(wps_enrollee_command_queue, &command, &xHigherPriorityTaskWoken);
+
+    TRACE_RECORDER_ISR_EXIT("gpio_interrupt_handler");
 
     portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 }
 
 
+/*******************************************************************************
+ * Function Name: wcm_init_operation
+ *******************************************************************************
+ * Summary: Initializes the Wi-Fi Connection Manager. Run under fault recovery.
+ *
+ * Parameters:
+ *  void *arg: Pointer to the WCM configuration.
+ *
+ * Return:
+ *  cy_rslt_t: Result of cy_wcm_init().
+ *
+ ******************************************************************************/
+static cy_rslt_t wcm_init_operation(void *arg)
+{
+    return cy_wcm_init((cy_wcm_config_t *)arg);
+}
+
+
+/*******************************************************************************
+ * Function Name: button_init_operation
+ *******************************************************************************
+ * Summary: Initializes the user button GPIO. Run under fault recovery. A
+ * failed initialization may leave the pin reserved, so it is freed first.
+ *
+ * Parameters:
+ *  void *arg: Unused.
+ *
+ * Return:
+ *  cy_rslt_t: Result of cyhal_gpio_init().
+ *
+ ******************************************************************************/
+static cy_rslt_t button_init_operation(void *arg)
+{
+    (void)arg;
+
+    cyhal_gpio_free(CYBSP_USER_BTN);
+    return cyhal_gpio_init(CYBSP_USER_BTN, CYHAL_GPIO_DIR_INPUT,
+                           CYHAL_GPIO_DRIVE_PULLUP, CYBSP_BTN_OFF);
+}
+
+
+/*******************************************************************************
+ * Function Name: record_link_restored
+ *******************************************************************************
+ * Summary: Adds the time since the last link loss to the link restoration
+ * statistics, from which the mean time to restore the connection is computed.
+ * Called on every connection; only the first one after a link loss counts.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void record_link_restored(void)
+{
+    taskENTER_CRITICAL();
+    if (is_link_lost)
+    {
+        is_link_lost = false;
+        stats.link_restorations++;
+        stats.total_restore_time_ms += (xTaskGetTickCount() - link_loss_time) * portTICK_PERIOD_MS;
+    }
+    taskEXIT_CRITICAL();
+}
+
+
+/*******************************************************************************
+ * Function Name: resume_connection
+ *******************************************************************************
+ * Summary: Connects with the context retained across the reset. The join
+ * targets the cached AP with the cached PMK, and a recent DHCP lease is
+ * reused. If the connection fails, the context is discarded and the device
+ * waits for WPS as after power up.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void resume_connection(void)
+{
+    cy_rslt_t result;
+    uint32_t lease_remaining_ms;
+    bool is_lease_reused;
+    TickType_t start_time;
+
+    if (CY_RSLT_SUCCESS != connection_context_load(&connect_param, &resumed_lease, &lease_remaining_ms))
+    {
+        return;
+    }
+
+    is_credential_available = true;
+    is_lease_reused = (NULL != connect_param.static_ip_settings);
+
+    APP_INFO(("Resuming the connection to '%s'%s.\n", connect_param.ap_credentials.SSID,
+              is_lease_reused ? " with the retained DHCP lease" : ""));
+
+    start_time = xTaskGetTickCount();
+    result = wifi_connect(&connect_param, &ip_addr);
+    connection_context_record_resume((CY_RSLT_SUCCESS == result), is_lease_reused,
+                                     (xTaskGetTickCount() - start_time) * portTICK_PERIOD_MS);
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        /* The AP may have moved or the network may have changed. The
+         * credential is kept for the connect command, without the cached AP
+         * and lease.
+         */
+        ERR_INFO(("Failed to resume the connection. Press the user button to start WPS.\n"));
+        connection_context_clear();
+        connect_param.static_ip_settings = NULL;
+        memset(connect_param.BSSID, 0, sizeof(connect_param.BSSID));
+        connect_param.band = CY_WCM_WIFI_BAND_ANY;
+        return;
+    }
+
+    if (is_lease_reused)
+    {
+        /* pdMS_TO_TICKS() overflows for the longest reuse times. */
+        xTimerChangePeriod(lease_timer, (TickType_t)(lease_remaining_ms / portTICK_PERIOD_MS), 0);
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: lease_timer_callback
+ *******************************************************************************
+ * Summary: Asks wps_enrollee_task to obtain a new DHCP lease once the reused
+ * lease reaches its renewal time. Retries after a second if the command queue
+ * is full.
+ *
+ * Parameters:
+ *  TimerHandle_t timer: Handle of the lease renewal timer.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void lease_timer_callback(TimerHandle_t timer)
+{
+    if (CY_RSLT_SUCCESS != wps_enrollee_send_command(WPS_ENROLLEE_CMD_RENEW_LEASE, 0))
+    {
+        xTimerChangePeriod(timer, pdMS_TO_TICKS(1000u), 0);
+    }
+}
+
+
 /*******************************************************************************
 * Function Name: error_handler
 ********************************************************************************
 *
 * Summary:
 * This function processes unrecoverable errors such as any component
-* initialization errors etc. In case of such error, the system will halt the
-* CPU.
+* initialization errors etc. In case of such error, the device is warm reset
+* to recover from the error. If the error persists after
+* FAULT_RECOVERY_MAX_WARM_RESETS consecutive warm resets, the system will halt
+* the CPU.
 *
 * Parameters:
 * cy_rslt_t result: contains the result of an operation.
@@ -458,6 +1370,16 @@ void error_handler(cy_rslt_t result, char* message)
             ERR_INFO(("%s", message));
         }
 
+        if(fault_recovery_is_reset_allowed())
+        {
+            if(is_retarget_io_initialized)
+            {
+                ERR_INFO(("Error 0x%08lx. Resetting the device to recover.\n", (unsigned long)result));
+            }
+
+            fault_recovery_warm_reset(result);
+        }
+
         __disable_irq();
         CY_ASSERT(0);
     }
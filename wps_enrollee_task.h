@@ -62,11 +62,12 @@
 /*******************************************************************************
  * Macros
  ******************************************************************************/
-/* Set WPS_MODE_CONFIG to one of the values provided by the enumeration
- * cy_wcm_wps_mode_t in cy_wcm.h. The default mode used in this example is 
- * CY_WCM_WPS_PBC_MODE (push button based WPS).
+/* Set WPS_MODE_CONFIG to one of the values of the enumeration
+ * wps_enrollee_mode_t. This is the WPS mode used after startup; it can be
+ * changed at run time from the command console. The default mode used in this
+ * example is WPS_ENROLLEE_MODE_PBC (push button based WPS).
  */
-#define WPS_MODE_CONFIG                     CY_WCM_WPS_PBC_MODE
+#define WPS_MODE_CONFIG                     WPS_ENROLLEE_MODE_PBC
 
 /* The value of this macro specifies the maximum number of Wi-Fi networks the
  * device can join through WPS in one call to cy_wcm_wps_enrollee. This value is
@@ -93,6 +94,20 @@
 #define WPS_ENROLLEE_TASK_STACK_SIZE        (4096u)
 #define WPS_ENROLLEE_TASK_PRIORITY          (3u)
 
+/* Number of commands that can be pending for wps_enrollee_task. */
+#define WPS_ENROLLEE_COMMAND_QUEUE_LENGTH   (4u)
+
+/* Maximum number of cycles of one stress test and the pause between two
+ * successive cycles.
+ */
+#define STRESS_TEST_MAX_CYCLES              (200u)
+#define STRESS_TEST_CYCLE_DELAY_MSEC        (1000u)
+
+/* WPS enrollee result codes. */
+#define WPS_ENROLLEE_RSLT_MODULE            (CY_RSLT_MODULE_MIDDLEWARE_BASE + 0xF3u)
+#define WPS_ENROLLEE_RSLT_NO_MEMORY         CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, WPS_ENROLLEE_RSLT_MODULE, 1u)
+#define WPS_ENROLLEE_RSLT_BUSY              CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, WPS_ENROLLEE_RSLT_MODULE, 2u)
+
 #define GPIO_INTERRUPT_PRIORITY             (7u)
 #define MAX_SECURITY_TYPE_STRING_LENGTH     (15)
 
@@ -117,6 +132,77 @@
 #define SECURITY_UNKNOWN                    "UNKNOWN"
 
 
+/*******************************************************************************
+ * Enumerations
+ ******************************************************************************/
+/* Commands executed by wps_enrollee_task. */
+typedef enum
+{
+    WPS_ENROLLEE_CMD_START_WPS,
+    WPS_ENROLLEE_CMD_CONNECT,
+    WPS_ENROLLEE_CMD_DISCONNECT,
+    WPS_ENROLLEE_CMD_STRESS_CONNECT,
+    WPS_ENROLLEE_CMD_STRESS_WPS,
+    WPS_ENROLLEE_CMD_RENEW_LEASE,
+    WPS_ENROLLEE_CMD_REFRESH_RELAY
+} wps_enrollee_command_type_t;
+
+/* WPS modes of the enrollee. In race mode, the device generates and displays
+ * a PIN and at the same time waits for push button to be activated on the AP.
+ * The enrollee runs in the mode of the registrar that becomes active first.
+ */
+typedef enum
+{
+    WPS_ENROLLEE_MODE_PBC,
+    WPS_ENROLLEE_MODE_PIN,
+    WPS_ENROLLEE_MODE_RACE,
+    WPS_ENROLLEE_MODE_COUNT
+} wps_enrollee_mode_t;
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef struct
+{
+    wps_enrollee_command_type_t type;
+    uint32_t                    arg;
+} wps_enrollee_command_t;
+
+/* Credentials obtained through one WPS method. The time to credential is
+ * measured from the start of WPS, including the wait for the registrar.
+ */
+typedef struct
+{
+    uint32_t credentials;
+    uint32_t last_time_to_credential_ms;
+    uint32_t total_time_to_credential_ms;
+} wps_enrollee_method_stats_t;
+
+/* Provisioning and connection statistics since startup. */
+typedef struct
+{
+    uint32_t wps_attempts;
+    uint32_t wps_successes;
+    uint32_t wps_failures;
+    uint32_t connect_attempts;
+    uint32_t connect_successes;
+    uint32_t connect_failures;
+    uint32_t link_losses;           /* Disconnections not requested by the device */
+    uint32_t user_disconnects;      /* Disconnections requested from the console or the button */
+    uint32_t link_restorations;     /* Connections regained after a link loss */
+    uint32_t total_restore_time_ms; /* Sum of the times from link loss to connection */
+    uint32_t last_wps_duration_ms;
+    uint32_t last_registrar_wait_ms;    /* From the start of WPS to the start of the enrollee */
+    uint32_t last_registrar_detect_ms;  /* From the scan that first saw the registrar to the enrollee */
+    uint32_t last_connect_duration_ms;
+    uint32_t relay_provisions;
+    uint32_t last_provision_duration_ms;
+    wps_enrollee_method_stats_t pbc;
+    wps_enrollee_method_stats_t pin;
+} wps_enrollee_stats_t;
+
+
 /*******************************************************************************
  * Global Variables
  ******************************************************************************/
@@ -130,6 +216,13 @@ extern bool is_led_initialized;
  * Function Prototypes
  ******************************************************************************/
 void wps_enrollee_task(void* arg);
+cy_rslt_t wps_enrollee_send_command(wps_enrollee_command_type_t type, uint32_t arg);
+void wps_enrollee_cancel(void);
+void wps_enrollee_set_mode(wps_enrollee_mode_t mode);
+wps_enrollee_mode_t wps_enrollee_get_mode(void);
+const char* wps_enrollee_mode_name(wps_enrollee_mode_t mode);
+void wps_enrollee_get_stats(wps_enrollee_stats_t *stats_copy);
+void print_connection_journal(uint32_t count);
 void error_handler(cy_rslt_t result, char* message);
 
 #endif /*SOURCE_WPS_ENROLLEE_TASK_H_*/
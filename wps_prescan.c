@@ -0,0 +1,677 @@
+/*******************************************************************************
+* File Name: wps_prescan.c
+*
+* Description: This file contains the registrar wait: a pre-scan that looks
+* for APs with an active WPS registrar before the WPS enrollee is started. The
+* WPS information elements (IE) in the scan results are parsed to find the APs
+* with push button (PBC) active or the AP on which the enrollee PIN has been
+* entered. The result selects the WPS method and detects a PBC session
+* overlap; it does not narrow the scan of the enrollee, because
+* cy_wcm_wps_enrollee() takes no channel or BSSID.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <string.h>
+
+/* FreeRTOS includes */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/* Wi-Fi Connection Manager includes */
+#include "cy_wcm.h"
+
+#include "wps_prescan.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define IE_HEADER_LENGTH                    (2u)
+#define IE_ID_VENDOR_SPECIFIC               (0xDDu)
+
+/* WPS IE is a vendor specific IE with the Microsoft OUI and OUI type 4. */
+#define WPS_OUI_TYPE_LENGTH                 (4u)
+
+/* WPS attributes are encoded as big-endian 16-bit type and 16-bit length. */
+#define WPS_ATTR_HEADER_LENGTH              (4u)
+#define WPS_ATTR_DEVICE_PASSWORD_ID         (0x1012u)
+#define WPS_ATTR_SELECTED_REGISTRAR         (0x1041u)
+
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static const uint8_t wps_oui_type[WPS_OUI_TYPE_LENGTH] = { 0x00, 0x50, 0xF2, 0x04 };
+
+static wps_prescan_registrar_t registrar_cache[WPS_PRESCAN_CACHE_SIZE];
+static uint32_t registrar_count;
+static SemaphoreHandle_t cache_mutex;
+static SemaphoreHandle_t scan_complete_semaphore;
+static volatile bool is_prescan_cancelled = false;
+
+/* Band on which an active registrar was last seen. Successive pre-scans are
+ * limited to this band as long as that registrar is present in the cache.
+ */
+static cy_wcm_wifi_band_t last_registrar_band = CY_WCM_WIFI_BAND_ANY;
+static TickType_t last_registrar_timestamp;
+
+/* Start time of the running scan. The registrars first seen active in the
+ * same scan get the same first seen time, whatever the order in which the
+ * scan reports them.
+ */
+static volatile uint32_t scan_start_ms;
+
+/* SSID looked up by wps_prescan_find_network and the strongest AP seen with
+ * it. Both are protected by cache_mutex.
+ */
+static const char *watched_ssid = NULL;
+static bool is_watched_network_found;
+static wps_prescan_network_t watched_network;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static void prescan_scan_callback(cy_wcm_scan_result_t *result_ptr, void *user_data,
+                                  cy_wcm_scan_status_t status);
+static bool parse_wps_ie(const uint8_t *ie_ptr, uint32_t ie_len,
+                         bool *selected_registrar, uint16_t *device_password_id);
+static void cache_update(const cy_wcm_scan_result_t *result_ptr, uint16_t device_password_id);
+static void watched_network_update(const cy_wcm_scan_result_t *result_ptr);
+static cy_rslt_t cache_lookup_modes(const cy_wcm_wps_mode_t *modes, uint32_t mode_count,
+                                    wps_prescan_registrar_t *registrar);
+static cy_rslt_t wait_for_registrar(const cy_wcm_wps_mode_t *modes, uint32_t mode_count,
+                                    uint32_t timeout_ms, wps_prescan_registrar_t *registrar);
+static cy_rslt_t run_scan(void);
+static uint32_t get_time_ms(void);
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: wps_prescan_init
+ *******************************************************************************
+ * Summary: Creates the RTOS objects used by the pre-scan. Must be called once
+ * after the WCM is initialized.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the RTOS objects were created.
+ *
+ ******************************************************************************/
+cy_rslt_t wps_prescan_init(void)
+{
+    cache_mutex = xSemaphoreCreateMutex();
+    scan_complete_semaphore = xSemaphoreCreateBinary();
+
+    if ((NULL == cache_mutex) || (NULL == scan_complete_semaphore))
+    {
+        return WPS_PRESCAN_RSLT_SCAN_FAILED;
+    }
+
+    registrar_count = 0;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/*******************************************************************************
+ * Function Name: wps_prescan_find_registrar
+ *******************************************************************************
+ * Summary: Scans repeatedly until an AP with an active registrar for the given
+ * WPS mode is found, the timeout expires, or the pre-scan is cancelled. The
+ * cached results are used as long as they are within WPS_PRESCAN_CACHE_TTL_MSEC.
+ * In PBC mode, more than one network with PBC active is reported as a session
+ * overlap so that the enrollee is not started against the wrong AP.
+ *
+ * Parameters:
+ *  cy_wcm_wps_mode_t mode: WPS mode of the enrollee.
+ *  uint32_t timeout_ms: Maximum time to wait for an active registrar.
+ *  wps_prescan_registrar_t *registrar: Filled with the registrar details.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if an active registrar was found.
+ *
+ ******************************************************************************/
+cy_rslt_t wps_prescan_find_registrar(cy_wcm_wps_mode_t mode, uint32_t timeout_ms,
+                                     wps_prescan_registrar_t *registrar)
+{
+    return wait_for_registrar(&mode, 1u, timeout_ms, registrar);
+}
+
+
+/*******************************************************************************
+ * Function Name: wps_prescan_race_registrar
+ *******************************************************************************
+ * Summary: Scans repeatedly until an AP with an active registrar for either
+ * WPS mode is found, the timeout expires, or the pre-scan is cancelled. The
+ * Device Password ID of the returned registrar tells whether push button or
+ * the PIN was activated on the AP. If both are active, the one activated first
+ * wins; the PIN is preferred only when both were first seen in the same scan.
+ * A PIN registrar is still accepted while PBC is active on more than one
+ * network; the session overlap is only reported if no PIN registrar is found.
+ *
+ * Parameters:
+ *  uint32_t timeout_ms: Maximum time to wait for an active registrar.
+ *  wps_prescan_registrar_t *registrar: Filled with the registrar details.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if an active registrar was found.
+ *
+ ******************************************************************************/
+cy_rslt_t wps_prescan_race_registrar(uint32_t timeout_ms, wps_prescan_registrar_t *registrar)
+{
+    static const cy_wcm_wps_mode_t race_modes[] = { CY_WCM_WPS_PIN_MODE, CY_WCM_WPS_PBC_MODE };
+
+    return wait_for_registrar(race_modes, sizeof(race_modes) / sizeof(race_modes[0]), timeout_ms, registrar);
+}
+
+
+/*******************************************************************************
+ * Function Name: wps_prescan_find_network
+ *******************************************************************************
+ * Summary: Runs a single scan and looks up an AP with the given SSID in the
+ * results. The active registrars seen in the same scan are added to the cache,
+ * so a pre-scan started right after this one does not need to scan again.
+ *
+ * Parameters:
+ *  const char *ssid: SSID of the network.
+ *  wps_prescan_network_t *network: Filled with the strongest AP of the network.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the network was found,
+ *  WPS_PRESCAN_RSLT_NOT_FOUND if it was not seen in the scan.
+ *
+ ******************************************************************************/
+cy_rslt_t wps_prescan_find_network(const char *ssid, wps_prescan_network_t *network)
+{
+    cy_rslt_t result;
+
+    xSemaphoreTake(cache_mutex, portMAX_DELAY);
+    watched_ssid = ssid;
+    is_watched_network_found = false;
+    xSemaphoreGive(cache_mutex);
+
+    result = run_scan();
+
+    xSemaphoreTake(cache_mutex, portMAX_DELAY);
+    watched_ssid = NULL;
+    if ((CY_RSLT_SUCCESS == result) && !is_watched_network_found)
+    {
+        result = WPS_PRESCAN_RSLT_NOT_FOUND;
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        *network = watched_network;
+    }
+    xSemaphoreGive(cache_mutex);
+
+    return result;
+}
+
+
+/*******************************************************************************
+ * Function Name: wps_prescan_cancel
+ *******************************************************************************
+ * Summary: Stops an ongoing pre-scan. wps_prescan_find_registrar and
+ * wps_prescan_race_registrar return WPS_PRESCAN_RSLT_CANCELLED after the
+ * current scan finishes, and right away if called later, until
+ * wps_prescan_clear_cancel is called.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void wps_prescan_cancel(void)
+{
+    is_prescan_cancelled = true;
+    cy_wcm_stop_scan();
+}
+
+
+/*******************************************************************************
+ * Function Name: wps_prescan_clear_cancel
+ *******************************************************************************
+ * Summary: Clears a cancel request. It is called when a command that runs the
+ * pre-scan is accepted, so a cancel issued after that is kept until the
+ * pre-scan starts.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+void wps_prescan_clear_cancel(void)
+{
+    is_prescan_cancelled = false;
+}
+
+
+/*******************************************************************************
+ * Function Name: wait_for_registrar
+ *******************************************************************************
+ * Summary: Runs the pre-scans until a registrar for one of the given WPS modes
+ * is found in the cache, the timeout expires, or the pre-scan is cancelled.
+ *
+ * Parameters:
+ *  const cy_wcm_wps_mode_t *modes: WPS modes accepted, in order of preference
+ *  for registrars first seen in the same scan.
+ *  uint32_t mode_count: Number of entries in modes.
+ *  uint32_t timeout_ms: Maximum time to wait for an active registrar.
+ *  wps_prescan_registrar_t *registrar: Filled with the registrar details.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if an active registrar was found.
+ *
+ ******************************************************************************/
+static cy_rslt_t wait_for_registrar(const cy_wcm_wps_mode_t *modes, uint32_t mode_count,
+                                    uint32_t timeout_ms, wps_prescan_registrar_t *registrar)
+{
+    cy_rslt_t result;
+    TickType_t start_time = xTaskGetTickCount();
+
+    while (true)
+    {
+        result = cache_lookup_modes(modes, mode_count, registrar);
+        if (WPS_PRESCAN_RSLT_TIMEOUT != result)
+        {
+            return result;
+        }
+
+        if (is_prescan_cancelled)
+        {
+            return WPS_PRESCAN_RSLT_CANCELLED;
+        }
+
+        if ((xTaskGetTickCount() - start_time) >= pdMS_TO_TICKS(timeout_ms))
+        {
+            return WPS_PRESCAN_RSLT_TIMEOUT;
+        }
+
+        result = run_scan();
+        if (CY_RSLT_SUCCESS != result)
+        {
+            return result;
+        }
+
+        result = cache_lookup_modes(modes, mode_count, registrar);
+        if (WPS_PRESCAN_RSLT_TIMEOUT != result)
+        {
+            return result;
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(WPS_PRESCAN_INTERVAL_MSEC));
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: run_scan
+ *******************************************************************************
+ * Summary: Runs a single scan and waits for it to complete. The scan is limited
+ * to the band of the last seen registrar while it is still in the cache.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if the scan completed.
+ *
+ ******************************************************************************/
+static cy_rslt_t run_scan(void)
+{
+    cy_rslt_t result;
+    cy_wcm_scan_filter_t scan_filter;
+    cy_wcm_scan_filter_t *scan_filter_ptr = NULL;
+
+    if ((CY_WCM_WIFI_BAND_ANY != last_registrar_band) &&
+        ((xTaskGetTickCount() - last_registrar_timestamp) < pdMS_TO_TICKS(WPS_PRESCAN_CACHE_TTL_MSEC)))
+    {
+        memset(&scan_filter, 0, sizeof(scan_filter));
+        scan_filter.mode = CY_WCM_SCAN_FILTER_TYPE_BAND;
+        scan_filter.param.band = last_registrar_band;
+        scan_filter_ptr = &scan_filter;
+    }
+
+    /* Clear a completion left over from a previously stopped scan. */
+    xSemaphoreTake(scan_complete_semaphore, 0);
+
+    scan_start_ms = get_time_ms();
+
+    result = cy_wcm_start_scan(prescan_scan_callback, NULL, scan_filter_ptr);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return WPS_PRESCAN_RSLT_SCAN_FAILED;
+    }
+
+    if (pdTRUE != xSemaphoreTake(scan_complete_semaphore, pdMS_TO_TICKS(WPS_PRESCAN_SCAN_TIMEOUT_MSEC)))
+    {
+        cy_wcm_stop_scan();
+        return WPS_PRESCAN_RSLT_SCAN_FAILED;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/*******************************************************************************
+ * Function Name: prescan_scan_callback
+ *******************************************************************************
+ * Summary: Scan result callback invoked from the WCM context for every AP
+ * found. APs advertising an active WPS registrar are added to the cache.
+ *
+ * Parameters:
+ *  cy_wcm_scan_result_t *result_ptr: Scan result of a single AP.
+ *  void *user_data: User data passed to cy_wcm_start_scan (unused).
+ *  cy_wcm_scan_status_t status: Status of the scan.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void prescan_scan_callback(cy_wcm_scan_result_t *result_ptr, void *user_data,
+                                  cy_wcm_scan_status_t status)
+{
+    bool selected_registrar = false;
+    uint16_t device_password_id = 0;
+
+    (void)user_data;
+
+    if (CY_WCM_SCAN_COMPLETE == status)
+    {
+        xSemaphoreGive(scan_complete_semaphore);
+        return;
+    }
+
+    if (NULL == result_ptr)
+    {
+        return;
+    }
+
+    watched_network_update(result_ptr);
+
+    if (NULL == result_ptr->ie_ptr)
+    {
+        return;
+    }
+
+    if (parse_wps_ie(result_ptr->ie_ptr, result_ptr->ie_len, &selected_registrar, &device_password_id) &&
+        selected_registrar)
+    {
+        cache_update(result_ptr, device_password_id);
+    }
+}
+
+
+/*******************************************************************************
+ * Function Name: parse_wps_ie
+ *******************************************************************************
+ * Summary: Walks the IEs of a beacon or probe response and extracts the
+ * Selected Registrar and Device Password ID attributes of the WPS IE.
+ *
+ * Parameters:
+ *  const uint8_t *ie_ptr: Pointer to the IEs.
+ *  uint32_t ie_len: Length of the IEs.
+ *  bool *selected_registrar: Set if the registrar is active.
+ *  uint16_t *device_password_id: Device Password ID advertised by the AP.
+ *
+ * Return:
+ *  bool: true if a WPS IE was found.
+ *
+ ******************************************************************************/
+static bool parse_wps_ie(const uint8_t *ie_ptr, uint32_t ie_len,
+                         bool *selected_registrar, uint16_t *device_password_id)
+{
+    uint32_t offset = 0;
+    bool is_wps_ie_found = false;
+
+    while ((offset + IE_HEADER_LENGTH) <= ie_len)
+    {
+        uint8_t ie_id = ie_ptr[offset];
+        uint8_t ie_length = ie_ptr[offset + 1];
+        const uint8_t *ie_data = &ie_ptr[offset + IE_HEADER_LENGTH];
+
+        if ((offset + IE_HEADER_LENGTH + ie_length) > ie_len)
+        {
+            break;
+        }
+
+        if ((IE_ID_VENDOR_SPECIFIC == ie_id) && (ie_length >= WPS_OUI_TYPE_LENGTH) &&
+            (0 == memcmp(ie_data, wps_oui_type, WPS_OUI_TYPE_LENGTH)))
+        {
+            uint32_t attr_offset = WPS_OUI_TYPE_LENGTH;
+
+            is_wps_ie_found = true;
+
+            while ((attr_offset + WPS_ATTR_HEADER_LENGTH) <= ie_length)
+            {
+                uint16_t attr_type = (uint16_t)((ie_data[attr_offset] << 8) | ie_data[attr_offset + 1]);
+                uint16_t attr_length = (uint16_t)((ie_data[attr_offset + 2] << 8) | ie_data[attr_offset + 3]);
+                const uint8_t *attr_value = &ie_data[attr_offset + WPS_ATTR_HEADER_LENGTH];
+
+                if ((attr_offset + WPS_ATTR_HEADER_LENGTH + attr_length) > ie_length)
+                {
+                    break;
+                }
+
+                if ((WPS_ATTR_SELECTED_REGISTRAR == attr_type) && (attr_length >= 1u))
+                {
+                    *selected_registrar = (0u != attr_value[0]);
+                }
+                else if ((WPS_ATTR_DEVICE_PASSWORD_ID == attr_type) && (attr_length >= 2u))
+                {
+                    *device_password_id = (uint16_t)((attr_value[0] << 8) | attr_value[1]);
+                }
+
+                attr_offset += WPS_ATTR_HEADER_LENGTH + attr_length;
+            }
+        }
+
+        offset += IE_HEADER_LENGTH + ie_length;
+    }
+
+    return is_wps_ie_found;
+}
+
+
+/*******************************************************************************
+ * Function Name: cache_update
+ *******************************************************************************
+ * Summary: Adds or refreshes the cache entry of an AP with an active registrar.
+ * When the cache is full, the oldest entry is replaced.
+ *
+ * Parameters:
+ *  const cy_wcm_scan_result_t *result_ptr: Scan result of the AP.
+ *  uint16_t device_password_id: Device Password ID advertised by the AP.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void cache_update(const cy_wcm_scan_result_t *result_ptr, uint16_t device_password_id)
+{
+    uint32_t index;
+    uint32_t slot = 0;
+    uint32_t now_ms = get_time_ms();
+    bool is_new_activation;
+
+    xSemaphoreTake(cache_mutex, portMAX_DELAY);
+
+    for (index = 0; index < registrar_count; index++)
+    {
+        if (0 == memcmp(registrar_cache[index].bssid, result_ptr->BSSID, sizeof(cy_wcm_mac_t)))
+        {
+            break;
+        }
+
+        if ((now_ms - registrar_cache[index].last_seen_ms) > (now_ms - registrar_cache[slot].last_seen_ms))
+        {
+            slot = index;
+        }
+    }
+
+    if (index < registrar_count)
+    {
+        slot = index;
+
+        /* The registrar is active again after it expired or was activated in
+         * another mode.
+         */
+        is_new_activation = ((now_ms - registrar_cache[slot].last_seen_ms) >= WPS_PRESCAN_CACHE_TTL_MSEC) ||
+                            (device_password_id != registrar_cache[slot].device_password_id);
+    }
+    else
+    {
+        if (registrar_count < WPS_PRESCAN_CACHE_SIZE)
+        {
+            slot = registrar_count++;
+        }
+        is_new_activation = true;
+    }
+
+    memcpy(registrar_cache[slot].ssid, result_ptr->SSID, sizeof(cy_wcm_ssid_t));
+    memcpy(registrar_cache[slot].bssid, result_ptr->BSSID, sizeof(cy_wcm_mac_t));
+    registrar_cache[slot].channel = result_ptr->channel;
+    registrar_cache[slot].band = result_ptr->band;
+    registrar_cache[slot].signal_strength = result_ptr->signal_strength;
+    registrar_cache[slot].device_password_id = device_password_id;
+    registrar_cache[slot].last_seen_ms = now_ms;
+    if (is_new_activation)
+    {
+        registrar_cache[slot].first_seen_ms = scan_start_ms;
+    }
+
+    last_registrar_band = result_ptr->band;
+    last_registrar_timestamp = xTaskGetTickCount();
+
+    xSemaphoreGive(cache_mutex);
+}
+
+
+/*******************************************************************************
+ * Function Name: watched_network_update
+ *******************************************************************************
+ * Summary: Records the AP of a scan result if it belongs to the network looked
+ * up by wps_prescan_find_network and is stronger than the APs seen before.
+ *
+ * Parameters:
+ *  const cy_wcm_scan_result_t *result_ptr: Scan result of a single AP.
+ *
+ * Return:
+ *  void
+ *
+ ******************************************************************************/
+static void watched_network_update(const cy_wcm_scan_result_t *result_ptr)
+{
+    xSemaphoreTake(cache_mutex, portMAX_DELAY);
+
+    if ((NULL != watched_ssid) &&
+        (0 == strncmp((const char *)result_ptr->SSID, watched_ssid, sizeof(result_ptr->SSID))) &&
+        (!is_watched_network_found || (result_ptr->signal_strength > watched_network.signal_strength)))
+    {
+        memcpy(watched_network.bssid, result_ptr->BSSID, sizeof(watched_network.bssid));
+        watched_network.channel = result_ptr->channel;
+        watched_network.band = result_ptr->band;
+        watched_network.signal_strength = result_ptr->signal_strength;
+        is_watched_network_found = true;
+    }
+
+    xSemaphoreGive(cache_mutex);
+}
+
+
+/*******************************************************************************
+ * Function Name: cache_lookup_modes
+ *******************************************************************************
+ * Summary: Selects a registrar of one of the given WPS modes among the cache
+ * entries with wps_prescan_select_registrar.
+ *
+ * Parameters:
+ *  const cy_wcm_wps_mode_t *modes: WPS modes accepted.
+ *  uint32_t mode_count: Number of entries in modes.
+ *  wps_prescan_registrar_t *registrar: Filled with the registrar details.
+ *
+ * Return:
+ *  cy_rslt_t: The result of wps_prescan_select_registrar.
+ *
+ ******************************************************************************/
+static cy_rslt_t cache_lookup_modes(const cy_wcm_wps_mode_t *modes, uint32_t mode_count,
+                                    wps_prescan_registrar_t *registrar)
+{
+    cy_rslt_t result;
+
+    xSemaphoreTake(cache_mutex, portMAX_DELAY);
+    result = wps_prescan_select_registrar(registrar_cache, registrar_count, modes, mode_count,
+                                          get_time_ms(), registrar);
+    xSemaphoreGive(cache_mutex);
+
+    return result;
+}
+
+
+/*******************************************************************************
+ * Function Name: get_time_ms
+ *******************************************************************************
+ * Summary: Returns the time since the scheduler started, used for the cache
+ * entry times.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t: Time in milliseconds.
+ *
+ ******************************************************************************/
+static uint32_t get_time_ms(void)
+{
+    return (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,148 @@
+/*******************************************************************************
+* File Name: wps_prescan.h
+*
+* Description: This file includes the macros, structures, and function
+* prototypes of the WPS registrar pre-scan used in wps_prescan.c
+*
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ *  Include guard
+ ******************************************************************************/
+#ifndef SOURCE_WPS_PRESCAN_H_
+#define SOURCE_WPS_PRESCAN_H_
+
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+/* Wi-Fi Connection Manager includes */
+#include "cy_wcm.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Time in milliseconds for which an AP seen with an active WPS registrar is
+ * kept in the pre-scan cache. The registrar state changes when the user presses
+ * the button or enters the PIN on the AP, so the entries are kept short-lived.
+ */
+#define WPS_PRESCAN_CACHE_TTL_MSEC          (3000u)
+
+/* Maximum number of APs with an active WPS registrar held in the cache. */
+#define WPS_PRESCAN_CACHE_SIZE              (8u)
+
+/* Delay in milliseconds between two successive pre-scans while waiting for
+ * the registrar to become active.
+ */
+#define WPS_PRESCAN_INTERVAL_MSEC           (500u)
+
+/* Maximum time in milliseconds to wait for a single scan to complete. */
+#define WPS_PRESCAN_SCAN_TIMEOUT_MSEC       (10000u)
+
+/* Total time in milliseconds to wait for an active registrar. This matches the
+ * 120 seconds WPS walk time.
+ */
+#define WPS_PRESCAN_TIMEOUT_MSEC            (120000u)
+
+/* WPS Device Password ID values advertised by the registrar. */
+#define WPS_DEVICE_PASSWORD_ID_PIN          (0x0000u)
+#define WPS_DEVICE_PASSWORD_ID_PBC          (0x0004u)
+
+/* Pre-scan result codes. */
+#define WPS_PRESCAN_RSLT_MODULE             (CY_RSLT_MODULE_MIDDLEWARE_BASE + 0xF0u)
+#define WPS_PRESCAN_RSLT_TIMEOUT            CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, WPS_PRESCAN_RSLT_MODULE, 1u)
+#define WPS_PRESCAN_RSLT_PBC_OVERLAP        CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, WPS_PRESCAN_RSLT_MODULE, 2u)
+#define WPS_PRESCAN_RSLT_CANCELLED          CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, WPS_PRESCAN_RSLT_MODULE, 3u)
+#define WPS_PRESCAN_RSLT_SCAN_FAILED        CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, WPS_PRESCAN_RSLT_MODULE, 4u)
+#define WPS_PRESCAN_RSLT_NOT_FOUND          CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, WPS_PRESCAN_RSLT_MODULE, 5u)
+
+
+/*******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* AP with an active WPS registrar as seen in the scan results. first_seen_ms
+ * is the start time of the scan in which the registrar was first seen active
+ * in its current mode, and last_seen_ms the time it was last reported.
+ */
+typedef struct
+{
+    cy_wcm_ssid_t         ssid;
+    cy_wcm_mac_t          bssid;
+    uint8_t               channel;
+    cy_wcm_wifi_band_t    band;
+    int16_t               signal_strength;
+    uint16_t              device_password_id;
+    uint32_t              first_seen_ms;
+    uint32_t              last_seen_ms;
+} wps_prescan_registrar_t;
+
+/* AP of a network looked up by SSID in the scan results. */
+typedef struct
+{
+    cy_wcm_mac_t          bssid;
+    uint8_t               channel;
+    cy_wcm_wifi_band_t    band;
+    int16_t               signal_strength;
+} wps_prescan_network_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_rslt_t wps_prescan_init(void);
+cy_rslt_t wps_prescan_find_registrar(cy_wcm_wps_mode_t mode, uint32_t timeout_ms,
+                                     wps_prescan_registrar_t *registrar);
+cy_rslt_t wps_prescan_race_registrar(uint32_t timeout_ms, wps_prescan_registrar_t *registrar);
+cy_rslt_t wps_prescan_find_network(const char *ssid, wps_prescan_network_t *network);
+void wps_prescan_cancel(void);
+void wps_prescan_clear_cancel(void);
+
+/* Registrar selection, in wps_prescan_select.c. It uses no RTOS or WCM
+ * services so that it can be tested on the host.
+ */
+cy_rslt_t wps_prescan_select_registrar(const wps_prescan_registrar_t *entries, uint32_t entry_count,
+                                       const cy_wcm_wps_mode_t *modes, uint32_t mode_count,
+                                       uint32_t now_ms, wps_prescan_registrar_t *registrar);
+
+#endif /*SOURCE_WPS_PRESCAN_H_*/
+
+
+/* [] END OF FILE */
@@ -0,0 +1,154 @@
+/*******************************************************************************
+* File Name: wps_prescan_select.c
+*
+* Description: This file contains the selection of the WPS registrar among the
+* APs held in the pre-scan cache. It uses no RTOS or WCM services so that it
+* can be tested on the host.
+*
+* Related Document: See README.md
+*
+********************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <string.h>
+
+#include "wps_prescan.h"
+
+
+/*******************************************************************************
+ * Function Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function Name: wps_prescan_select_registrar
+ *******************************************************************************
+ * Summary: Selects a registrar among the cache entries seen within
+ * WPS_PRESCAN_CACHE_TTL_MSEC. Among the accepted WPS modes, the mode whose
+ * registrar was first seen active earliest wins, so in race mode the enrollee
+ * follows the action the user took first on the AP. Modes first seen in the
+ * same scan, which have the same first seen time, are taken in the order of
+ * the modes array. Within the selected
+ * mode, the strongest AP is returned. PBC active on more than one network is
+ * a session overlap and is not selected.
+ *
+ * Parameters:
+ *  const wps_prescan_registrar_t *entries: Cache entries.
+ *  uint32_t entry_count: Number of entries.
+ *  const cy_wcm_wps_mode_t *modes: WPS modes accepted.
+ *  uint32_t mode_count: Number of entries in modes.
+ *  uint32_t now_ms: Current time in milliseconds.
+ *  wps_prescan_registrar_t *registrar: Filled with the registrar details.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if a registrar was selected,
+ *  WPS_PRESCAN_RSLT_PBC_OVERLAP if the only registrars found are PBC
+ *  registrars of more than one network, or WPS_PRESCAN_RSLT_TIMEOUT if none
+ *  was found.
+ *
+ ******************************************************************************/
+cy_rslt_t wps_prescan_select_registrar(const wps_prescan_registrar_t *entries, uint32_t entry_count,
+                                       const cy_wcm_wps_mode_t *modes, uint32_t mode_count,
+                                       uint32_t now_ms, wps_prescan_registrar_t *registrar)
+{
+    cy_rslt_t result = WPS_PRESCAN_RSLT_TIMEOUT;
+    const wps_prescan_registrar_t *selected = NULL;
+    uint32_t selected_age_ms = 0;
+
+    for (uint32_t mode_index = 0; mode_index < mode_count; mode_index++)
+    {
+        uint16_t device_password_id = (CY_WCM_WPS_PBC_MODE == modes[mode_index]) ?
+                                      WPS_DEVICE_PASSWORD_ID_PBC : WPS_DEVICE_PASSWORD_ID_PIN;
+        const wps_prescan_registrar_t *strongest = NULL;
+        uint32_t mode_age_ms = 0;
+        bool is_overlap = false;
+
+        for (uint32_t index = 0; index < entry_count; index++)
+        {
+            const wps_prescan_registrar_t *entry = &entries[index];
+
+            /* The ages are compared rather than the times so that the
+             * wrap-around of the clock is handled.
+             */
+            if (((now_ms - entry->last_seen_ms) >= WPS_PRESCAN_CACHE_TTL_MSEC) ||
+                (device_password_id != entry->device_password_id))
+            {
+                continue;
+            }
+
+            /* A dual band AP advertises the same network on both bands; only a
+             * different network with PBC active is a session overlap.
+             */
+            if ((NULL != strongest) && (WPS_DEVICE_PASSWORD_ID_PBC == device_password_id) &&
+                (0 != strncmp((const char *)strongest->ssid, (const char *)entry->ssid, sizeof(cy_wcm_ssid_t))))
+            {
+                is_overlap = true;
+                break;
+            }
+
+            if ((NULL == strongest) || (entry->signal_strength > strongest->signal_strength))
+            {
+                strongest = entry;
+            }
+
+            if ((now_ms - entry->first_seen_ms) > mode_age_ms)
+            {
+                mode_age_ms = now_ms - entry->first_seen_ms;
+            }
+        }
+
+        if (is_overlap)
+        {
+            result = WPS_PRESCAN_RSLT_PBC_OVERLAP;
+        }
+        else if ((NULL != strongest) && ((NULL == selected) || (mode_age_ms > selected_age_ms)))
+        {
+            selected = strongest;
+            selected_age_ms = mode_age_ms;
+        }
+    }
+
+    if (NULL == selected)
+    {
+        return result;
+    }
+
+    memcpy(registrar, selected, sizeof(wps_prescan_registrar_t));
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/* [] END OF FILE */